@@ -0,0 +1,37 @@
+// 基准测试公共工具：计时与结果输出
+
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+
+namespace bench {
+
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * 运行fn共iterations次，返回每次的平均耗时（微秒）
+     * 正式计时前先预热warmup次
+     */
+    inline double measureMicros(int iterations, const std::function<void(int)>& fn, int warmup = 3) {
+        for (int i = 0; i < warmup; ++i) {
+            fn(i);
+        }
+        auto start = Clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            fn(i);
+        }
+        auto end = Clock::now();
+        double total = std::chrono::duration<double, std::micro>(end - start).count();
+        return iterations > 0 ? total / iterations : 0.0;
+    }
+
+    /**
+     * 输出一行结果
+     */
+    inline void report(const char* name, double microsPerIteration) {
+        std::printf("%-48s %12.2f us/iter\n", name, microsPerIteration);
+    }
+
+} // namespace bench
@@ -0,0 +1,83 @@
+// BitmapData批量像素操作基准：fillRect / copyPixels / crop / merge / threshold / colorTransform
+// 每种操作在多种尺寸下测试，并附带逐像素getPixel32/setPixel32复制作为参照
+
+#include "BenchUtil.hpp"
+#include "display/BitmapData.hpp"
+#include "geom/ColorTransform.hpp"
+#include "geom/Point.hpp"
+#include "geom/Rectangle.hpp"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+using namespace egret;
+
+namespace {
+
+    std::shared_ptr<BitmapData> makeNoise(int size) {
+        auto bmp = BitmapData::create(size, size, true, 0);
+        uint32_t seed = 0x12345678u;
+        std::vector<uint32_t> pixels(static_cast<size_t>(size) * size);
+        for (auto& p : pixels) {
+            seed = seed * 1664525u + 1013904223u;
+            p = seed;
+        }
+        bmp->setPixels(0, 0, size, size, pixels);
+        return bmp;
+    }
+
+    void runSize(int size) {
+        const int iterations = size >= 1024 ? 20 : 200;
+        auto src = makeNoise(size);
+        auto dst = makeNoise(size);
+        auto rect = Rectangle::create(0, 0, size, size);
+        auto origin = Point::create(0, 0);
+        auto originRect = Rectangle::create(0, 0, 0, 0);
+        ColorTransform tint(0.8, 0.9, 1.1, 1.0, 10, -5, 0, 0);
+
+        auto label = [size](const char* op) {
+            static char buffer[96];
+            std::snprintf(buffer, sizeof(buffer), "%-22s %4dx%-4d", op, size, size);
+            return buffer;
+        };
+
+        bench::report(label("naive per-pixel copy"), bench::measureMicros(iterations, [&](int) {
+            for (int y = 0; y < size; ++y) {
+                for (int x = 0; x < size; ++x) {
+                    dst->setPixel32(x, y, src->getPixel32(x, y));
+                }
+            }
+        }));
+        bench::report(label("fillRect"), bench::measureMicros(iterations, [&](int i) {
+            dst->fillRect(rect, 0xFF000000u | static_cast<uint32_t>(i));
+        }));
+        bench::report(label("copyPixels"), bench::measureMicros(iterations, [&](int) {
+            dst->copyPixels(src, rect, originRect);
+        }));
+        bench::report(label("copyPixels mergeAlpha"), bench::measureMicros(iterations, [&](int) {
+            dst->copyPixels(src, rect, originRect, true);
+        }));
+        bench::report(label("crop"), bench::measureMicros(iterations, [&](int) {
+            auto cropped = src->crop(rect);
+        }));
+        bench::report(label("merge"), bench::measureMicros(iterations, [&](int) {
+            dst->merge(src, rect, origin, 128, 128, 128, 128);
+        }));
+        bench::report(label("threshold"), bench::measureMicros(iterations, [&](int) {
+            dst->threshold(src, rect, origin, ">", 0x80000000u, 0xFFFF0000u, 0xFF000000u, true);
+        }));
+        bench::report(label("colorTransform"), bench::measureMicros(iterations, [&](int) {
+            dst->colorTransform(rect, tint);
+        }));
+    }
+
+} // namespace
+
+int main() {
+    for (int size : {64, 256, 1024, 2048}) {
+        runSize(size);
+        std::printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,54 @@
+// BitmapData脏矩形基准：2048x2048位图每帧修改1%像素后提交渲染
+// 对比 增量同步（脏矩形） 与 每帧BitmapData::invalidate整图重建
+
+#include "BenchUtil.hpp"
+#include "display/Bitmap.hpp"
+#include "display/BitmapData.hpp"
+#include "display/Texture.hpp"
+#include "geom/Matrix.hpp"
+#include "geom/Rectangle.hpp"
+#include "player/SkiaRenderBuffer.hpp"
+#include "player/SystemRenderer.hpp"
+
+#include <memory>
+
+using namespace egret;
+
+namespace {
+
+    constexpr int kBitmapSize = 2048;
+    constexpr int kBrushSize = 205;   // 205*205 ≈ 1% of 2048*2048
+    constexpr int kFrames = 200;
+
+    double runFrames(bool fullInvalidate) {
+        auto bitmapData = BitmapData::create(kBitmapSize, kBitmapSize, true, 0xFF202020);
+        auto bitmap = std::make_shared<Bitmap>(Texture::createFromBitmapData(bitmapData));
+        auto buffer = sys::createSkiaRenderBuffer(256, 256);
+        Matrix matrix(0.125, 0, 0, 0.125, 0, 0);
+        auto brush = Rectangle::create(0, 0, kBrushSize, kBrushSize);
+
+        // 首帧建立缓存
+        sys::systemRenderer->render(bitmap.get(), buffer.get(), matrix);
+
+        return bench::measureMicros(kFrames, [&](int frame) {
+            brush->setX((frame * 97) % (kBitmapSize - kBrushSize));
+            brush->setY((frame * 61) % (kBitmapSize - kBrushSize));
+            bitmapData->fillRect(brush, 0xFF000000u | static_cast<uint32_t>(frame * 0x010203));
+            if (fullInvalidate) {
+                BitmapData::invalidate(bitmapData);
+            }
+            sys::systemRenderer->render(bitmap.get(), buffer.get(), matrix);
+        });
+    }
+
+} // namespace
+
+int main() {
+    sys::initializeRenderers();
+
+    bench::report("dirty-rect incremental sync (1%/frame)", runFrames(false));
+    bench::report("full invalidate rebuild (1%/frame)", runFrames(true));
+
+    sys::cleanupRenderers();
+    return 0;
+}
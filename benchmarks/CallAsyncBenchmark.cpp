@@ -0,0 +1,104 @@
+// callAsync基准：多个工作线程向主线程投递完成回调，主线程逐帧取出执行
+// 对比互斥锁保护的std::function列表与无锁MPSC队列
+
+#include "BenchUtil.hpp"
+#include "utils/CallLater.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace egret;
+
+namespace {
+
+    constexpr int kProducers = 4;
+    constexpr int kTasksPerProducer = 50000;
+    constexpr int kTotalTasks = kProducers * kTasksPerProducer;
+
+    // 模拟解码结果：只能移动
+    struct Payload {
+        std::unique_ptr<int> value;
+    };
+
+    // 原实现加锁后的形式：std::function要求可拷贝，只能用shared_ptr包一层
+    struct LockedQueue {
+        std::mutex mutex;
+        std::vector<std::function<void()>> tasks;
+
+        void push(std::function<void()> task) {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push_back(std::move(task));
+        }
+
+        void execute() {
+            std::vector<std::function<void()>> list;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                list.swap(tasks);
+            }
+            for (auto& task : list) {
+                task();
+            }
+        }
+    };
+
+    template<typename Post, typename Drain>
+    void runProducers(std::atomic<long long>& sum, Post post, Drain drain) {
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; ++p) {
+            producers.emplace_back([&post, p]() {
+                for (int i = 0; i < kTasksPerProducer; ++i) {
+                    post(Payload{std::make_unique<int>(p + i)});
+                }
+            });
+        }
+        long long expected = 0;
+        for (int p = 0; p < kProducers; ++p) {
+            for (int i = 0; i < kTasksPerProducer; ++i) {
+                expected += p + i;
+            }
+        }
+        // 主线程：模拟逐帧取出执行，直到全部完成
+        while (sum.load(std::memory_order_relaxed) != expected) {
+            drain();
+            std::this_thread::yield();
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+    }
+
+} // namespace
+
+int main() {
+    const int iterations = 5;
+    std::atomic<long long> sum{0};
+    char name[96];
+
+    LockedQueue locked;
+    std::snprintf(name, sizeof(name), "mutex + std::function, %d tasks", kTotalTasks);
+    bench::report(name, bench::measureMicros(iterations, [&](int) {
+        sum = 0;
+        runProducers(sum, [&](Payload payload) {
+            auto shared = std::make_shared<Payload>(std::move(payload));
+            locked.push([&sum, shared]() { sum.fetch_add(*shared->value, std::memory_order_relaxed); });
+        }, [&]() { locked.execute(); });
+    }, 1));
+
+    std::snprintf(name, sizeof(name), "lock-free callAsync, %d tasks", kTotalTasks);
+    bench::report(name, bench::measureMicros(iterations, [&](int) {
+        sum = 0;
+        runProducers(sum, [&](Payload payload) {
+            CallLaterSystem::callAsync([&sum, payload = std::move(payload)]() {
+                sum.fetch_add(*payload.value, std::memory_order_relaxed);
+            });
+        }, []() { CallLaterSystem::executeAsyncs(); });
+    }, 1));
+
+    std::printf("(backlog after drain %zu)\n", CallLaterSystem::getAsyncBacklog());
+    return 0;
+}
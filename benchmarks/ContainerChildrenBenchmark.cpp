@@ -0,0 +1,106 @@
+// 子对象管理基准：构建/清空大列表（逐个与批量），以及按名称、按对象查索引
+
+#include "BenchUtil.hpp"
+#include "display/DisplayObjectContainer.hpp"
+#include "display/Stage.hpp"
+#include "events/Event.hpp"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace egret;
+
+namespace {
+
+    constexpr int kItemCount = 5000;
+    constexpr int kLookupsPerIter = 10000;
+
+    // 列表项：一个容器带两个子对象，模拟常见的“背景+图标”结构
+    struct Item {
+        std::unique_ptr<DisplayObjectContainer> root;
+        std::unique_ptr<DisplayObject> background;
+        std::unique_ptr<DisplayObject> icon;
+    };
+
+    std::vector<Item> makeItems(int count) {
+        std::vector<Item> items(count);
+        for (int i = 0; i < count; ++i) {
+            Item& item = items[i];
+            item.root = std::make_unique<DisplayObjectContainer>();
+            item.background = std::make_unique<DisplayObject>();
+            item.icon = std::make_unique<DisplayObject>();
+            item.root->setName("item" + std::to_string(i));
+            item.root->addChild(item.background.get());
+            item.root->addChild(item.icon.get());
+        }
+        return items;
+    }
+
+} // namespace
+
+int main() {
+    const int iterations = 20;
+    auto stage = std::make_shared<Stage>();
+    std::vector<Item> items = makeItems(kItemCount);
+    std::vector<DisplayObject*> batch;
+    for (auto& item : items) {
+        batch.push_back(item.root.get());
+    }
+
+    int addedToStage = 0;
+    for (auto& item : items) {
+        item.root->addEventListener(Event::ADDED_TO_STAGE, [&addedToStage](Event&) { ++addedToStage; },
+                                    nullptr, false, 0);
+    }
+
+    DisplayObjectContainer list;
+    stage->addChild(&list);
+
+    char name[96];
+    std::snprintf(name, sizeof(name), "addChild x%d on stage + removeChildren", kItemCount);
+    bench::report(name, bench::measureMicros(iterations, [&](int) {
+        for (DisplayObject* child : batch) {
+            list.addChild(child);
+        }
+        list.removeChildren();
+    }));
+
+    std::snprintf(name, sizeof(name), "addChildren(%d) on stage + removeChildren", kItemCount);
+    bench::report(name, bench::measureMicros(iterations, [&](int) {
+        list.addChildren(batch);
+        list.removeChildren();
+    }));
+
+    // 离屏构建好再整体挂上舞台：一次入舞台遍历整棵子树
+    stage->removeChild(&list);
+    list.addChildren(batch);
+    std::snprintf(name, sizeof(name), "attach/detach %d-item subtree", kItemCount);
+    bench::report(name, bench::measureMicros(iterations, [&](int) {
+        stage->addChild(&list);
+        stage->removeChild(&list);
+    }));
+
+    int found = 0;
+    bench::report("getChildByName x10000", bench::measureMicros(iterations, [&](int iter) {
+        for (int i = 0; i < kLookupsPerIter; ++i) {
+            const std::string& target = items[(i * 7919 + iter) % kItemCount].root->getName();
+            found += list.getChildByName(target) != nullptr;
+        }
+    }));
+    bench::report("getChildIndex x10000", bench::measureMicros(iterations, [&](int iter) {
+        for (int i = 0; i < kLookupsPerIter; ++i) {
+            found += list.getChildIndex(batch[(i * 7919 + iter) % kItemCount]) >= 0;
+        }
+    }));
+    bench::report("removeChild (front) x100", bench::measureMicros(iterations, [&](int) {
+        for (int i = 0; i < 100; ++i) {
+            list.addChild(list.removeChild(list.getChildAt(0)));
+        }
+    }));
+
+    list.removeChildren();
+    std::printf("(addedToStage %d, found %d)\n", addedToStage, found);
+    return 0;
+}
@@ -0,0 +1,142 @@
+// 事件派发基准：侦听器查找与派发开销，以及每个派发器对象的内存占用
+// 通过替换全局operator new统计堆分配字节数
+
+#include "BenchUtil.hpp"
+#include "display/DisplayObjectContainer.hpp"
+#include "events/Event.hpp"
+#include "events/EventDispatcher.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace {
+    size_t s_allocatedBytes = 0;
+    size_t s_allocationCount = 0;
+}
+
+void* operator new(std::size_t size) {
+    s_allocatedBytes += size;
+    ++s_allocationCount;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+using namespace egret;
+
+namespace {
+
+    constexpr int kDispatchesPerIter = 10000;
+    constexpr int kObjectCount = 10000;
+
+    // 统计fn执行期间的堆分配，换算为每个对象的字节数
+    template <typename Fn>
+    void reportMemory(const char* name, Fn&& fn) {
+        size_t bytesBefore = s_allocatedBytes;
+        size_t countBefore = s_allocationCount;
+        fn();
+        double bytes = static_cast<double>(s_allocatedBytes - bytesBefore) / kObjectCount;
+        double count = static_cast<double>(s_allocationCount - countBefore) / kObjectCount;
+        std::printf("%-48s %8.1f bytes/obj %6.2f allocs/obj\n", name, bytes, count);
+    }
+
+} // namespace
+
+int main() {
+    const int iterations = 50;
+    int calls = 0;
+    auto listener = [&calls](Event&) { ++calls; };
+
+    std::printf("sizeof(EventDispatcher) = %zu, sizeof(DisplayObject) = %zu\n",
+                sizeof(EventDispatcher), sizeof(DisplayObject));
+
+    // 内存：无侦听器 / 两种类型各一个侦听器
+    {
+        std::vector<std::unique_ptr<EventDispatcher>> dispatchers;
+        dispatchers.reserve(kObjectCount);
+        reportMemory("EventDispatcher, no listener", [&] {
+            for (int i = 0; i < kObjectCount; ++i) {
+                dispatchers.push_back(std::make_unique<EventDispatcher>());
+            }
+        });
+        reportMemory("  + CHANGE and COMPLETE listeners", [&] {
+            for (auto& dispatcher : dispatchers) {
+                dispatcher->addEventListener(Event::CHANGE, listener, nullptr, false, 0);
+                dispatcher->addEventListener(Event::COMPLETE, listener, nullptr, false, 0);
+            }
+        });
+    }
+
+    // 单个派发器，目标上只有一个侦听器
+    {
+        EventDispatcher dispatcher;
+        dispatcher.addEventListener(Event::CHANGE, listener, nullptr, false, 0);
+        dispatcher.addEventListener(Event::COMPLETE, listener, nullptr, false, 0);
+        dispatcher.addEventListener(Event::RESIZE, listener, nullptr, false, 0);
+        Event event(Event::CHANGE);
+        bench::report("EventDispatcher dispatchEvent x10000",
+                      bench::measureMicros(iterations, [&](int) {
+                          for (int i = 0; i < kDispatchesPerIter; ++i) {
+                              dispatcher.dispatchEvent(event);
+                          }
+                      }));
+        bench::report("EventDispatcher dispatchEventWith (miss) x10000",
+                      bench::measureMicros(iterations, [&](int) {
+                          for (int i = 0; i < kDispatchesPerIter; ++i) {
+                              dispatcher.dispatchEventWith(Event::CLOSE);
+                          }
+                      }));
+    }
+
+    // 8层显示对象链上的冒泡事件，每层都有侦听器
+    {
+        std::vector<std::unique_ptr<DisplayObjectContainer>> chain;
+        for (int i = 0; i < 8; ++i) {
+            chain.push_back(std::make_unique<DisplayObjectContainer>());
+            chain.back()->addEventListener(Event::CHANGE, listener, nullptr, false, 0);
+            if (i > 0) {
+                chain[i - 1]->addChild(chain[i].get());
+            }
+        }
+        Event event(Event::CHANGE, true);
+        bench::report("DisplayObject bubbling, depth 8 x10000",
+                      bench::measureMicros(iterations, [&](int) {
+                          for (int i = 0; i < kDispatchesPerIter; ++i) {
+                              chain.back()->dispatchEvent(event);
+                          }
+                      }));
+
+        // 100万次派发（非显示对象与显示对象各一半），统计期间的堆分配次数
+        EventDispatcher dispatcher;
+        dispatcher.addEventListener(Event::CHANGE, listener, nullptr, false, 0);
+        Event plain(Event::CHANGE);
+        size_t countBefore = s_allocationCount;
+        auto start = bench::Clock::now();
+        for (int i = 0; i < 500000; ++i) {
+            dispatcher.dispatchEvent(plain);
+            chain.back()->dispatchEvent(event);
+        }
+        double millis = std::chrono::duration<double, std::milli>(bench::Clock::now() - start).count();
+        std::printf("%-48s %12.2f ms, %zu allocs\n", "1M dispatches (plain + depth 8)", millis,
+                    s_allocationCount - countBefore);
+
+        for (int i = 7; i > 0; --i) {
+            chain[i - 1]->removeChild(chain[i].get());
+        }
+    }
+
+    std::printf("(calls %d)\n", calls);
+    return 0;
+}
@@ -0,0 +1,77 @@
+// 帧节奏基准：模拟每帧2~6ms的工作量，对比旧的毫秒级sleep与FramePacer在60/120/144fps下的帧时间抖动
+
+#include "BenchUtil.hpp"
+#include "player/FramePacer.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <thread>
+
+using namespace egret::sys;
+
+namespace {
+
+    constexpr int kFrames = 240;
+
+    void simulateWork(std::mt19937& rng) {
+        // 忙等模拟CPU工作，避免sleep本身的误差混入
+        std::uniform_int_distribution<int> micros(2000, 6000);
+        auto until = bench::Clock::now() + std::chrono::microseconds(micros(rng));
+        while (bench::Clock::now() < until) {
+        }
+    }
+
+    void printStats(const char* name, const FrameTimeStats& stats, double targetMs) {
+        std::printf("%-28s target %6.2f ms  mean %6.2f ms  stddev %5.2f ms  max %6.2f ms  missed %zu/%zu\n",
+                    name, targetMs, stats.meanMs, stats.stdDevMs, stats.maxMs, stats.missedFrames, stats.samples);
+    }
+
+    // 原主循环的做法：按整毫秒计算剩余时间并sleep
+    // 统计用的FramePacer设为垂直同步模式，只记录帧时间不等待
+    FrameTimeStats runLegacyLoop(int fps) {
+        std::mt19937 rng(1);
+        FramePacer meter;
+        meter.setTargetFrameRate(fps);
+        meter.setVSyncEnabled(true);
+        long long frameMs = 1000 / fps;
+        auto lastTime = std::chrono::high_resolution_clock::now();
+        meter.reset();
+        for (int i = 0; i < kFrames; ++i) {
+            simulateWork(rng);
+            auto delta = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::high_resolution_clock::now() - lastTime);
+            if (delta.count() < frameMs) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(frameMs - delta.count()));
+            }
+            lastTime = std::chrono::high_resolution_clock::now();
+            meter.waitForNextFrame();
+        }
+        return meter.getStats();
+    }
+
+    FrameTimeStats runPacedLoop(int fps) {
+        std::mt19937 rng(1);
+        FramePacer pacer;
+        pacer.setTargetFrameRate(fps);
+        pacer.reset();
+        for (int i = 0; i < kFrames; ++i) {
+            simulateWork(rng);
+            pacer.waitForNextFrame();
+        }
+        return pacer.getStats();
+    }
+
+} // namespace
+
+int main() {
+    char name[64];
+    for (int fps : {60, 120, 144}) {
+        double targetMs = 1000.0 / fps;
+        std::snprintf(name, sizeof(name), "legacy ms sleep @%d", fps);
+        printStats(name, runLegacyLoop(fps), targetMs);
+        std::snprintf(name, sizeof(name), "FramePacer @%d", fps);
+        printStats(name, runPacedLoop(fps), targetMs);
+    }
+    return 0;
+}
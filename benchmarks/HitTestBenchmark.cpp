@@ -0,0 +1,100 @@
+// 大量平铺子对象的命中测试基准：对比线性遍历与空间索引
+// 子对象为32x32的位图，随机散布在容器中，查询点随机分布
+
+#include "BenchUtil.hpp"
+#include "display/Bitmap.hpp"
+#include "display/DisplayObjectContainer.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+using namespace egret;
+
+namespace {
+
+    constexpr double kTileSize = 32.0;
+    constexpr int kQueriesPerFrame = 1000;
+
+    struct Scene {
+        std::unique_ptr<DisplayObjectContainer> root;
+        std::vector<std::unique_ptr<Bitmap>> tiles;
+        double extent = 0.0;
+    };
+
+    uint32_t s_seed = 0x13579BDFu;
+    uint32_t nextRandom() {
+        s_seed = s_seed * 1664525u + 1013904223u;
+        return s_seed >> 8;
+    }
+
+    double randomCoord(double extent) {
+        return (nextRandom() % 100000) / 100000.0 * extent;
+    }
+
+    // 子对象密度固定（平均每个位置约重叠2个），场景边长随数量增长
+    Scene buildScene(int count) {
+        Scene scene;
+        scene.root = std::make_unique<DisplayObjectContainer>();
+        scene.extent = std::sqrt(static_cast<double>(count) / 2.0) * kTileSize;
+        scene.tiles.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            auto tile = std::make_unique<Bitmap>(nullptr);
+            tile->setBitmapSize(kTileSize, kTileSize);
+            tile->setX(randomCoord(scene.extent));
+            tile->setY(randomCoord(scene.extent));
+            scene.root->addChild(tile.get());
+            scene.tiles.push_back(std::move(tile));
+        }
+        return scene;
+    }
+
+    void destroyScene(Scene& scene) {
+        scene.root->removeChildren();
+        scene.tiles.clear();
+    }
+
+} // namespace
+
+int main() {
+    const int frames = 20;
+    size_t hits = 0;
+
+    for (int count : {1000, 10000, 50000}) {
+        Scene scene = buildScene(count);
+        std::printf("children: %d\n", count);
+        char name[96];
+
+        auto queryFrame = [&](int) {
+            for (int q = 0; q < kQueriesPerFrame; ++q) {
+                if (scene.root->hitTest(randomCoord(scene.extent), randomCoord(scene.extent))) {
+                    ++hits;
+                }
+            }
+        };
+
+        // 线性遍历在大数量下很慢，减少迭代次数
+        int linearFrames = count > 10000 ? 2 : frames;
+        std::snprintf(name, sizeof(name), "  linear, %d queries", kQueriesPerFrame);
+        bench::report(name, bench::measureMicros(linearFrames, queryFrame, 1));
+
+        scene.root->setSpatialIndexEnabled(true, kTileSize * 2);
+        std::snprintf(name, sizeof(name), "  grid, %d queries", kQueriesPerFrame);
+        bench::report(name, bench::measureMicros(frames, queryFrame));
+
+        // 每帧移动1%的子对象，索引增量更新
+        std::snprintf(name, sizeof(name), "  grid, 1%% moved + %d queries", kQueriesPerFrame);
+        bench::report(name, bench::measureMicros(frames, [&](int frame) {
+            for (size_t i = frame % 100; i < scene.tiles.size(); i += 100) {
+                scene.tiles[i]->setX(randomCoord(scene.extent));
+            }
+            queryFrame(frame);
+        }));
+
+        destroyScene(scene);
+    }
+
+    std::printf("(hits %zu)\n", hits);
+    return 0;
+}
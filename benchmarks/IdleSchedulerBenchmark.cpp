@@ -0,0 +1,90 @@
+// 空闲调度基准：60fps、每帧2~6ms工作量下插入一批后台准备工作（300段，每段0.5ms）
+// 对比在某一帧里一次做完（callLater的做法）与交给空闲调度器只用每帧剩余时间
+
+#include "BenchUtil.hpp"
+#include "player/FramePacer.hpp"
+#include "player/IdleScheduler.hpp"
+
+#include <cstdio>
+#include <random>
+
+using namespace egret::sys;
+
+namespace {
+
+    constexpr int kFrames = 100;  // 不超过FramePacer统计窗口，尖峰计入统计
+    constexpr int kFrameRate = 60;
+    constexpr int kStartFrame = 10;
+    constexpr int kWorkUnits = 300;
+
+    void busyWait(std::chrono::microseconds duration) {
+        auto until = bench::Clock::now() + duration;
+        while (bench::Clock::now() < until) {
+        }
+    }
+
+    void simulateFrameWork(std::mt19937& rng) {
+        std::uniform_int_distribution<int> micros(2000, 6000);
+        busyWait(std::chrono::microseconds(micros(rng)));
+    }
+
+    void doWorkUnit() {
+        busyWait(std::chrono::microseconds(500));
+    }
+
+    void printResult(const char* name, const FrameTimeStats& stats, int completedFrame, double idleMs) {
+        std::printf("%-24s max %6.2f ms  stddev %5.2f ms  missed %zu/%zu  done at frame %d  idle used %.1f ms\n",
+                    name, stats.maxMs, stats.stdDevMs, stats.missedFrames, stats.samples, completedFrame, idleMs);
+    }
+
+} // namespace
+
+int main() {
+    // 一次做完
+    {
+        std::mt19937 rng(3);
+        FramePacer pacer;
+        pacer.setTargetFrameRate(kFrameRate);
+        pacer.reset();
+        for (int frame = 0; frame < kFrames; ++frame) {
+            simulateFrameWork(rng);
+            if (frame == kStartFrame) {
+                for (int i = 0; i < kWorkUnits; ++i) {
+                    doWorkUnit();
+                }
+            }
+            pacer.waitForNextFrame();
+        }
+        printResult("all at once", pacer.getStats(), kStartFrame, 0.0);
+    }
+
+    // 空闲调度
+    {
+        std::mt19937 rng(3);
+        FramePacer pacer;
+        IdleScheduler idle;
+        pacer.setTargetFrameRate(kFrameRate);
+        pacer.reset();
+        int remaining = kWorkUnits;
+        int completedFrame = -1;
+        for (int frame = 0; frame < kFrames; ++frame) {
+            simulateFrameWork(rng);
+            if (frame == kStartFrame) {
+                idle.post([&remaining](const IdleDeadline& deadline) {
+                    while (remaining > 0 && deadline.timeRemaining() >= 0.5) {
+                        doWorkUnit();
+                        --remaining;
+                    }
+                    return remaining == 0;
+                });
+            }
+            idle.run(pacer.getTimeUntilDeadline());
+            if (remaining == 0 && completedFrame < 0) {
+                completedFrame = frame;
+            }
+            pacer.waitForNextFrame();
+        }
+        printResult("idle scheduler", pacer.getStats(), completedFrame, idle.getTotalUsedMs());
+    }
+    return 0;
+}
@@ -0,0 +1,165 @@
+// 输入事件基准：向SDLEventConverter灌入合成的鼠标/按键事件，
+// 对比逐个派发与按帧合并移动的耗时，并统计稳定状态下（对象池预热后）的堆分配次数
+
+#include "BenchUtil.hpp"
+#include "display/Bitmap.hpp"
+#include "display/Stage.hpp"
+#include "events/EventPool.hpp"
+#include "events/KeyboardEvent.hpp"
+#include "events/TouchEvent.hpp"
+#include "platform/sdl/SDLEventConverter.hpp"
+#include "sys/TouchHandler.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace {
+    size_t s_allocationCount = 0;
+}
+
+void* operator new(std::size_t size) {
+    ++s_allocationCount;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+using namespace egret;
+
+namespace {
+
+    constexpr int kMovesPerDrag = 192;
+    constexpr int kMovesPerFrame = 16;  // 1000Hz鼠标在60fps下每帧约16次移动
+
+    SDL_Event mouseButton(uint32_t type, float x, float y) {
+        SDL_Event event;
+        std::memset(&event, 0, sizeof(event));
+        event.type = type;
+        event.button.button = SDL_BUTTON_LEFT;
+        event.button.x = x;
+        event.button.y = y;
+        return event;
+    }
+
+    SDL_Event mouseMotion(float x, float y) {
+        SDL_Event event;
+        std::memset(&event, 0, sizeof(event));
+        event.type = SDL_EVENT_MOUSE_MOTION;
+        event.motion.state = SDL_BUTTON_LMASK;
+        event.motion.x = x;
+        event.motion.y = y;
+        return event;
+    }
+
+    SDL_Event key(uint32_t type) {
+        SDL_Event event;
+        std::memset(&event, 0, sizeof(event));
+        event.type = type;
+        event.key.key = SDLK_A;
+        return event;
+    }
+
+} // namespace
+
+int main() {
+    auto stage = std::make_shared<Stage>();
+    std::vector<std::unique_ptr<Bitmap>> tiles;
+    for (int i = 0; i < 100; ++i) {
+        auto tile = std::make_unique<Bitmap>(nullptr);
+        tile->setBitmapSize(40, 40);
+        tile->setX((i % 10) * 48.0);
+        tile->setY((i / 10) * 48.0);
+        stage->addChild(tile.get());
+        tiles.push_back(std::move(tile));
+    }
+
+    int touches = 0;
+    int keys = 0;
+    size_t coalescedMoves = 0;
+    stage->addEventListener(TouchEvent::TOUCH_MOVE, [&](Event& event) {
+        ++touches;
+        coalescedMoves += static_cast<TouchEvent&>(event).getCoalescedCount();
+    }, nullptr, false, 0);
+    stage->addEventListener(KeyboardEvent::KEY_DOWN, [&keys](Event&) { ++keys; }, nullptr, false, 0);
+    int taps = 0;
+    int releaseOutside = 0;
+    stage->addEventListener(TouchEvent::TOUCH_TAP, [&taps](Event&) { ++taps; }, nullptr, false, 0);
+    stage->addEventListener(TouchEvent::TOUCH_RELEASE_OUTSIDE,
+                            [&releaseOutside](Event&) { ++releaseOutside; }, nullptr, false, 0);
+
+    platform::SDLEventConverter converter(stage);
+
+    // 一次拖动：按下、若干帧移动、抬起，再加一次按键
+    std::vector<SDL_Event> stream;
+    stream.push_back(mouseButton(SDL_EVENT_MOUSE_BUTTON_DOWN, 10, 10));
+    for (int i = 0; i < kMovesPerDrag; ++i) {
+        stream.push_back(mouseMotion(10.0f + i * 2.0f, 10.0f + i));
+    }
+    stream.push_back(mouseButton(SDL_EVENT_MOUSE_BUTTON_UP, 410, 210));
+    stream.push_back(key(SDL_EVENT_KEY_DOWN));
+    stream.push_back(key(SDL_EVENT_KEY_UP));
+
+    // 每kMovesPerFrame个事件模拟一帧结束，与主循环一样在轮询后flush
+    int passes = 0;
+    auto feed = [&](int) {
+        ++passes;
+        int pending = 0;
+        for (const SDL_Event& event : stream) {
+            converter.handleSDLEvent(event);
+            if (++pending == kMovesPerFrame) {
+                converter.flushPendingMoves();
+                pending = 0;
+            }
+        }
+        converter.flushPendingMoves();
+    };
+
+    char name[96];
+    for (bool coalesce : {false, true}) {
+        converter.setCoalescePointerMoves(coalesce);
+        feed(0);
+        touches = 0;
+        coalescedMoves = 0;
+        passes = 0;
+        size_t hitTestsBefore = stage->getTouchHandler()->getHitTestCount();
+        std::snprintf(name, sizeof(name), "drag of %d moves, %s", kMovesPerDrag,
+                      coalesce ? "coalesced per frame" : "per event");
+        bench::report(name, bench::measureMicros(200, feed));
+        std::printf("  TOUCH_MOVE dispatches per drag: %d (covering %zu moves)\n", touches / passes,
+                    coalescedMoves / passes);
+        std::printf("  hit tests per drag: %zu\n",
+                    (stage->getTouchHandler()->getHitTestCount() - hitTestsBefore) / passes);
+    }
+
+    // 预热完成后再统计分配次数（合并并记录历史）
+    converter.setKeepMoveHistory(true);
+    feed(0);
+    size_t before = s_allocationCount;
+    for (int i = 0; i < 100; ++i) {
+        feed(i);
+    }
+    std::printf("steady-state allocations over %zu input events: %zu\n",
+                stream.size() * 100, s_allocationCount - before);
+
+    EventPoolBase::logEventPoolStats();
+    const EventPoolStats& stats = TouchEvent::getPoolStats();
+    std::printf("TouchEvent pool: created=%zu reused=%zu released=%zu discarded=%zu pooled=%zu\n",
+                stats.created, stats.reused, stats.released, stats.discarded, stats.pooled);
+
+    stage->removeChildren();
+    std::printf("(keys %d, taps %d, release outside %d)\n", keys, taps, releaseOutside);
+    return 0;
+}
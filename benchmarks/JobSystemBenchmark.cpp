@@ -0,0 +1,99 @@
+// 任务系统基准：空任务的调度开销、依赖链、parallelFor相对串行循环的开销与加速
+
+#include "BenchUtil.hpp"
+#include "core/jobs/JobSystem.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace egret::sys;
+
+namespace {
+
+    constexpr int kEmptyJobs = 10000;
+    constexpr int kChainLength = 1000;
+    constexpr size_t kElements = 1 << 20;
+
+    // 模拟逐像素/逐顶点的轻量计算
+    inline float shade(size_t i) {
+        float x = static_cast<float>(i) * 0.001f;
+        return std::sqrt(x * x + 1.0f) * 0.5f;
+    }
+
+} // namespace
+
+int main() {
+    const int iterations = 20;
+    JobSystem& jobs = getJobSystem();
+    jobs.initialize();
+    std::printf("workers: %zu\n", jobs.getWorkerCount());
+
+    std::atomic<int> counter{0};
+    char name[96];
+
+    std::snprintf(name, sizeof(name), "schedule + wait %d empty jobs", kEmptyJobs);
+    double micros = bench::measureMicros(iterations, [&](int) {
+        std::vector<JobHandle> handles;
+        handles.reserve(kEmptyJobs);
+        for (int i = 0; i < kEmptyJobs; ++i) {
+            handles.push_back(jobs.schedule([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); }));
+        }
+        for (const auto& handle : handles) {
+            jobs.wait(handle);
+        }
+    });
+    bench::report(name, micros);
+    std::printf("%-48s %12.0f ns\n", "  per job", micros * 1000.0 / kEmptyJobs);
+
+    std::snprintf(name, sizeof(name), "dependency chain of %d jobs", kChainLength);
+    micros = bench::measureMicros(iterations, [&](int) {
+        JobHandle previous;
+        JobHandle first = jobs.createJob([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+        previous = first;
+        for (int i = 1; i < kChainLength; ++i) {
+            JobHandle job = jobs.createJob([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+            jobs.addDependency(job, previous);
+            jobs.submit(job);
+            previous = job;
+        }
+        jobs.submit(first);
+        jobs.wait(previous);
+    });
+    bench::report(name, micros);
+
+    std::vector<float> output(kElements);
+    std::snprintf(name, sizeof(name), "serial loop, %zu elements", kElements);
+    double serial = bench::measureMicros(iterations, [&](int) {
+        for (size_t i = 0; i < kElements; ++i) {
+            output[i] = shade(i);
+        }
+    });
+    bench::report(name, serial);
+
+    std::snprintf(name, sizeof(name), "parallelFor (auto grain), %zu elements", kElements);
+    double parallel = bench::measureMicros(iterations, [&](int) {
+        jobs.parallelFor(0, kElements, 0, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                output[i] = shade(i);
+            }
+        });
+    });
+    bench::report(name, parallel);
+
+    std::snprintf(name, sizeof(name), "parallelFor (grain 64), %zu elements", kElements);
+    bench::report(name, bench::measureMicros(iterations, [&](int) {
+        jobs.parallelFor(0, kElements, 64, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                output[i] = shade(i);
+            }
+        });
+    }));
+
+    JobSystemStats stats = jobs.getStats();
+    std::printf("(speedup %.2fx, executed %zu, stolen %zu, checksum %.1f, counter %d)\n",
+                serial / parallel, stats.executed, stats.stolen, output[kElements - 1], counter.load());
+    jobs.shutdown();
+    return 0;
+}
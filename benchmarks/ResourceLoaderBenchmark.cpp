@@ -0,0 +1,125 @@
+// 资源加载基准：48个JSON资源（每个约150KB）
+// 对比在主线程上逐个读取解析（此前的做法）与RES.loadGroup在任务线程上并行加载：
+// 总耗时，以及主线程单次被占用的最长时间（决定加载期间是否掉帧）
+
+#include "BenchUtil.hpp"
+#include "core/jobs/JobSystem.hpp"
+#include "extension/assetsmanager/JsonParser.hpp"
+#include "extension/assetsmanager/Processor.hpp"
+#include "extension/assetsmanager/Resource.hpp"
+#include "extension/assetsmanager/ResourceEvent.hpp"
+#include "utils/CallLater.hpp"
+
+#include <algorithm>
+#include <any>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    constexpr int kFiles = 48;
+    constexpr int kRecordsPerFile = 2000;
+
+    std::string createAssets(const std::filesystem::path& dir) {
+        std::filesystem::create_directories(dir / "assets");
+        std::string keys;
+        std::string resources;
+        for (int i = 0; i < kFiles; ++i) {
+            std::string name = "data" + std::to_string(i) + "_json";
+            std::ofstream file(dir / "assets" / ("data" + std::to_string(i) + ".json"));
+            file << "[";
+            for (int r = 0; r < kRecordsPerFile; ++r) {
+                file << (r ? "," : "") << "{\"id\":" << r << ",\"name\":\"item_" << r
+                     << "\",\"x\":" << r * 0.5 << ",\"tags\":[\"a\",\"b\"],\"visible\":true}";
+            }
+            file << "]";
+            keys += (i ? "," : "") + name;
+            resources += std::string(i ? "," : "") + "{\"name\":\"" + name + "\",\"type\":\"json\",\"url\":\"assets/data"
+                       + std::to_string(i) + ".json\"}";
+        }
+        std::ofstream config(dir / "default.res.json");
+        config << "{\"groups\":[{\"name\":\"level\",\"keys\":\"" << keys << "\"}],\"resources\":[" << resources << "]}";
+        return (dir / "default.res.json").string();
+    }
+
+    double elapsedMs(bench::Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(bench::Clock::now() - start).count();
+    }
+
+    /**
+     * 模拟主循环：每帧执行异步任务（完成回调在这里派发），记录主线程单帧最长占用
+     */
+    template<typename Done>
+    double runFrames(Done done, double& maxFrameMs) {
+        auto start = bench::Clock::now();
+        maxFrameMs = 0.0;
+        while (!done()) {
+            auto frame = bench::Clock::now();
+            egret::CallLaterSystem::executeAsyncs();
+            maxFrameMs = std::max(maxFrameMs, elapsedMs(frame));
+            std::this_thread::yield();
+        }
+        return elapsedMs(start);
+    }
+
+} // namespace
+
+int main() {
+    std::filesystem::path dir = std::filesystem::temp_directory_path() / "egret-res-bench";
+    std::string configPath = createAssets(dir);
+    std::string root = dir.string();
+
+    egret::sys::JobSystem& jobs = egret::sys::getJobSystem();
+    jobs.initialize();
+    std::printf("workers: %zu, %d json files\n", jobs.getWorkerCount(), kFiles);
+
+    // 主线程逐个加载：整段时间都阻塞在一帧里
+    {
+        auto start = bench::Clock::now();
+        size_t parsed = 0;
+        for (int i = 0; i < kFiles; ++i) {
+            std::vector<uint8_t> bytes;
+            std::any value;
+            RES::processor::readFile(root + "/assets/data" + std::to_string(i) + ".json", bytes);
+            if (RES::json::parse(std::string(bytes.begin(), bytes.end()), value)) {
+                ++parsed;
+            }
+        }
+        double total = elapsedMs(start);
+        std::printf("%-28s total %8.2f ms  longest main-thread block %8.2f ms  (%zu parsed)\n",
+                    "serial on main thread", total, total, parsed);
+    }
+
+    // RES并行加载
+    {
+        RES::Resource& res = RES::getInstance();
+        bool configDone = false;
+        bool groupDone = false;
+        res.addEventListener(RES::ResourceEvent::CONFIG_COMPLETE,
+                             [&configDone](egret::Event&) { configDone = true; }, nullptr, false, 0);
+        res.addEventListener(RES::ResourceEvent::GROUP_COMPLETE,
+                             [&groupDone](egret::Event&) { groupDone = true; }, nullptr, false, 0);
+        double maxFrame = 0.0;
+        res.loadConfig(configPath, root);
+        runFrames([&configDone] { return configDone; }, maxFrame);
+
+        for (size_t threads : {1, 4, 8}) {
+            groupDone = false;
+            res.setMaxLoadingThread(threads);
+            res.loadGroup("level");
+            double total = runFrames([&groupDone] { return groupDone; }, maxFrame);
+            char name[64];
+            std::snprintf(name, sizeof(name), "RES.loadGroup, %zu parallel", threads);
+            std::printf("%-28s total %8.2f ms  longest main-thread block %8.2f ms\n", name, total, maxFrame);
+            res.destroyRes("level");
+        }
+    }
+
+    jobs.shutdown();
+    std::filesystem::remove_all(dir);
+    return 0;
+}
@@ -0,0 +1,89 @@
+// 定时器基准：大量冷却计时器按60fps推进，对比逐帧扫描列表与分层时间轮
+
+#include "BenchUtil.hpp"
+#include "utils/TimerWheel.hpp"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace egret;
+
+namespace {
+
+    constexpr int kTimerCount = 10000;
+    constexpr int kFramesPerIter = 60;     // 每次迭代模拟1秒
+    constexpr int kFrameMs = 16;
+    constexpr int kRestartsPerFrame = 50;  // 每帧重置的冷却数量（技能释放、受击等）
+
+    long long randomCooldown(std::mt19937& rng) {
+        std::uniform_int_distribution<long long> ms(500, 30000);
+        return ms(rng);
+    }
+
+    // 常见写法：每个计时器记录到期时刻，每帧遍历整个列表
+    struct ScanTimers {
+        struct Entry {
+            long long expires;
+            bool active;
+        };
+        std::vector<Entry> entries;
+        long long now = 0;
+        long long fired = 0;
+
+        void advance(long long time) {
+            now = time;
+            for (auto& entry : entries) {
+                if (entry.active && entry.expires <= now) {
+                    entry.active = false;
+                    ++fired;
+                }
+            }
+        }
+    };
+
+} // namespace
+
+int main() {
+    const int iterations = 20;
+    std::mt19937 rng(7);
+
+    ScanTimers scan;
+    scan.entries.resize(kTimerCount);
+    for (auto& entry : scan.entries) {
+        entry = {randomCooldown(rng), true};
+    }
+    char name[96];
+    std::snprintf(name, sizeof(name), "list scan, %d timers, 1s @60fps", kTimerCount);
+    bench::report(name, bench::measureMicros(iterations, [&](int) {
+        for (int frame = 0; frame < kFramesPerIter; ++frame) {
+            for (int i = 0; i < kRestartsPerFrame; ++i) {
+                auto& entry = scan.entries[rng() % kTimerCount];
+                entry = {scan.now + randomCooldown(rng), true};
+            }
+            scan.advance(scan.now + kFrameMs);
+        }
+    }));
+
+    sys::TimerWheel wheel;
+    long long wheelFired = 0;
+    std::vector<TimerHandle> handles(kTimerCount);
+    auto onFire = [&wheelFired]() { ++wheelFired; };
+    for (auto& handle : handles) {
+        handle = wheel.schedule(randomCooldown(rng), onFire);
+    }
+    std::snprintf(name, sizeof(name), "timing wheel, %d timers, 1s @60fps", kTimerCount);
+    bench::report(name, bench::measureMicros(iterations, [&](int) {
+        for (int frame = 0; frame < kFramesPerIter; ++frame) {
+            for (int i = 0; i < kRestartsPerFrame; ++i) {
+                auto& handle = handles[rng() % kTimerCount];
+                wheel.cancel(handle);
+                handle = wheel.schedule(randomCooldown(rng), onFire);
+            }
+            wheel.advance(wheel.getCurrentTime() + kFrameMs);
+        }
+    }));
+
+    std::printf("(fired: scan %lld, wheel %lld, wheel active %zu)\n", scan.fired, wheelFired, wheel.getActiveCount());
+    return 0;
+}
@@ -0,0 +1,120 @@
+// 世界矩阵缓存基准：10层、约1万个节点的显示树
+// 对比逐级遍历父链的计算方式与按版本号缓存的getConcatenatedMatrix
+
+#include "BenchUtil.hpp"
+#include "display/Sprite.hpp"
+#include "geom/Matrix.hpp"
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+using namespace egret;
+
+namespace {
+
+    constexpr int kLevels = 10;
+    constexpr int kNodesPerLevel = 1111;   // 根节点 + 9层 * 1111 ≈ 1万个节点
+
+    struct Tree {
+        std::vector<std::unique_ptr<Sprite>> nodes;
+        std::vector<Sprite*> leaves;
+    };
+
+    Tree buildTree() {
+        Tree tree;
+        uint32_t seed = 0x2468ACE1u;
+        auto next = [&seed]() {
+            seed = seed * 1664525u + 1013904223u;
+            return seed >> 8;
+        };
+
+        tree.nodes.push_back(std::make_unique<Sprite>());
+        std::vector<Sprite*> previous{tree.nodes.back().get()};
+        for (int level = 1; level < kLevels; ++level) {
+            std::vector<Sprite*> current;
+            current.reserve(kNodesPerLevel);
+            for (int i = 0; i < kNodesPerLevel; ++i) {
+                auto node = std::make_unique<Sprite>();
+                node->setX(static_cast<double>(next() % 100));
+                node->setY(static_cast<double>(next() % 100));
+                node->setScaleX(0.9 + (next() % 20) / 100.0);
+                node->setRotation(static_cast<double>(next() % 360));
+                previous[next() % previous.size()]->addChild(node.get());
+                current.push_back(node.get());
+                tree.nodes.push_back(std::move(node));
+            }
+            previous = std::move(current);
+        }
+        tree.leaves = previous;
+        return tree;
+    }
+
+    // 缓存引入前的做法：每次都从自身走到根节点
+    Matrix walkParentChain(DisplayObject* object) {
+        Matrix result = object->getMatrix();
+        for (DisplayObject* current = object->getParent(); current; current = current->getParent()) {
+            result.prependMatrix(current->getMatrix());
+        }
+        return result;
+    }
+
+} // namespace
+
+int main() {
+    Tree tree = buildTree();
+    std::printf("nodes: %zu, levels: %d\n", tree.nodes.size(), kLevels);
+
+    const int frames = 50;
+    double sink = 0.0;
+
+    bench::report("walk parent chain (all nodes)", bench::measureMicros(frames, [&](int) {
+        for (auto& node : tree.nodes) {
+            sink += walkParentChain(node.get()).tx;
+        }
+    }));
+
+    bench::report("cached world matrix, static tree", bench::measureMicros(frames, [&](int) {
+        for (auto& node : tree.nodes) {
+            sink += node->getConcatenatedMatrix()->tx;
+        }
+    }));
+
+    bench::report("cached inverse, static tree", bench::measureMicros(frames, [&](int) {
+        for (auto& node : tree.nodes) {
+            sink += node->getInvertedConcatenatedMatrix()->tx;
+        }
+    }));
+
+    bench::report("cached, root moved every frame", bench::measureMicros(frames, [&](int frame) {
+        tree.nodes.front()->setX(static_cast<double>(frame));
+        for (auto& node : tree.nodes) {
+            sink += node->getConcatenatedMatrix()->tx;
+        }
+    }));
+
+    bench::report("cached, 1% leaves moved every frame", bench::measureMicros(frames, [&](int frame) {
+        for (size_t i = 0; i < tree.leaves.size(); i += 100) {
+            tree.leaves[i]->setX(static_cast<double>(frame));
+        }
+        for (auto& node : tree.nodes) {
+            sink += node->getConcatenatedMatrix()->tx;
+        }
+    }));
+
+    bench::report("localToGlobal on leaves, static tree", bench::measureMicros(frames, [&](int) {
+        for (Sprite* leaf : tree.leaves) {
+            sink += leaf->localToGlobal(1.0, 1.0).getX();
+        }
+    }));
+
+    // 子节点指针由tree.nodes持有，先断开父子关系再销毁
+    for (auto it = tree.nodes.rbegin(); it != tree.nodes.rend(); ++it) {
+        if (auto* parent = (*it)->getParent()) {
+            parent->removeChild(it->get());
+        }
+    }
+
+    std::printf("(checksum %.1f)\n", sink);
+    return 0;
+}
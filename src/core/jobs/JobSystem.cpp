@@ -0,0 +1,439 @@
+#include "core/jobs/JobSystem.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+#include <exception>
+
+namespace egret {
+namespace sys {
+
+    /**
+     * 任务：pending为尚未满足的依赖数加1（提交前的占位），减到0时进入队列
+     */
+    class Job {
+    public:
+        explicit Job(std::function<void()> work) : work(std::move(work)) {}
+
+        std::function<void()> work;
+        std::atomic<int> pending{1};
+        std::atomic<bool> done{false};
+
+        // 以下由mutex保护：完成后不再接受新的后续任务
+        std::mutex mutex;
+        bool finished = false;
+        std::vector<JobHandle> dependents;
+        std::vector<CallLaterSystem::AsyncTask*> continuations;
+
+        // 提交后到完成前持有自身，队列中只保存裸指针
+        JobHandle self;
+    };
+
+    namespace {
+        // 当前线程在哪个任务系统中的工作线程下标，非工作线程为-1
+        thread_local const JobSystem* t_workerOwner = nullptr;
+        thread_local int t_workerIndex = -1;
+
+        // 没有工作线程时，当前线程上同步执行期间就绪的后续任务
+        thread_local std::deque<Job*>* t_inlineJobs = nullptr;
+    }
+
+    JobSystem::~JobSystem() {
+        shutdown();
+    }
+
+    // ========== 启动与停止 ==========
+
+    void JobSystem::initialize(int threadCount) {
+        std::lock_guard<std::mutex> lock(m_lifecycleMutex);
+        if (m_initialized.load(std::memory_order_acquire)) {
+            if (threadCount >= 0 && static_cast<size_t>(threadCount) != m_workers.size()) {
+                EGRET_DEBUGF("任务系统已启动(workers={})，忽略线程数{}", m_workers.size(), threadCount);
+            }
+            return;
+        }
+        if (threadCount < 0) {
+            unsigned int cores = std::thread::hardware_concurrency();
+            threadCount = cores > 1 ? static_cast<int>(cores) - 1 : 1;
+        }
+        m_running = true;
+        m_workers.reserve(static_cast<size_t>(threadCount));
+        for (int i = 0; i < threadCount; ++i) {
+            m_workers.push_back(std::make_unique<Worker>());
+        }
+        // 全部Worker就绪后再启动线程，窃取时遍历m_workers不会与扩容冲突
+        for (int i = 0; i < threadCount; ++i) {
+            m_workers[i]->thread = std::thread(&JobSystem::workerLoop, this, i);
+        }
+        m_initialized.store(true, std::memory_order_release);
+        EGRET_INFOF("任务系统启动: workers={}", threadCount);
+    }
+
+    void JobSystem::shutdown() {
+        std::lock_guard<std::mutex> lock(m_lifecycleMutex);
+        if (!m_initialized.load(std::memory_order_acquire)) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> sleepLock(m_sleepMutex);
+            m_running = false;
+        }
+        m_sleepCondition.notify_all();
+        // 工作线程在队列清空后退出
+        for (auto& worker : m_workers) {
+            if (worker->thread.joinable()) {
+                worker->thread.join();
+            }
+        }
+        m_workers.clear();
+        cancelWaitingJobs();
+        m_initialized.store(false, std::memory_order_release);
+    }
+
+    void JobSystem::ensureInitialized() {
+        if (!m_initialized.load(std::memory_order_acquire)) {
+            initialize();
+        }
+    }
+
+    void JobSystem::cancelWaitingJobs() {
+        std::vector<JobHandle> cancelled;
+        {
+            std::lock_guard<std::mutex> lock(m_waitingMutex);
+            cancelled.reserve(m_waitingJobs.size());
+            for (Job* job : m_waitingJobs) {
+                cancelled.push_back(std::move(job->self));
+            }
+            m_waitingJobs.clear();
+        }
+        if (cancelled.empty()) {
+            return;
+        }
+        EGRET_WARNF("任务系统停止时取消了{}个等待依赖的任务", cancelled.size());
+        // 等待中的任务互相之间以及与自身的引用都在这里断开，捕获的闭包随任务一起释放
+        for (const auto& job : cancelled) {
+            std::vector<JobHandle> dependents;
+            std::vector<CallLaterSystem::AsyncTask*> continuations;
+            {
+                std::lock_guard<std::mutex> lock(job->mutex);
+                job->finished = true;
+                dependents.swap(job->dependents);
+                continuations.swap(job->continuations);
+            }
+            job->work = nullptr;
+            job->done.store(true, std::memory_order_release);
+            for (auto* task : continuations) {
+                delete task;
+            }
+        }
+    }
+
+    // ========== 任务 ==========
+
+    JobHandle JobSystem::createJob(std::function<void()> work) {
+        return std::make_shared<Job>(std::move(work));
+    }
+
+    void JobSystem::addDependency(const JobHandle& job, const JobHandle& dependency) {
+        if (!job || !dependency || job == dependency) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(dependency->mutex);
+        if (dependency->finished) {
+            return;
+        }
+        job->pending.fetch_add(1, std::memory_order_relaxed);
+        dependency->dependents.push_back(job);
+    }
+
+    void JobSystem::submit(const JobHandle& job) {
+        if (!job || job->self) {
+            return;
+        }
+        ensureInitialized();
+        job->self = job;
+        // 依赖只能在提交前添加，此时pending大于1说明还有未完成的依赖；先登记再递减，依赖完成时一定能找到它
+        bool waiting = job->pending.load(std::memory_order_acquire) > 1;
+        if (waiting) {
+            std::lock_guard<std::mutex> lock(m_waitingMutex);
+            m_waitingJobs.insert(job.get());
+        }
+        if (job->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            if (waiting) {
+                std::lock_guard<std::mutex> lock(m_waitingMutex);
+                m_waitingJobs.erase(job.get());
+            }
+            enqueue(job.get());
+        }
+    }
+
+    JobHandle JobSystem::schedule(std::function<void()> work, std::initializer_list<JobHandle> dependencies) {
+        JobHandle job = createJob(std::move(work));
+        for (const auto& dependency : dependencies) {
+            addDependency(job, dependency);
+        }
+        submit(job);
+        return job;
+    }
+
+    bool JobSystem::isDone(const JobHandle& job) {
+        return !job || job->done.load(std::memory_order_acquire);
+    }
+
+    void JobSystem::wait(const JobHandle& job) {
+        while (!isDone(job)) {
+            if (!runOne()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void JobSystem::addMainThreadContinuation(const JobHandle& job, CallLaterSystem::AsyncTask* task) {
+        if (job) {
+            std::lock_guard<std::mutex> lock(job->mutex);
+            if (!job->finished) {
+                job->continuations.push_back(task);
+                return;
+            }
+        }
+        CallLaterSystem::detail::pushAsync(task);
+    }
+
+    // ========== 数据并行 ==========
+
+    void JobSystem::parallelFor(size_t begin, size_t end, size_t grain,
+                                const std::function<void(size_t, size_t)>& body) {
+        if (end <= begin || !body) {
+            return;
+        }
+        ensureInitialized();
+        size_t count = end - begin;
+        size_t workers = m_workers.size();
+        if (grain == 0) {
+            // 每个线程约4块，兼顾负载均衡与调度开销
+            grain = std::max<size_t>(1, count / ((workers + 1) * 4));
+        }
+        size_t blocks = (count + grain - 1) / grain;
+        if (workers == 0 || blocks == 1) {
+            for (size_t start = begin; start < end; start += grain) {
+                body(start, std::min(end, start + grain));
+            }
+            return;
+        }
+
+        // 块按原子计数领取；状态由辅助任务共享持有，它们可能在本函数返回后才发现已无块可领
+        struct State {
+            std::atomic<size_t> next{0};
+            std::atomic<size_t> completed{0};
+        };
+        auto state = std::make_shared<State>();
+        auto runBlocks = [state, &body, begin, end, grain, blocks]() {
+            for (;;) {
+                size_t block = state->next.fetch_add(1, std::memory_order_relaxed);
+                if (block >= blocks) {
+                    return;
+                }
+                size_t start = begin + block * grain;
+                try {
+                    body(start, std::min(end, start + grain));
+                }
+                catch (const std::exception& e) {
+                    EGRET_ERRORF("parallelFor执行出错: {}", e.what());
+                }
+                state->completed.fetch_add(1, std::memory_order_release);
+            }
+        };
+
+        size_t helpers = std::min(workers, blocks - 1);
+        for (size_t i = 0; i < helpers; ++i) {
+            schedule(runBlocks);
+        }
+        runBlocks();
+        while (state->completed.load(std::memory_order_acquire) < blocks) {
+            if (!runOne()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    JobSystemStats JobSystem::getStats() const {
+        JobSystemStats stats;
+        stats.workerCount = m_workers.size();
+        stats.executed = m_executedCount.load(std::memory_order_relaxed);
+        stats.stolen = m_stolenCount.load(std::memory_order_relaxed);
+        stats.queued = m_queuedCount.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    // ========== 调度 ==========
+
+    void JobSystem::enqueue(Job* job) {
+        if (m_workers.empty()) {
+            // 没有工作线程：在提交线程上同步执行
+            runInline(job);
+            return;
+        }
+        // 先计数再入队：被唤醒的线程最多空转一次，不会错过任务
+        m_queuedCount.fetch_add(1);
+        if (t_workerOwner == this) {
+            Worker& worker = *m_workers[t_workerIndex];
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.deque.push_back(job);
+        } else {
+            std::lock_guard<std::mutex> lock(m_globalMutex);
+            m_globalQueue.push_back(job);
+        }
+        if (m_sleepingCount.load() > 0) {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_sleepCondition.notify_one();
+        }
+    }
+
+    void JobSystem::runInline(Job* job) {
+        if (t_inlineJobs) {
+            // 同步执行的任务中又提交了任务：立即执行，它完成后就绪的后续任务加入外层的工作列表
+            execute(job);
+            return;
+        }
+        // 完成后就绪的后续任务放入工作列表循环执行而不是递归，依赖链很长时也不会栈溢出
+        std::deque<Job*> jobs;
+        struct Scope {
+            explicit Scope(std::deque<Job*>* jobs) { t_inlineJobs = jobs; }
+            ~Scope() { t_inlineJobs = nullptr; }
+        } scope(&jobs);
+        execute(job);
+        while (!jobs.empty()) {
+            Job* next = jobs.front();
+            jobs.pop_front();
+            execute(next);
+        }
+    }
+
+    Job* JobSystem::take(int workerIndex) {
+        Job* job = nullptr;
+        if (workerIndex >= 0) {
+            Worker& worker = *m_workers[workerIndex];
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            if (!worker.deque.empty()) {
+                job = worker.deque.back();
+                worker.deque.pop_back();
+            }
+        }
+        if (!job) {
+            std::lock_guard<std::mutex> lock(m_globalMutex);
+            if (!m_globalQueue.empty()) {
+                job = m_globalQueue.front();
+                m_globalQueue.pop_front();
+            }
+        }
+        if (!job) {
+            size_t count = m_workers.size();
+            size_t start = workerIndex >= 0 ? static_cast<size_t>(workerIndex) + 1 : 0;
+            for (size_t i = 0; i < count && !job; ++i) {
+                size_t victim = (start + i) % count;
+                if (static_cast<int>(victim) == workerIndex) {
+                    continue;
+                }
+                Worker& worker = *m_workers[victim];
+                std::lock_guard<std::mutex> lock(worker.mutex);
+                if (!worker.deque.empty()) {
+                    job = worker.deque.front();
+                    worker.deque.pop_front();
+                    m_stolenCount.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+        if (job) {
+            m_queuedCount.fetch_sub(1);
+        }
+        return job;
+    }
+
+    void JobSystem::execute(Job* job) {
+        try {
+            if (job->work) {
+                job->work();
+            }
+        }
+        catch (const std::exception& e) {
+            EGRET_ERRORF("任务执行出错: {}", e.what());
+        }
+        m_executedCount.fetch_add(1, std::memory_order_relaxed);
+        finish(job);
+    }
+
+    void JobSystem::finish(Job* job) {
+        // 释放自引用前先持有，保证本函数内job有效
+        JobHandle keepAlive = std::move(job->self);
+        job->work = nullptr;
+
+        std::vector<JobHandle> dependents;
+        std::vector<CallLaterSystem::AsyncTask*> continuations;
+        {
+            std::lock_guard<std::mutex> lock(job->mutex);
+            job->finished = true;
+            dependents.swap(job->dependents);
+            continuations.swap(job->continuations);
+        }
+        job->done.store(true, std::memory_order_release);
+
+        for (const auto& dependent : dependents) {
+            if (dependent->pending.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                continue;
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_waitingMutex);
+                m_waitingJobs.erase(dependent.get());
+            }
+            if (t_inlineJobs) {
+                t_inlineJobs->push_back(dependent.get());
+            } else {
+                enqueue(dependent.get());
+            }
+        }
+        for (auto* task : continuations) {
+            CallLaterSystem::detail::pushAsync(task);
+        }
+    }
+
+    bool JobSystem::runOne() {
+        Job* job = take(t_workerOwner == this ? t_workerIndex : -1);
+        if (!job && t_inlineJobs && !t_inlineJobs->empty()) {
+            // 同步执行的任务中等待后续任务：从工作列表中取
+            job = t_inlineJobs->front();
+            t_inlineJobs->pop_front();
+        }
+        if (!job) {
+            return false;
+        }
+        execute(job);
+        return true;
+    }
+
+    void JobSystem::workerLoop(int workerIndex) {
+        t_workerOwner = this;
+        t_workerIndex = workerIndex;
+        for (;;) {
+            if (Job* job = take(workerIndex)) {
+                execute(job);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_sleepingCount.fetch_add(1);
+            m_sleepCondition.wait(lock, [this]() {
+                return !m_running.load() || m_queuedCount.load() > 0;
+            });
+            m_sleepingCount.fetch_sub(1);
+            if (!m_running.load() && m_queuedCount.load() == 0) {
+                break;
+            }
+        }
+        t_workerOwner = nullptr;
+        t_workerIndex = -1;
+    }
+
+    JobSystem& getJobSystem() {
+        static JobSystem instance;
+        return instance;
+    }
+
+} // namespace sys
+} // namespace egret
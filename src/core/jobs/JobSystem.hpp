@@ -0,0 +1,193 @@
+#pragma once
+
+#include "utils/CallLater.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace egret {
+namespace sys {
+
+    /**
+     * 任务对象（不透明），通过JobHandle引用
+     */
+    class Job;
+    using JobHandle = std::shared_ptr<Job>;
+
+    /**
+     * 任务系统统计
+     */
+    struct JobSystemStats {
+        size_t workerCount = 0;     // 工作线程数量
+        size_t executed = 0;        // 已执行的任务数
+        size_t stolen = 0;          // 从其他线程窃取的任务数
+        size_t queued = 0;          // 当前排队等待执行的任务数
+    };
+
+    /**
+     * 引擎共享的工作窃取任务系统
+     * 每个工作线程有自己的双端队列：本线程产生的任务压入队尾并从队尾取（LIFO，缓存友好），
+     * 空闲线程从其他线程的队首窃取（FIFO，取到较大的任务块）；非工作线程提交的任务进入全局队列
+     * 任务可以声明依赖，依赖全部完成后才进入队列；完成后可在主线程执行后续回调（通过CallLaterSystem::callAsync）
+     * 等待任务或parallelFor的线程会一起执行队列中的任务，不会空等，嵌套使用不会死锁
+     * 引擎内所有并行功能（图片解码、路径构建、文字排版、光栅化、资源加载等）都应使用这里的线程，不要自行创建线程
+     */
+    class JobSystem {
+    public:
+        JobSystem() = default;
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        /**
+         * 启动工作线程；已启动时不做任何事，线程数由第一次调用（或首次提交任务时的自动启动）决定
+         * 需要改变线程数时先调用shutdown
+         * @param threadCount 工作线程数；小于0表示按CPU核心数自动选择（核心数-1，至少1），0表示不启动线程，任务在提交线程上同步执行
+         */
+        void initialize(int threadCount = -1);
+
+        /**
+         * 执行完已进入队列的任务后停止所有工作线程
+         * 仍在等待依赖的任务（依赖从未提交或永远不会完成）被取消：任务函数与主线程回调不再执行，直接释放
+         * 必须在所有提交任务的线程（包括主线程上的parallelFor/wait）停止之后调用，不能与submit/schedule并发
+         */
+        void shutdown();
+
+        /**
+         * 是否已启动（initialize之前首次提交任务会按默认线程数自动启动）
+         */
+        bool isInitialized() const { return m_initialized.load(); }
+
+        /**
+         * 工作线程数量
+         */
+        size_t getWorkerCount() const { return m_workers.size(); }
+
+        // ========== 任务 ==========
+
+        /**
+         * 创建任务但不提交，可先用addDependency声明依赖
+         */
+        JobHandle createJob(std::function<void()> work);
+
+        /**
+         * 声明job在dependency完成后才能执行；必须在submit(job)之前调用
+         */
+        void addDependency(const JobHandle& job, const JobHandle& dependency);
+
+        /**
+         * 提交任务；依赖尚未完成时等依赖完成后自动进入队列
+         */
+        void submit(const JobHandle& job);
+
+        /**
+         * 创建并提交任务
+         * @param work 任务函数
+         * @param dependencies 依赖的任务
+         */
+        JobHandle schedule(std::function<void()> work, std::initializer_list<JobHandle> dependencies = {});
+
+        /**
+         * 任务是否已执行完
+         */
+        static bool isDone(const JobHandle& job);
+
+        /**
+         * 等待任务完成；等待期间当前线程会执行队列中的其他任务
+         */
+        void wait(const JobHandle& job);
+
+        /**
+         * 任务完成后在主线程执行回调（下一次SystemTicker::update），可调用对象只需可移动
+         * 任务已完成时直接投递
+         */
+        template<typename F>
+        void runOnMainThread(const JobHandle& job, F&& func) {
+            using Task = CallLaterSystem::detail::AsyncTaskImpl<std::decay_t<F>>;
+            addMainThreadContinuation(job, new Task(std::decay_t<F>(std::forward<F>(func))));
+        }
+
+        // ========== 数据并行 ==========
+
+        /**
+         * 把[begin, end)切成大小为grain的块并行执行body(blockBegin, blockEnd)，返回时全部完成
+         * 调用线程也参与执行；块按原子计数动态领取，负载不均时自动平衡
+         * @param grain 每块的元素数，0表示按线程数自动切分
+         */
+        void parallelFor(size_t begin, size_t end, size_t grain,
+                         const std::function<void(size_t, size_t)>& body);
+
+        /**
+         * 统计信息
+         */
+        JobSystemStats getStats() const;
+
+    private:
+        struct Worker {
+            std::mutex mutex;
+            std::deque<Job*> deque;
+            std::thread thread;
+        };
+
+        void ensureInitialized();
+        void cancelWaitingJobs();
+        void addMainThreadContinuation(const JobHandle& job, CallLaterSystem::AsyncTask* task);
+
+        /**
+         * 依赖已满足的任务放入队列：工作线程放本地队尾，其他线程放全局队列
+         */
+        void enqueue(Job* job);
+
+        /**
+         * 没有工作线程时在当前线程上执行任务，完成后就绪的后续任务用工作列表依次执行
+         */
+        void runInline(Job* job);
+
+        /**
+         * 取一个任务：本地队尾 -> 全局队列 -> 窃取其他线程的队首
+         */
+        Job* take(int workerIndex);
+        void execute(Job* job);
+        void finish(Job* job);
+        bool runOne();
+        void workerLoop(int workerIndex);
+
+        // 启动与停止互斥；m_workers只在持有此锁时修改，启动后到停止前不变，调度路径无锁读取
+        std::mutex m_lifecycleMutex;
+        std::vector<std::unique_ptr<Worker>> m_workers;
+
+        // 已提交但仍在等待依赖的任务，停止时取消
+        std::mutex m_waitingMutex;
+        std::unordered_set<Job*> m_waitingJobs;
+        std::mutex m_globalMutex;
+        std::deque<Job*> m_globalQueue;
+
+        std::mutex m_sleepMutex;
+        std::condition_variable m_sleepCondition;
+        std::atomic<size_t> m_queuedCount{0};
+        std::atomic<int> m_sleepingCount{0};
+        std::atomic<bool> m_running{false};
+        std::atomic<bool> m_initialized{false};
+
+        std::atomic<size_t> m_executedCount{0};
+        std::atomic<size_t> m_stolenCount{0};
+    };
+
+    /**
+     * 获取全局任务系统
+     */
+    JobSystem& getJobSystem();
+
+} // namespace sys
+} // namespace egret
@@ -39,6 +39,8 @@ namespace egret
         , m_explicitBitmapHeight(std::numeric_limits<double>::quiet_NaN())
         , m_scale9Grid(nullptr)
     {
+        setDisplayObjectType(DisplayObjectType::BITMAP);
+        
         // 创建NormalBitmapNode渲染节点
         setRenderNode(std::make_shared<sys::NormalBitmapNode>());
         
@@ -114,6 +116,66 @@ namespace egret
         return getBounds();
     }
     
+    void Bitmap::measureContentBounds(Rectangle& bounds)
+    {
+        double width = !std::isnan(m_explicitBitmapWidth) ? m_explicitBitmapWidth : m_textureWidth;
+        double height = !std::isnan(m_explicitBitmapHeight) ? m_explicitBitmapHeight : m_textureHeight;
+        bounds.setTo(0, 0, width, height);
+    }
+    
+    bool Bitmap::hitTestPoint(double x, double y, bool shapeFlag)
+    {
+        if (!shapeFlag) {
+            return DisplayObject::hitTestPoint(x, y, shapeFlag);
+        }
+        Point local = globalToLocal(x, y);
+        double localX = local.getX() + getAnchorOffsetX();
+        double localY = local.getY() + getAnchorOffsetY();
+        Rectangle bounds;
+        measureContentBounds(bounds);
+        return bounds.contains(localX, localY) && hitTestPixel(localX, localY);
+    }
+    
+    bool Bitmap::hitTestContent(double localX, double localY)
+    {
+        if (!DisplayObject::hitTestContent(localX, localY)) {
+            return false;
+        }
+        return !m_pixelHitTest || hitTestPixel(localX, localY);
+    }
+    
+    bool Bitmap::hitTestPixel(double localX, double localY)
+    {
+        if (!m_bitmapData || m_scale9Grid) {
+            return true;
+        }
+        if (m_textureWidth <= 0 || m_textureHeight <= 0) {
+            return false;
+        }
+        
+        // 与BitmapNode::updateTextureData的SCALE模式一致：
+        // 纹理区域绘制在 (tsX * offsetX, tsY * offsetY)，尺寸为 (tsX * bitmapWidth, tsY * bitmapHeight)
+        double destW = !std::isnan(m_explicitBitmapWidth) ? m_explicitBitmapWidth : m_textureWidth;
+        double destH = !std::isnan(m_explicitBitmapHeight) ? m_explicitBitmapHeight : m_textureHeight;
+        double tsX = destW / m_textureWidth * TextureScaleFactor;
+        double tsY = destH / m_textureHeight * TextureScaleFactor;
+        if (tsX == 0.0 || tsY == 0.0) {
+            return false;
+        }
+        double u = localX / tsX - m_offsetX;
+        double v = localY / tsY - m_offsetY;
+        if (u < 0.0 || v < 0.0 || u >= m_bitmapWidth || v >= m_bitmapHeight) {
+            // 纹理裁掉的透明边
+            return false;
+        }
+        
+        auto mask = m_bitmapData->getAlphaMask(m_pixelHitTestThreshold);
+        if (!mask) {
+            return true;
+        }
+        return mask->test(static_cast<int>(m_bitmapX + u), static_cast<int>(m_bitmapY + v));
+    }
+    
     // ========== 受保护的DisplayObject虚函数重写 ==========
     
     void Bitmap::onAddToStage(Stage* stage, int nestLevel)
@@ -281,6 +343,7 @@ namespace egret
     void Bitmap::markRenderDirty()
     {
         setRenderDirty(true);
+        invalidateSubtreeBounds();
         
         // 标记父级缓存脏标记
         auto parent = getParent();
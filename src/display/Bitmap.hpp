@@ -128,6 +128,26 @@ namespace egret
          */
         void setBitmapSize(double width, double height);
         
+        /**
+         * 是否开启逐像素触摸检测：开启后透明像素不响应触摸
+         * 使用位图共享的1位Alpha掩码，每次检测为O(1)查表
+         * @version Egret 5.0
+         * @platform Web,Native
+         */
+        bool getPixelHitTest() const { return m_pixelHitTest; }
+        void setPixelHitTest(bool value) { m_pixelHitTest = value; }
+        
+        /**
+         * 逐像素检测的Alpha阈值，Alpha大于该值的像素视为命中（默认0）
+         */
+        uint8_t getPixelHitTestThreshold() const { return m_pixelHitTestThreshold; }
+        void setPixelHitTestThreshold(uint8_t value) { m_pixelHitTestThreshold = value; }
+        
+        /**
+         * 点碰撞检测，shapeFlag为true时按像素Alpha检测
+         */
+        bool hitTestPoint(double x, double y, bool shapeFlag = false) override;
+        
         // ========== DisplayObject虚函数重写 ==========
         
         /**
@@ -189,6 +209,16 @@ namespace egret
          */
         virtual void measure() override;
         
+        /**
+         * 测量内容边界（显式尺寸优先，否则为纹理尺寸）
+         */
+        void measureContentBounds(Rectangle& bounds) override;
+        
+        /**
+         * 内容碰撞检测：开启pixelHitTest时在边界测试后再按像素Alpha检测
+         */
+        bool hitTestContent(double localX, double localY) override;
+        
     private:
         // ========== 私有成员变量 ==========
         
@@ -209,6 +239,8 @@ namespace egret
         double m_explicitBitmapWidth;                    // 明确的位图宽度
         double m_explicitBitmapHeight;                   // 明确的位图高度
         std::shared_ptr<Rectangle> m_scale9Grid;         // 九宫格缩放区域
+        bool m_pixelHitTest = false;                     // 逐像素触摸检测
+        uint8_t m_pixelHitTestThreshold = 0;             // 逐像素检测的Alpha阈值
         
         // ========== 私有辅助方法 ==========
         
@@ -223,6 +255,12 @@ namespace egret
          * 标记渲染脏标记并更新父级
          */
         void markRenderDirty();
+        
+        /**
+         * 本地坐标处的纹理像素是否不透明
+         * 九宫格位图与没有CPU侧像素的位图无法逐像素映射，视为命中
+         */
+        bool hitTestPixel(double localX, double localY);
     };
     
 } // namespace egret
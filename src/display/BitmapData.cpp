@@ -5,14 +5,22 @@
 #include "BitmapData.hpp"
 #include "DisplayObject.hpp"
 #include "player/SystemRenderer.hpp"
+#include "player/RenderBuffer.hpp"
 #include "geom/Rectangle.hpp"
+#include "geom/Point.hpp"
+#include "geom/Matrix.hpp"
+#include "geom/ColorTransform.hpp"
+#include "sys/PixelOps.hpp"
+#include "utils/Logger.hpp"
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <sstream>
 #include <iomanip>
 #include <set>
 #include <map>
 #include <memory>
+#include <atomic>
 
 namespace egret
 {
@@ -29,6 +37,44 @@ namespace egret
     
     static std::map<std::shared_ptr<BitmapData>, std::set<std::weak_ptr<DisplayObject>, WeakPtrCompare>> s_bitmapDataDisplayObjects;
     
+    // ========== 行遍历辅助 ==========
+    
+    /**
+     * 按行遍历源/目标区域，对每一行调用 fn(dstRow, srcRow, width)
+     * readSourceRow(y, scratch) 返回源图像第y行的ARGB8888像素（紧凑格式解码到scratch）
+     * 源与目标为同一位图时：向下复制自底向上遍历，并先把源行拷到临时缓冲，避免读到已写入的像素
+     */
+    template<typename SourceRowFn, typename RowFn>
+    static void forEachCopyRow(SourceRowFn&& readSourceRow, bool sameBitmap, int srcY,
+                               uint32_t* dstBase, int dstStride, int dstX, int dstY,
+                               int width, int height, RowFn&& fn)
+    {
+        bool bottomUp = sameBitmap && dstY > srcY;
+        std::vector<uint32_t> rowBuffer(static_cast<size_t>(width));
+        for (int i = 0; i < height; ++i) {
+            int row = bottomUp ? height - 1 - i : i;
+            const uint32_t* src = readSourceRow(srcY + row, rowBuffer.data());
+            uint32_t* dst = dstBase + static_cast<size_t>(dstY + row) * dstStride + dstX;
+            if (sameBitmap && src != rowBuffer.data()) {
+                sys::PixelOps::copyRow(rowBuffer.data(), src, width);
+                src = rowBuffer.data();
+            }
+            fn(dst, src, width);
+        }
+    }
+    
+    // 各像素格式的全局内存统计；位图、掩码与渲染器副本可能在非主线程上创建或释放，计数器使用原子变量
+    struct AtomicTextureMemoryStats
+    {
+        std::atomic<size_t> bytes[static_cast<int>(BitmapPixelFormat::COUNT)]{};
+        std::atomic<size_t> count[static_cast<int>(BitmapPixelFormat::COUNT)]{};
+        std::atomic<size_t> alphaMaskBytes{0};
+        std::atomic<size_t> alphaMaskCount{0};
+        std::atomic<size_t> rendererCopyBytes{0};
+        std::atomic<size_t> rendererCopyCount{0};
+    };
+    static AtomicTextureMemoryStats s_textureMemoryStats;
+    
     // ========== 构造函数 ==========
     BitmapData::BitmapData(void* data)
         : HashObject()
@@ -54,47 +100,45 @@ namespace egret
     
     uint32_t BitmapData::getPixel(int x, int y) const
     {
-        if (!isValidCoordinate(x, y) || !m_pixelData) {
-            return 0;
-        }
-        
-        uint32_t pixel = m_pixelData[y * m_width + x];
-        return pixel & 0x00FFFFFF; // 移除Alpha通道
+        return getPixel32(x, y) & 0x00FFFFFF; // 移除Alpha通道
     }
     
     uint32_t BitmapData::getPixel32(int x, int y) const
     {
-        if (!isValidCoordinate(x, y) || !m_pixelData) {
+        if (!isValidCoordinate(x, y)) {
             return 0;
         }
         
-        return m_pixelData[y * m_width + x];
+        uint32_t scratch = 0;
+        return *readRow(x, y, 1, &scratch);
     }
     
     void BitmapData::setPixel(int x, int y, uint32_t color)
     {
-        if (!isValidCoordinate(x, y) || !m_pixelData) {
+        if (!isValidCoordinate(x, y) || !prepareForWrite()) {
             return;
         }
         
         uint32_t& pixel = m_pixelData[y * m_width + x];
         pixel = (pixel & 0xFF000000) | (color & 0x00FFFFFF); // 保持Alpha，更新RGB
+        markDirty(x, y, 1, 1);
     }
     
     void BitmapData::setPixel32(int x, int y, uint32_t color)
     {
-        if (!isValidCoordinate(x, y) || !m_pixelData) {
+        if (!isValidCoordinate(x, y) || !prepareForWrite()) {
             return;
         }
         
         m_pixelData[y * m_width + x] = color;
+        markDirty(x, y, 1, 1);
     }
     
     std::vector<uint32_t> BitmapData::getPixels(int x, int y, int width, int height) const
     {
         std::vector<uint32_t> pixels;
         
-        if (!m_pixelData) {
+        if (!m_pixelData && !m_compactPixels) {
             return pixels;
         }
         
@@ -110,12 +154,13 @@ namespace egret
         
         int actualWidth = endX - startX;
         int actualHeight = endY - startY;
-        pixels.reserve(actualWidth * actualHeight);
+        pixels.resize(static_cast<size_t>(actualWidth) * actualHeight);
         
-        for (int row = startY; row < endY; ++row) {
-            for (int col = startX; col < endX; ++col) {
-                pixels.push_back(m_pixelData[row * m_width + col]);
-            }
+        // 按行整段复制（紧凑格式直接解码到输出）
+        for (int row = 0; row < actualHeight; ++row) {
+            uint32_t* dst = pixels.data() + static_cast<size_t>(row) * actualWidth;
+            const uint32_t* src = readRow(startX, startY + row, actualWidth, dst);
+            sys::PixelOps::copyRow(dst, src, actualWidth);
         }
         
         return pixels;
@@ -123,7 +168,7 @@ namespace egret
     
     void BitmapData::setPixels(int x, int y, int width, int height, const std::vector<uint32_t>& pixels)
     {
-        if (!m_pixelData || pixels.empty()) {
+        if (pixels.empty() || width <= 0 || !prepareForWrite()) {
             return;
         }
         
@@ -137,15 +182,21 @@ namespace egret
             return;
         }
         
+        // pixels按 width 行宽排列，裁剪掉的部分需要跳过
         int actualWidth = endX - startX;
-        int actualHeight = endY - startY;
-        
-        size_t pixelIndex = 0;
-        for (int row = startY; row < endY && pixelIndex < pixels.size(); ++row) {
-            for (int col = startX; col < endX && pixelIndex < pixels.size(); ++col) {
-                m_pixelData[row * m_width + col] = pixels[pixelIndex++];
+        int lastRow = startY;
+        for (int row = startY; row < endY; ++row) {
+            size_t srcOffset = static_cast<size_t>(row - y) * width + (startX - x);
+            if (srcOffset >= pixels.size()) {
+                break;
             }
+            int count = static_cast<int>(std::min<size_t>(actualWidth, pixels.size() - srcOffset));
+            sys::PixelOps::copyRow(m_pixelData.get() + static_cast<size_t>(row) * m_width + startX,
+                                   pixels.data() + srcOffset, count);
+            lastRow = row + 1;
         }
+        
+        markDirty(startX, startY, actualWidth, lastRow - startY);
     }
     
     std::string BitmapData::toDataURL(const std::string& type, double encoderOptions) const
@@ -164,7 +215,7 @@ namespace egret
     
     std::shared_ptr<BitmapData> BitmapData::crop(std::shared_ptr<Rectangle> rect) const
     {
-        if (!rect || !m_pixelData) {
+        if (!rect || (!m_pixelData && !m_compactPixels)) {
             return nullptr;
         }
         
@@ -185,12 +236,11 @@ namespace egret
         
         auto croppedData = create(cropWidth, cropHeight, true, 0);
         
-        // 复制像素数据
+        // 按行复制像素数据
         for (int y = 0; y < cropHeight; ++y) {
-            for (int x = 0; x < cropWidth; ++x) {
-                uint32_t pixel = getPixel32(cropX + x, cropY + y);
-                croppedData->setPixel32(x, y, pixel);
-            }
+            uint32_t* dst = croppedData->m_pixelData.get() + static_cast<size_t>(y) * cropWidth;
+            const uint32_t* src = readRow(cropX, cropY + y, cropWidth, dst);
+            sys::PixelOps::copyRow(dst, src, cropWidth);
         }
         
         return croppedData;
@@ -198,34 +248,54 @@ namespace egret
     
     void BitmapData::copyPixels(std::shared_ptr<BitmapData> sourceBitmapData,
                                std::shared_ptr<Rectangle> sourceRect,
-                               std::shared_ptr<Rectangle> destPoint) const
+                               std::shared_ptr<Rectangle> destPoint,
+                               bool mergeAlpha) const
     {
         if (!sourceBitmapData || !sourceRect || !destPoint) {
             return;
         }
         
-        int srcX = static_cast<int>(sourceRect->getX());
-        int srcY = static_cast<int>(sourceRect->getY());
-        int srcWidth = static_cast<int>(sourceRect->getWidth());
-        int srcHeight = static_cast<int>(sourceRect->getHeight());
-        int destX = static_cast<int>(destPoint->getX());
-        int destY = static_cast<int>(destPoint->getY());
-        
-        // 复制像素
-        for (int y = 0; y < srcHeight; ++y) {
-            for (int x = 0; x < srcWidth; ++x) {
-                if (sourceBitmapData->isValidCoordinate(srcX + x, srcY + y) &&
-                    isValidCoordinate(destX + x, destY + y)) {
-                    uint32_t pixel = sourceBitmapData->getPixel32(srcX + x, srcY + y);
-                    const_cast<BitmapData*>(this)->setPixel32(destX + x, destY + y, pixel);
-                }
+        // copyPixels在Egret API中声明为const，但会修改目标像素
+        BitmapData* target = const_cast<BitmapData*>(this);
+        if (!target->prepareForWrite()) {
+            return;
+        }
+        CopyRegion region;
+        if (!target->clipCopyRegion(*sourceBitmapData, *sourceRect, destPoint->getX(), destPoint->getY(), region)) {
+            return;
+        }
+        
+        const BitmapData& source = *sourceBitmapData;
+        auto readSourceRow = [&source, &region](int y, uint32_t* scratch) {
+            return source.readRow(region.srcX, y, region.width, scratch);
+        };
+        
+        if (mergeAlpha) {
+            forEachCopyRow(readSourceRow, &source == this, region.srcY,
+                           target->m_pixelData.get(), m_width, region.destX, region.destY,
+                           region.width, region.height,
+                           [](uint32_t* dst, const uint32_t* src, int count) {
+                               sys::PixelOps::blendRow(dst, src, count);
+                           });
+        } else {
+            // 整行memmove本身允许重叠，只需保证行的遍历顺序
+            bool bottomUp = &source == this && region.destY > region.srcY;
+            std::vector<uint32_t> scratch(source.m_pixelData ? 0 : static_cast<size_t>(region.width));
+            for (int i = 0; i < region.height; ++i) {
+                int row = bottomUp ? region.height - 1 - i : i;
+                sys::PixelOps::copyRow(
+                    target->m_pixelData.get() + static_cast<size_t>(region.destY + row) * m_width + region.destX,
+                    readSourceRow(region.srcY + row, scratch.data()),
+                    region.width);
             }
         }
+        
+        target->markDirty(region.destX, region.destY, region.width, region.height);
     }
     
     void BitmapData::fillRect(std::shared_ptr<Rectangle> rect, uint32_t color)
     {
-        if (!rect || !m_pixelData) {
+        if (!rect || !prepareForWrite()) {
             return;
         }
         
@@ -239,12 +309,208 @@ namespace egret
         int startY = std::max(0, fillY);
         int endX = std::min(m_width, fillX + fillWidth);
         int endY = std::min(m_height, fillY + fillHeight);
+        if (startX >= endX || startY >= endY) {
+            return;
+        }
         
-        for (int y = startY; y < endY; ++y) {
-            for (int x = startX; x < endX; ++x) {
-                setPixel32(x, y, color);
+        if (startX == 0 && endX == m_width) {
+            // 整行填充时区域在内存中连续
+            sys::PixelOps::fillRow(m_pixelData.get() + static_cast<size_t>(startY) * m_width,
+                                   (endY - startY) * m_width, color);
+        } else {
+            for (int y = startY; y < endY; ++y) {
+                sys::PixelOps::fillRow(m_pixelData.get() + static_cast<size_t>(y) * m_width + startX,
+                                       endX - startX, color);
             }
         }
+        
+        markDirty(startX, startY, endX - startX, endY - startY);
+    }
+    
+    void BitmapData::merge(std::shared_ptr<BitmapData> sourceBitmapData,
+                           std::shared_ptr<Rectangle> sourceRect,
+                           std::shared_ptr<Point> destPoint,
+                           uint32_t redMultiplier, uint32_t greenMultiplier,
+                           uint32_t blueMultiplier, uint32_t alphaMultiplier)
+    {
+        if (!sourceBitmapData || !sourceRect || !destPoint || !prepareForWrite()) {
+            return;
+        }
+        
+        CopyRegion region;
+        if (!clipCopyRegion(*sourceBitmapData, *sourceRect, destPoint->getX(), destPoint->getY(), region)) {
+            return;
+        }
+        
+        const uint32_t multipliers[4] = {redMultiplier, greenMultiplier, blueMultiplier, alphaMultiplier};
+        const BitmapData& source = *sourceBitmapData;
+        forEachCopyRow([&source, &region](int y, uint32_t* scratch) {
+                           return source.readRow(region.srcX, y, region.width, scratch);
+                       }, &source == this, region.srcY,
+                       m_pixelData.get(), m_width, region.destX, region.destY,
+                       region.width, region.height,
+                       [&multipliers](uint32_t* dst, const uint32_t* src, int count) {
+                           sys::PixelOps::mergeRow(dst, src, count, multipliers);
+                       });
+        
+        markDirty(region.destX, region.destY, region.width, region.height);
+    }
+    
+    int BitmapData::threshold(std::shared_ptr<BitmapData> sourceBitmapData,
+                              std::shared_ptr<Rectangle> sourceRect,
+                              std::shared_ptr<Point> destPoint,
+                              const std::string& operation, uint32_t threshold,
+                              uint32_t color, uint32_t mask, bool copySource)
+    {
+        if (!sourceBitmapData || !sourceRect || !destPoint || !prepareForWrite()) {
+            return 0;
+        }
+        
+        sys::PixelOps::ThresholdOp op;
+        if (!sys::PixelOps::parseThresholdOp(operation.c_str(), op)) {
+            return 0;
+        }
+        
+        CopyRegion region;
+        if (!clipCopyRegion(*sourceBitmapData, *sourceRect, destPoint->getX(), destPoint->getY(), region)) {
+            return 0;
+        }
+        
+        int hits = 0;
+        const BitmapData& source = *sourceBitmapData;
+        forEachCopyRow([&source, &region](int y, uint32_t* scratch) {
+                           return source.readRow(region.srcX, y, region.width, scratch);
+                       }, &source == this, region.srcY,
+                       m_pixelData.get(), m_width, region.destX, region.destY,
+                       region.width, region.height,
+                       [&](uint32_t* dst, const uint32_t* src, int count) {
+                           hits += sys::PixelOps::thresholdRow(dst, src, count, op, threshold, color, mask, copySource);
+                       });
+        
+        markDirty(region.destX, region.destY, region.width, region.height);
+        return hits;
+    }
+    
+    void BitmapData::colorTransform(std::shared_ptr<Rectangle> rect, const ColorTransform& colorTransform)
+    {
+        if (!rect || colorTransform.isIdentity() || !prepareForWrite()) {
+            return;
+        }
+        
+        int startX = std::max(0, static_cast<int>(rect->getX()));
+        int startY = std::max(0, static_cast<int>(rect->getY()));
+        int endX = std::min(m_width, static_cast<int>(rect->getX() + rect->getWidth()));
+        int endY = std::min(m_height, static_cast<int>(rect->getY() + rect->getHeight()));
+        if (startX >= endX || startY >= endY) {
+            return;
+        }
+        
+        sys::PixelOps::ColorTransformTable table;
+        sys::PixelOps::buildColorTransformTable(colorTransform, table);
+        for (int y = startY; y < endY; ++y) {
+            sys::PixelOps::colorTransformRow(m_pixelData.get() + static_cast<size_t>(y) * m_width + startX,
+                                             endX - startX, table);
+        }
+        
+        markDirty(startX, startY, endX - startX, endY - startY);
+    }
+    
+    bool BitmapData::draw(DisplayObject* source, const Matrix& matrix, std::shared_ptr<Rectangle> clipRect)
+    {
+        if (!source || m_disposed || !sys::systemRenderer || !prepareForWrite()) {
+            return false;
+        }
+        
+        int left = 0;
+        int top = 0;
+        int right = m_width;
+        int bottom = m_height;
+        if (clipRect) {
+            left = std::max(left, static_cast<int>(std::floor(clipRect->getX())));
+            top = std::max(top, static_cast<int>(std::floor(clipRect->getY())));
+            right = std::min(right, static_cast<int>(std::ceil(clipRect->getX() + clipRect->getWidth())));
+            bottom = std::min(bottom, static_cast<int>(std::ceil(clipRect->getY() + clipRect->getHeight())));
+        }
+        if (left >= right || top >= bottom) {
+            return false;
+        }
+        
+        const int width = right - left;
+        const int height = bottom - top;
+        uint32_t* origin = m_pixelData.get() + static_cast<size_t>(top) * m_width + left;
+        
+        // Skia在预乘格式上绘制：在单独的预乘副本上绘制，
+        // 结束后只把被改动的像素还原写回，未绘制到的半透明像素不经过预乘往返，保持原值
+        std::vector<uint32_t> scratch(static_cast<size_t>(width) * height);
+        for (int y = 0; y < height; ++y) {
+            uint32_t* row = scratch.data() + static_cast<size_t>(y) * width;
+            sys::PixelOps::copyRow(row, origin + static_cast<size_t>(y) * m_width, width);
+            sys::PixelOps::premultiplyRow(row, width);
+        }
+        
+        auto buffer = sys::createRenderBufferForPixels(scratch.data(), width, height, static_cast<size_t>(width) * sizeof(uint32_t));
+        if (!buffer) {
+            return false;
+        }
+        
+        Matrix drawMatrix(matrix);
+        if (left != 0 || top != 0) {
+            drawMatrix.translate(-left, -top);
+        }
+        sys::systemRenderer->render(source, buffer.get(), drawMatrix, true);
+        buffer.reset();
+        
+        for (int y = 0; y < height; ++y) {
+            sys::PixelOps::storeChangedPremultipliedRow(origin + static_cast<size_t>(y) * m_width,
+                                                        scratch.data() + static_cast<size_t>(y) * width, width);
+        }
+        
+        markDirty(left, top, width, height);
+        return true;
+    }
+    
+    bool BitmapData::draw(DisplayObject* source)
+    {
+        return draw(source, Matrix());
+    }
+    
+    void BitmapData::setRenderBufferSource(std::shared_ptr<sys::RenderBuffer> buffer)
+    {
+        if (m_renderBufferSource != buffer) {
+            deallocatePixelData();
+            m_renderBufferSource = std::move(buffer);
+        }
+        m_width = m_renderBufferSource ? static_cast<int>(m_renderBufferSource->getWidth()) : 0;
+        m_height = m_renderBufferSource ? static_cast<int>(m_renderBufferSource->getHeight()) : 0;
+        markAllDirty();
+    }
+    
+    void BitmapData::markDirty(int x, int y, int width, int height)
+    {
+        // 裁剪到位图范围
+        int left = std::max(0, x);
+        int top = std::max(0, y);
+        int right = std::min(m_width, x + width);
+        int bottom = std::min(m_height, y + height);
+        if (left >= right || top >= bottom) {
+            return;
+        }
+        
+        if (m_dirtyRegion.isEmpty()) {
+            m_dirtyRegion = PixelRegion{left, top, right, bottom};
+        } else {
+            m_dirtyRegion.left = std::min(m_dirtyRegion.left, left);
+            m_dirtyRegion.top = std::min(m_dirtyRegion.top, top);
+            m_dirtyRegion.right = std::max(m_dirtyRegion.right, right);
+            m_dirtyRegion.bottom = std::max(m_dirtyRegion.bottom, bottom);
+        }
+        ++m_version;
+    }
+    
+    void BitmapData::clearDirtyRegion()
+    {
+        m_dirtyRegion = PixelRegion{};
+        m_dirtyBaseVersion = m_version;
     }
     
     void BitmapData::dispose()
@@ -253,17 +519,27 @@ namespace egret
             return;
         }
         
-        // 从管理器中移除
-        auto it = s_bitmapDataDisplayObjects.find(shared_from_this());
-        if (it != s_bitmapDataDisplayObjects.end()) {
-            s_bitmapDataDisplayObjects.erase(it);
+        // 从管理器中移除（析构过程中weak_from_this已失效，此时也不可能仍在管理器中）
+        if (auto self = weak_from_this().lock()) {
+            auto it = s_bitmapDataDisplayObjects.find(self);
+            if (it != s_bitmapDataDisplayObjects.end()) {
+                s_bitmapDataDisplayObjects.erase(it);
+            }
+        }
+        
+        // 渲染器以指针为键缓存像素副本，释放前必须失效
+        if (sys::systemRenderer) {
+            sys::systemRenderer->invalidateBitmapData(this);
         }
         
         // 释放像素数据
         deallocatePixelData();
+        m_renderBufferSource.reset();
+        m_alphaMasks.clear();
         
         m_width = 0;
         m_height = 0;
+        m_dirtyRegion = PixelRegion{};
         m_disposed = true;
     }
     
@@ -379,18 +655,309 @@ namespace egret
         return x >= 0 && x < m_width && y >= 0 && y < m_height;
     }
     
+    bool BitmapData::clipCopyRegion(const BitmapData& source, const Rectangle& sourceRect,
+                                    double destX, double destY, CopyRegion& region) const
+    {
+        if (!m_pixelData || (!source.m_pixelData && !source.m_compactPixels)) {
+            return false;
+        }
+        
+        int srcX = static_cast<int>(sourceRect.getX());
+        int srcY = static_cast<int>(sourceRect.getY());
+        int width = static_cast<int>(sourceRect.getWidth());
+        int height = static_cast<int>(sourceRect.getHeight());
+        int dstX = static_cast<int>(destX);
+        int dstY = static_cast<int>(destY);
+        
+        // 先按源图像裁剪，再按目标图像裁剪，两侧偏移同步移动
+        int shift = std::max({0, -srcX, -dstX});
+        srcX += shift; dstX += shift; width -= shift;
+        shift = std::max({0, -srcY, -dstY});
+        srcY += shift; dstY += shift; height -= shift;
+        width = std::min({width, source.m_width - srcX, m_width - dstX});
+        height = std::min({height, source.m_height - srcY, m_height - dstY});
+        if (width <= 0 || height <= 0) {
+            return false;
+        }
+        
+        region = CopyRegion{srcX, srcY, dstX, dstY, width, height};
+        return true;
+    }
+    
     // ========== 私有辅助方法实现 ==========
     
+    const uint32_t* BitmapData::readRow(int x, int y, int count, uint32_t* scratch) const
+    {
+        const size_t offset = static_cast<size_t>(y) * m_width + x;
+        if (m_pixelFormat == BitmapPixelFormat::ARGB8888 && m_pixelData) {
+            return m_pixelData.get() + offset;
+        }
+        if (!m_compactPixels) {
+            std::fill_n(scratch, count, 0u);
+            return scratch;
+        }
+        
+        const uint8_t* base = m_compactPixels->data();
+        switch (m_pixelFormat) {
+            case BitmapPixelFormat::RGB565:
+                sys::PixelOps::unpackRGB565Row(scratch, reinterpret_cast<const uint16_t*>(base) + offset, count);
+                break;
+            case BitmapPixelFormat::ARGB4444:
+                sys::PixelOps::unpackARGB4444Row(scratch, reinterpret_cast<const uint16_t*>(base) + offset, count);
+                break;
+            case BitmapPixelFormat::A8:
+                sys::PixelOps::unpackA8Row(scratch, base + offset, count);
+                break;
+            default:
+                std::fill_n(scratch, count, 0u);
+                break;
+        }
+        return scratch;
+    }
+    
+    bool BitmapData::prepareForWrite()
+    {
+        if (m_pixelFormat != BitmapPixelFormat::ARGB8888 && m_compactPixels) {
+            auto pixels = std::make_unique<uint32_t[]>(static_cast<size_t>(m_width) * m_height);
+            for (int y = 0; y < m_height; ++y) {
+                uint32_t* dst = pixels.get() + static_cast<size_t>(y) * m_width;
+                readRow(0, y, m_width, dst);
+            }
+            m_compactPixels.reset();
+            m_pixelData = std::move(pixels);
+            m_pixelFormat = BitmapPixelFormat::ARGB8888;
+            updateStorageStats();
+        }
+        return m_pixelData != nullptr;
+    }
+    
+    bool BitmapData::setPixelFormat(BitmapPixelFormat format)
+    {
+        if (format == BitmapPixelFormat::COUNT) {
+            return false;
+        }
+        if (format == m_pixelFormat) {
+            return m_pixelData || m_compactPixels;
+        }
+        if (!prepareForWrite()) {
+            return false;
+        }
+        if (format == BitmapPixelFormat::ARGB8888) {
+            return true;
+        }
+        
+        const size_t pixelCount = static_cast<size_t>(m_width) * m_height;
+        auto compact = std::make_shared<std::vector<uint8_t>>(pixelCount * getBytesPerPixel(format));
+        for (int y = 0; y < m_height; ++y) {
+            const uint32_t* src = m_pixelData.get() + static_cast<size_t>(y) * m_width;
+            const size_t offset = static_cast<size_t>(y) * m_width;
+            switch (format) {
+                case BitmapPixelFormat::RGB565:
+                    sys::PixelOps::packRGB565Row(reinterpret_cast<uint16_t*>(compact->data()) + offset, src, m_width);
+                    break;
+                case BitmapPixelFormat::ARGB4444:
+                    sys::PixelOps::packARGB4444Row(reinterpret_cast<uint16_t*>(compact->data()) + offset, src, m_width);
+                    break;
+                case BitmapPixelFormat::A8:
+                    sys::PixelOps::packA8Row(compact->data() + offset, src, m_width);
+                    break;
+                default:
+                    break;
+            }
+        }
+        
+        m_pixelData.reset();
+        m_compactPixels = std::move(compact);
+        m_pixelFormat = format;
+        updateStorageStats();
+        
+        // 有损转换改变了像素内容，渲染器需要按新格式重建SkImage
+        markAllDirty();
+        return true;
+    }
+    
+    BitmapPixelFormat BitmapData::suggestPixelFormat() const
+    {
+        if (!m_pixelData) {
+            return m_pixelFormat;
+        }
+        
+        bool opaque = true;
+        bool whiteOnly = true;
+        const size_t pixelCount = static_cast<size_t>(m_width) * m_height;
+        for (size_t i = 0; i < pixelCount && (opaque || whiteOnly); ++i) {
+            uint32_t pixel = m_pixelData[i];
+            uint32_t alpha = pixel >> 24;
+            opaque = opaque && alpha == 255;
+            whiteOnly = whiteOnly && (alpha == 0 || (pixel & 0x00FFFFFF) == 0x00FFFFFF);
+        }
+        
+        if (opaque) {
+            return BitmapPixelFormat::RGB565;
+        }
+        if (whiteOnly) {
+            return BitmapPixelFormat::A8;
+        }
+        return BitmapPixelFormat::ARGB8888;
+    }
+    
+    const char* BitmapData::getPixelFormatName(BitmapPixelFormat format)
+    {
+        switch (format) {
+            case BitmapPixelFormat::ARGB8888: return "ARGB8888";
+            case BitmapPixelFormat::RGB565:   return "RGB565";
+            case BitmapPixelFormat::ARGB4444: return "ARGB4444";
+            case BitmapPixelFormat::A8:       return "A8";
+            default:                          return "unknown";
+        }
+    }
+    
+    int BitmapData::getBytesPerPixel(BitmapPixelFormat format)
+    {
+        switch (format) {
+            case BitmapPixelFormat::ARGB8888: return 4;
+            case BitmapPixelFormat::RGB565:
+            case BitmapPixelFormat::ARGB4444: return 2;
+            case BitmapPixelFormat::A8:       return 1;
+            default:                          return 0;
+        }
+    }
+    
+    TextureMemoryStats BitmapData::getTextureMemoryStats()
+    {
+        // 各计数器分别读取，并发更新时快照内的数值之间不保证一致
+        TextureMemoryStats stats;
+        for (int i = 0; i < static_cast<int>(BitmapPixelFormat::COUNT); ++i) {
+            stats.bytes[i] = s_textureMemoryStats.bytes[i].load(std::memory_order_relaxed);
+            stats.count[i] = s_textureMemoryStats.count[i].load(std::memory_order_relaxed);
+        }
+        stats.alphaMaskBytes = s_textureMemoryStats.alphaMaskBytes.load(std::memory_order_relaxed);
+        stats.alphaMaskCount = s_textureMemoryStats.alphaMaskCount.load(std::memory_order_relaxed);
+        stats.rendererCopyBytes = s_textureMemoryStats.rendererCopyBytes.load(std::memory_order_relaxed);
+        stats.rendererCopyCount = s_textureMemoryStats.rendererCopyCount.load(std::memory_order_relaxed);
+        return stats;
+    }
+    
+    void BitmapData::addRendererCopyStats(size_t bytes)
+    {
+        s_textureMemoryStats.rendererCopyBytes.fetch_add(bytes, std::memory_order_relaxed);
+        s_textureMemoryStats.rendererCopyCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    void BitmapData::removeRendererCopyStats(size_t bytes)
+    {
+        s_textureMemoryStats.rendererCopyBytes.fetch_sub(bytes, std::memory_order_relaxed);
+        s_textureMemoryStats.rendererCopyCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+    
+    void BitmapData::logTextureMemoryStats()
+    {
+        const TextureMemoryStats stats = getTextureMemoryStats();
+        EGRET_INFOF("Texture memory: {} bytes total", stats.getTotalBytes());
+        for (int i = 0; i < static_cast<int>(BitmapPixelFormat::COUNT); ++i) {
+            if (stats.count[i] > 0) {
+                EGRET_INFOF("  {}: {} bitmaps, {} bytes",
+                            getPixelFormatName(static_cast<BitmapPixelFormat>(i)), stats.count[i], stats.bytes[i]);
+            }
+        }
+        if (stats.alphaMaskCount > 0) {
+            EGRET_INFOF("  alpha masks: {} masks, {} bytes", stats.alphaMaskCount, stats.alphaMaskBytes);
+        }
+        if (stats.rendererCopyCount > 0) {
+            EGRET_INFOF("  renderer copies: {} images, {} bytes", stats.rendererCopyCount, stats.rendererCopyBytes);
+        }
+    }
+    
+    // ========== 命中测试掩码实现 ==========
+    
+    AlphaMask::AlphaMask(int width, int height, uint8_t threshold, uint32_t version)
+        : m_width(width)
+        , m_height(height)
+        , m_wordsPerRow((width + 63) / 64)
+        , m_threshold(threshold)
+        , m_version(version)
+        , m_bits(static_cast<size_t>(m_wordsPerRow) * height, 0)
+    {
+        s_textureMemoryStats.alphaMaskBytes.fetch_add(getByteSize(), std::memory_order_relaxed);
+        s_textureMemoryStats.alphaMaskCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    AlphaMask::~AlphaMask()
+    {
+        s_textureMemoryStats.alphaMaskBytes.fetch_sub(getByteSize(), std::memory_order_relaxed);
+        s_textureMemoryStats.alphaMaskCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+    
+    std::shared_ptr<const AlphaMask> BitmapData::getAlphaMask(uint8_t threshold)
+    {
+        if (m_width <= 0 || m_height <= 0 || (!m_pixelData && !m_compactPixels)) {
+            return nullptr;
+        }
+        
+        auto it = std::find_if(m_alphaMasks.begin(), m_alphaMasks.end(),
+                               [threshold](const std::shared_ptr<AlphaMask>& mask) {
+                                   return mask->getThreshold() == threshold;
+                               });
+        if (it != m_alphaMasks.end() && (*it)->getVersion() == m_version &&
+            (*it)->getWidth() == m_width && (*it)->getHeight() == m_height) {
+            return *it;
+        }
+        
+        // 像素已变化则整体重建；旧掩码可能仍被外部持有，不原地修改
+        auto mask = std::make_shared<AlphaMask>(m_width, m_height, threshold, m_version);
+        std::vector<uint32_t> scratch(m_width);
+        for (int y = 0; y < m_height; ++y) {
+            const uint32_t* row = readRow(0, y, m_width, scratch.data());
+            sys::PixelOps::alphaMaskRow(mask->getRow(y), row, m_width, threshold);
+        }
+        
+        if (it != m_alphaMasks.end()) {
+            *it = mask;
+        } else {
+            m_alphaMasks.push_back(mask);
+        }
+        return mask;
+    }
+    
     void BitmapData::allocatePixelData()
     {
         if (m_width > 0 && m_height > 0) {
-            m_pixelData = std::make_unique<uint32_t[]>(m_width * m_height);
+            m_pixelData = std::make_unique<uint32_t[]>(static_cast<size_t>(m_width) * m_height);
+            m_compactPixels.reset();
+            m_pixelFormat = BitmapPixelFormat::ARGB8888;
         }
+        updateStorageStats();
     }
     
     void BitmapData::deallocatePixelData()
     {
         m_pixelData.reset();
+        m_compactPixels.reset();
+        m_pixelFormat = BitmapPixelFormat::ARGB8888;
+        updateStorageStats();
+    }
+    
+    void BitmapData::updateStorageStats()
+    {
+        if (m_storageBytes > 0) {
+            int index = static_cast<int>(m_storageFormat);
+            s_textureMemoryStats.bytes[index].fetch_sub(m_storageBytes, std::memory_order_relaxed);
+            s_textureMemoryStats.count[index].fetch_sub(1, std::memory_order_relaxed);
+        }
+        
+        m_storageBytes = 0;
+        if (m_pixelData) {
+            m_storageBytes = static_cast<size_t>(m_width) * m_height * sizeof(uint32_t);
+        } else if (m_compactPixels) {
+            m_storageBytes = m_compactPixels->size();
+        }
+        m_storageFormat = m_pixelFormat;
+        
+        if (m_storageBytes > 0) {
+            int index = static_cast<int>(m_storageFormat);
+            s_textureMemoryStats.bytes[index].fetch_add(m_storageBytes, std::memory_order_relaxed);
+            s_textureMemoryStats.count[index].fetch_add(1, std::memory_order_relaxed);
+        }
     }
     
     void BitmapData::initialize(int width, int height, bool transparent, uint32_t fillColor)
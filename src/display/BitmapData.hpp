@@ -7,6 +7,7 @@
 #include <memory>
 #include <vector>
 #include <cstdint>
+#include <cstddef>
 #include <string>
 
 namespace egret
@@ -14,7 +15,14 @@ namespace egret
     // 前向声明
     class DisplayObject;
     class Rectangle;
+    class Point;
+    class ColorTransform;
+    class Matrix;
     class ImageLoader;  // 前向声明ImageLoader
+    namespace sys {
+        class SkiaRenderer;
+        class RenderBuffer;
+    }
     
     /**
      * 压缩纹理数据
@@ -29,6 +37,110 @@ namespace egret
         int level;                    // 级别
     };
     
+    /**
+     * 整数像素区域（左闭右开），用于记录BitmapData的脏矩形
+     */
+    struct PixelRegion
+    {
+        int left = 0;
+        int top = 0;
+        int right = 0;
+        int bottom = 0;
+        
+        bool isEmpty() const { return right <= left || bottom <= top; }
+        int getWidth() const { return right - left; }
+        int getHeight() const { return bottom - top; }
+    };
+    
+    /**
+     * BitmapData在内存中的像素存储格式
+     * 紧凑格式用于不需要编辑的资源：任何写操作都会先把位图还原为ARGB8888
+     */
+    enum class BitmapPixelFormat
+    {
+        ARGB8888 = 0,   // 32位非预乘ARGB（默认，可编辑）
+        RGB565,         // 16位不透明
+        ARGB4444,       // 16位预乘，每通道4位
+        A8,             // 8位仅Alpha（颜色视为白色，适用于遮罩和字形图集）
+        COUNT
+    };
+    
+    /**
+     * 各像素格式的位图内存统计（某一时刻的快照）
+     * 底层计数器为原子变量，工作线程解码的位图与渲染器释放的副本都会计入
+     */
+    struct TextureMemoryStats
+    {
+        size_t bytes[static_cast<int>(BitmapPixelFormat::COUNT)] = {};   // 各格式像素字节数
+        size_t count[static_cast<int>(BitmapPixelFormat::COUNT)] = {};   // 各格式位图数量
+        size_t alphaMaskBytes = 0;                                        // 命中测试Alpha掩码字节数
+        size_t alphaMaskCount = 0;                                        // 命中测试Alpha掩码数量
+        size_t rendererCopyBytes = 0;                                     // 渲染器侧预乘像素副本字节数
+        size_t rendererCopyCount = 0;                                     // 渲染器侧预乘像素副本数量
+        
+        /**
+         * 像素、Alpha掩码与渲染器副本的总字节数
+         */
+        size_t getTotalBytes() const
+        {
+            size_t total = alphaMaskBytes + rendererCopyBytes;
+            for (size_t value : bytes) total += value;
+            return total;
+        }
+    };
+    
+    /**
+     * 1位Alpha命中掩码：每像素1位，Alpha大于阈值的像素为1
+     * 由BitmapData按阈值懒构建并缓存，引用同一位图的所有Bitmap（包括图集中的不同纹理区域）共享
+     */
+    class AlphaMask
+    {
+    public:
+        AlphaMask(int width, int height, uint8_t threshold, uint32_t version);
+        ~AlphaMask();
+        
+        AlphaMask(const AlphaMask&) = delete;
+        AlphaMask& operator=(const AlphaMask&) = delete;
+        
+        /**
+         * 测试位图坐标处的像素是否不透明（超出范围返回false）
+         */
+        bool test(int x, int y) const
+        {
+            if (x < 0 || y < 0 || x >= m_width || y >= m_height) {
+                return false;
+            }
+            return (m_bits[static_cast<size_t>(y) * m_wordsPerRow + (x >> 6)] >> (x & 63)) & 1;
+        }
+        
+        int getWidth() const { return m_width; }
+        int getHeight() const { return m_height; }
+        uint8_t getThreshold() const { return m_threshold; }
+        
+        /**
+         * 构建时对应的BitmapData像素版本号
+         */
+        uint32_t getVersion() const { return m_version; }
+        
+        /**
+         * 掩码占用的字节数
+         */
+        size_t getByteSize() const { return m_bits.size() * sizeof(uint64_t); }
+        
+        /**
+         * 第y行的位数据（构建时写入）
+         */
+        uint64_t* getRow(int y) { return m_bits.data() + static_cast<size_t>(y) * m_wordsPerRow; }
+        
+    private:
+        int m_width;
+        int m_height;
+        int m_wordsPerRow;
+        uint8_t m_threshold;
+        uint32_t m_version;
+        std::vector<uint64_t> m_bits;
+    };
+    
     /**
      * BitmapData对象是一个包含像素数据的数组。此数据可以表示完全不透明的位图，或表示包含Alpha通道数据的透明位图。
      * 以上任一类型的BitmapData对象都作为32位整数的缓冲区进行存储。每个32位整数确定位图中单个像素的属性。
@@ -41,6 +153,7 @@ namespace egret
     {
         // 友元声明
         friend class ImageLoader;  // 允许ImageLoader访问私有成员
+        friend class sys::SkiaRenderer;  // 允许渲染器直接读取像素数据做增量同步
         
     public:
         // ========== 构造函数 ==========
@@ -169,15 +282,18 @@ namespace egret
         
         /**
          * 复制指定区域的像素数据到另一个BitmapData
+         * 按行裁剪后整行复制；源与目标为同一BitmapData且区域重叠时结果仍正确
          * @param sourceBitmapData 源BitmapData
          * @param sourceRect 源区域
          * @param destPoint 目标位置
+         * @param mergeAlpha 为true时按源像素Alpha叠加到目标（source-over），否则直接覆盖
          * @version Egret 2.4
          * @platform Web,Native
          */
         void copyPixels(std::shared_ptr<BitmapData> sourceBitmapData, 
                        std::shared_ptr<Rectangle> sourceRect,
-                       std::shared_ptr<Rectangle> destPoint) const;
+                       std::shared_ptr<Rectangle> destPoint,
+                       bool mergeAlpha = false) const;
         
         /**
          * 填充指定区域
@@ -188,6 +304,185 @@ namespace egret
          */
         void fillRect(std::shared_ptr<Rectangle> rect, uint32_t color);
         
+        /**
+         * 按通道混合源图像与当前图像
+         * 每个通道：新值 = (源值 * multiplier + 目标值 * (256 - multiplier)) / 256
+         * @param sourceBitmapData 源BitmapData
+         * @param sourceRect 源区域
+         * @param destPoint 目标位置
+         * @param redMultiplier 红色通道乘数（0~256）
+         * @param greenMultiplier 绿色通道乘数（0~256）
+         * @param blueMultiplier 蓝色通道乘数（0~256）
+         * @param alphaMultiplier Alpha通道乘数（0~256）
+         */
+        void merge(std::shared_ptr<BitmapData> sourceBitmapData,
+                   std::shared_ptr<Rectangle> sourceRect,
+                   std::shared_ptr<Point> destPoint,
+                   uint32_t redMultiplier, uint32_t greenMultiplier,
+                   uint32_t blueMultiplier, uint32_t alphaMultiplier);
+        
+        /**
+         * 根据阈值测试源图像像素，将通过测试的像素设置为指定颜色
+         * @param sourceBitmapData 源BitmapData（可以是当前对象）
+         * @param sourceRect 源区域
+         * @param destPoint 目标位置
+         * @param operation 比较运算符："<"、"<="、">"、">="、"=="、"!="
+         * @param threshold 阈值
+         * @param color 通过测试的像素被设置成的颜色
+         * @param mask 比较前应用于源像素与阈值的掩码
+         * @param copySource 为true时未通过测试的像素复制源像素
+         * @return 通过测试的像素数量，运算符无效时返回0
+         */
+        int threshold(std::shared_ptr<BitmapData> sourceBitmapData,
+                      std::shared_ptr<Rectangle> sourceRect,
+                      std::shared_ptr<Point> destPoint,
+                      const std::string& operation, uint32_t threshold,
+                      uint32_t color = 0, uint32_t mask = 0xFFFFFFFF, bool copySource = false);
+        
+        /**
+         * 对指定区域应用颜色变换
+         * @param rect 要变换的区域
+         * @param colorTransform 颜色变换
+         */
+        void colorTransform(std::shared_ptr<Rectangle> rect, const ColorTransform& colorTransform);
+        
+        /**
+         * 将显示对象渲染到当前位图
+         * 在裁剪区域的预乘副本上经SystemRenderer绘制，只把被改动的像素还原写回位图，
+         * 未绘制到的像素保持原值（不经过预乘往返）。绘制区域会被标记为脏区域，渲染器缓存的SkImage随之失效并增量同步。
+         * @param source 要绘制的显示对象（不应包含以当前位图为内容的Bitmap）
+         * @param matrix 绘制时应用的变换矩阵
+         * @param clipRect 绘制裁剪区域（位图坐标），为空时绘制整张位图
+         * @return 是否执行了绘制
+         */
+        bool draw(DisplayObject* source, const Matrix& matrix, std::shared_ptr<Rectangle> clipRect = nullptr);
+        
+        /**
+         * 以单位矩阵将显示对象渲染到当前位图
+         */
+        bool draw(DisplayObject* source);
+        
+        // ========== 像素格式 ==========
+        
+        /**
+         * 当前像素存储格式
+         */
+        BitmapPixelFormat getPixelFormat() const { return m_pixelFormat; }
+        
+        /**
+         * 转换像素存储格式
+         * 转为紧凑格式会释放32位像素内存，转换有损（RGB565丢弃Alpha，ARGB4444每通道4位，A8丢弃颜色）
+         * @param format 目标格式
+         * @return 是否转换成功（无像素数据时返回false）
+         */
+        bool setPixelFormat(BitmapPixelFormat format);
+        
+        /**
+         * 根据像素内容推荐可无损或近似无损使用的紧凑格式
+         * 全部不透明时返回RGB565；颜色全为白色（或完全透明）时返回A8；否则返回ARGB8888
+         */
+        BitmapPixelFormat suggestPixelFormat() const;
+        
+        /**
+         * 像素数据占用的字节数
+         */
+        size_t getByteSize() const { return m_storageBytes; }
+        
+        /**
+         * 像素格式名称（用于日志）
+         */
+        static const char* getPixelFormatName(BitmapPixelFormat format);
+        
+        /**
+         * 每像素字节数
+         */
+        static int getBytesPerPixel(BitmapPixelFormat format);
+        
+        /**
+         * 当前所有位图按格式统计的像素内存
+         */
+        static TextureMemoryStats getTextureMemoryStats();
+        
+        /**
+         * 输出按格式统计的像素内存到日志
+         */
+        static void logTextureMemoryStats();
+        
+        /**
+         * 登记/注销渲染器为位图创建的像素副本（如ARGB8888位图的预乘RGBA副本），可在任意线程调用
+         * @param bytes 副本字节数
+         */
+        static void addRendererCopyStats(size_t bytes);
+        static void removeRendererCopyStats(size_t bytes);
+        
+        // ========== 命中测试掩码 ==========
+        
+        /**
+         * 获取指定阈值的1位Alpha掩码，首次调用或像素变化后重新构建
+         * 掩码计入getTextureMemoryStats的alphaMaskBytes
+         * @param threshold Alpha阈值，Alpha大于该值的像素视为命中
+         * @return 没有CPU侧像素数据（如以渲染缓冲区为来源）时返回nullptr
+         */
+        std::shared_ptr<const AlphaMask> getAlphaMask(uint8_t threshold = 0);
+        
+        /**
+         * 释放缓存的Alpha掩码
+         */
+        void releaseAlphaMasks() { m_alphaMasks.clear(); }
+        
+        // ========== 渲染缓冲区来源 ==========
+        
+        /**
+         * 以渲染缓冲区作为位图内容来源（RenderTexture使用）
+         * 渲染器直接取缓冲区表面的快照绘制，不保留CPU侧像素副本；尺寸取自缓冲区
+         * @param buffer 渲染缓冲区，传入空指针解除绑定
+         */
+        void setRenderBufferSource(std::shared_ptr<sys::RenderBuffer> buffer);
+        
+        /**
+         * 作为内容来源的渲染缓冲区，普通位图返回nullptr
+         */
+        sys::RenderBuffer* getRenderBufferSource() const { return m_renderBufferSource.get(); }
+        
+        // ========== 脏矩形跟踪 ==========
+        
+        /**
+         * 标记指定区域的像素已被修改
+         * setPixel32、setPixels、fillRect、copyPixels会自动调用；直接写入像素内存后需手动调用。
+         * 区域会被裁剪到位图范围内，并与已有脏区域合并。
+         * @param x 区域X坐标
+         * @param y 区域Y坐标
+         * @param width 区域宽度
+         * @param height 区域高度
+         */
+        void markDirty(int x, int y, int width, int height);
+        
+        /**
+         * 标记整张位图已被修改
+         */
+        void markAllDirty() { markDirty(0, 0, m_width, m_height); }
+        
+        /**
+         * 像素内容版本号，每次markDirty递增
+         */
+        uint32_t getVersion() const { return m_version; }
+        
+        /**
+         * 自上次clearDirtyRegion以来累积的脏区域
+         */
+        const PixelRegion& getDirtyRegion() const { return m_dirtyRegion; }
+        
+        /**
+         * 脏区域开始累积时的版本号。
+         * 持有版本号等于该值的像素副本只需同步getDirtyRegion()范围即可追上当前版本。
+         */
+        uint32_t getDirtyBaseVersion() const { return m_dirtyBaseVersion; }
+        
+        /**
+         * 清空脏区域（由渲染器在同步完成后调用）
+         */
+        void clearDirtyRegion();
+        
         /**
          * 销毁位图数据
          * @version Egret 5.0.8
@@ -243,6 +538,36 @@ namespace egret
          */
         bool isValidCoordinate(int x, int y) const;
         
+        /**
+         * 源/目标双向裁剪后的复制区域
+         */
+        struct CopyRegion
+        {
+            int srcX, srcY;
+            int destX, destY;
+            int width, height;
+        };
+        
+        /**
+         * 将源区域与目标位置同时裁剪到两张位图范围内
+         * @return 裁剪后区域非空时返回true
+         */
+        bool clipCopyRegion(const BitmapData& source, const Rectangle& sourceRect,
+                            double destX, double destY, CopyRegion& region) const;
+        
+        /**
+         * 读取一行像素为ARGB8888
+         * ARGB8888格式直接返回内部指针，紧凑格式解码到scratch后返回scratch
+         * @param scratch 至少count个像素的临时缓冲
+         */
+        const uint32_t* readRow(int x, int y, int count, uint32_t* scratch) const;
+        
+        /**
+         * 写操作前调用：紧凑格式先还原为ARGB8888
+         * @return 是否有可写的像素数据
+         */
+        bool prepareForWrite();
+        
         /**
          * 获取像素数据指针
          */
@@ -257,6 +582,16 @@ namespace egret
         std::unique_ptr<uint32_t[]> m_pixelData;         // 像素数据
         bool m_disposed;                                  // 是否已销毁
         
+        uint32_t m_version = 0;                           // 像素内容版本号
+        uint32_t m_dirtyBaseVersion = 0;                  // 脏区域起始版本号
+        PixelRegion m_dirtyRegion;                        // 累积的脏区域
+        std::shared_ptr<sys::RenderBuffer> m_renderBufferSource; // 渲染缓冲区内容来源
+        BitmapPixelFormat m_pixelFormat = BitmapPixelFormat::ARGB8888; // 像素存储格式
+        std::shared_ptr<std::vector<uint8_t>> m_compactPixels; // 紧凑格式像素（与渲染器共享）
+        std::vector<std::shared_ptr<AlphaMask>> m_alphaMasks; // 按阈值缓存的命中测试掩码
+        size_t m_storageBytes = 0;                        // 已计入统计的像素字节数
+        BitmapPixelFormat m_storageFormat = BitmapPixelFormat::ARGB8888; // 已计入统计的格式
+        
         // ========== 私有辅助方法 ==========
         
         /**
@@ -265,10 +600,15 @@ namespace egret
         void allocatePixelData();
         
         /**
-         * 释放像素数据内存
+         * 释放像素数据内存（包括紧凑格式数据）
          */
         void deallocatePixelData();
         
+        /**
+         * 按当前存储更新全局内存统计
+         */
+        void updateStorageStats();
+        
         /**
          * 初始化BitmapData
          */
@@ -1,24 +1,67 @@
 #include "display/DisplayObject.hpp"
 #include "display/DisplayObjectContainer.hpp"
 #include "display/Stage.hpp"
+#include "events/Event.hpp"
 #include "sys/GraphicsNode.hpp"  // 添加GraphicsNode头文件
+#include "sys/TouchHandler.hpp"
 #include <algorithm>
 #include <cmath>
 #include <glm/gtc/constants.hpp>
 
 namespace egret {
 
+    // 全局变换纪元：任意对象变换或层级变化时递增；等于对象记录的纪元时其世界矩阵必然有效
+    static uint32_t s_transformEpoch = 1;
+    
+    // 子树边界重算计数
+    uint32_t DisplayObject::s_boundsRecomputeCount = 0;
+
+    // 帧回调列表：按注册顺序保存侦听了ENTER_FRAME(0)/RENDER(1)的显示对象
+    // 移除时只置空槽位，不在广播中时再压缩，因此广播期间增删侦听器是安全的
+    struct FrameCallbackList {
+        std::vector<DisplayObject*> objects;
+        size_t holes = 0;
+        int broadcasting = 0;
+    };
+    static FrameCallbackList s_frameCallbacks[2];
+
+    // 固定步长插值：上一逻辑帧（prev）的变换，当前逻辑帧的值就是对象自身的属性
+    // 插值只在渲染时计算到渲染矩阵中，不写回对象
+    struct InterpolationState {
+        DisplayObject* object;
+        double prevX, prevY, prevScaleX, prevScaleY, prevRotation;
+    };
+    static std::vector<InterpolationState> s_interpolationStates;
+    static bool s_interpolationApplied = false;
+    static double s_interpolationAlpha = 1.0;
+
     DisplayObject::DisplayObject() : EventDispatcher() {
+        setDisplayObjectTarget(this);
         m_tint = 0xFFFFFF;
         m_matrix = std::make_unique<Matrix>();
     }
 
     DisplayObject::~DisplayObject() {
+        unregisterFrameCallback(0);
+        unregisterFrameCallback(1);
+        setTransformInterpolation(false);
         if (m_scrollRect) {
             delete m_scrollRect;
         }
     }
 
+    // ========== 基本属性实现 ==========
+
+    void DisplayObject::setName(const std::string& name) {
+        if (m_name == name) {
+            return;
+        }
+        m_name = name;
+        if (m_parent) {
+            m_parent->onChildNameChanged();
+        }
+    }
+
     // ========== 坐标设置实现 ==========
 
     bool DisplayObject::setXInternal(double value) {
@@ -26,6 +69,7 @@ namespace egret {
             return false;
         }
         m_x = value;
+        bumpTransformVersion();
         onPropertyChanged();
         return true;
     }
@@ -35,6 +79,7 @@ namespace egret {
             return false;
         }
         m_y = value;
+        bumpTransformVersion();
         onPropertyChanged();
         return true;
     }
@@ -146,6 +191,7 @@ namespace egret {
             return;
         }
         m_anchorOffsetX = value;
+        invalidateBoundsInParent();
         onPropertyChanged();
     }
 
@@ -154,6 +200,7 @@ namespace egret {
             return;
         }
         m_anchorOffsetY = value;
+        invalidateBoundsInParent();
         onPropertyChanged();
     }
 
@@ -180,6 +227,7 @@ namespace egret {
     void DisplayObject::setMatrixInternal(const Matrix& matrix, bool needUpdateProperties) {
         m_matrix->copyFrom(matrix);
         m_matrixDirty = false;
+        bumpTransformVersion();
         
         if (needUpdateProperties) {
             // 从矩阵中提取属性
@@ -198,32 +246,58 @@ namespace egret {
     }
 
     Matrix* DisplayObject::getConcatenatedMatrix() {
-        if (!m_concatenatedMatrix) {
-            m_concatenatedMatrix = std::make_unique<Matrix>();
-        }
-        
-        m_concatenatedMatrix->copyFrom(*getMatrixInternal());
-        
-        DisplayObject* current = m_parent;
-        while (current) {
-            m_concatenatedMatrix->prependMatrix(*current->getMatrixInternal());
-            current = current->getParent();
-        }
-        
+        validateWorldMatrix();
         return m_concatenatedMatrix.get();
     }
 
     Matrix* DisplayObject::getInvertedConcatenatedMatrix() {
+        validateWorldMatrix();
         if (!m_invertedConcatenatedMatrix) {
             m_invertedConcatenatedMatrix = std::make_unique<Matrix>();
+            m_invertedWorldVersion = m_worldVersion - 1;
         }
         
-        m_invertedConcatenatedMatrix->copyFrom(*getConcatenatedMatrix());
-        m_invertedConcatenatedMatrix->invertSelf();
+        if (m_invertedWorldVersion != m_worldVersion) {
+            m_invertedConcatenatedMatrix->copyFrom(*m_concatenatedMatrix);
+            m_invertedConcatenatedMatrix->invertSelf();
+            m_invertedWorldVersion = m_worldVersion;
+        }
         
         return m_invertedConcatenatedMatrix.get();
     }
 
+    void DisplayObject::validateWorldMatrix() {
+        if (m_worldCheckedEpoch == s_transformEpoch && m_concatenatedMatrix) {
+            return;
+        }
+        
+        // 先校验父节点（同一纪元内每个祖先只校验一次）
+        DisplayObject* parent = m_parent;
+        uint32_t parentVersion = 0;
+        if (parent) {
+            parent->validateWorldMatrix();
+            parentVersion = parent->m_worldVersion;
+        }
+        
+        bool stale = !m_concatenatedMatrix ||
+                     m_worldSelfVersion != m_transformVersion ||
+                     m_worldParentVersion != parentVersion;
+        if (stale) {
+            if (!m_concatenatedMatrix) {
+                m_concatenatedMatrix = std::make_unique<Matrix>();
+            }
+            m_concatenatedMatrix->copyFrom(*getMatrixInternal());
+            if (parent) {
+                m_concatenatedMatrix->prependMatrix(*parent->m_concatenatedMatrix);
+            }
+            m_worldSelfVersion = m_transformVersion;
+            m_worldParentVersion = parentVersion;
+            ++m_worldVersion;
+        }
+        
+        m_worldCheckedEpoch = s_transformEpoch;
+    }
+
     // ========== 宽度高度实现 ==========
 
     double DisplayObject::getWidth() {
@@ -330,9 +404,286 @@ namespace egret {
     // ========== 碰撞检测实现 ==========
 
     bool DisplayObject::hitTestPoint(double x, double y, bool shapeFlag) {
-        Point localPoint = globalToLocal(x, y);
-        Rectangle bounds = getBounds(nullptr, false);
-        return bounds.containsPoint(localPoint);
+        Matrix* inv = getInvertedConcatenatedMatrix();
+        double localX = inv->a * x + inv->c * y + inv->tx + m_anchorOffsetX;
+        double localY = inv->b * x + inv->d * y + inv->ty + m_anchorOffsetY;
+        
+        if (shapeFlag) {
+            return hitTestLocal(localX, localY, x, y) != nullptr;
+        }
+        return getSubtreeBounds().contains(localX, localY);
+    }
+
+    DisplayObject* DisplayObject::hitTest(double stageX, double stageY) {
+        if (!m_visible) {
+            return nullptr;
+        }
+        
+        // 只在入口处使用一次逆世界矩阵，之后逐级用本地矩阵下降
+        Matrix* inv = getInvertedConcatenatedMatrix();
+        double localX = inv->a * stageX + inv->c * stageY + inv->tx + m_anchorOffsetX;
+        double localY = inv->b * stageX + inv->d * stageY + inv->ty + m_anchorOffsetY;
+        return hitTestLocal(localX, localY, stageX, stageY);
+    }
+
+    DisplayObject* DisplayObject::hitTestLocal(double localX, double localY, double stageX, double stageY) {
+        if (!hitTestClip(localX, localY, stageX, stageY)) {
+            return nullptr;
+        }
+        return hitTestContent(localX, localY) ? this : nullptr;
+    }
+
+    bool DisplayObject::hitTestContent(double localX, double localY) {
+        Rectangle bounds;
+        measureContentBounds(bounds);
+        return bounds.contains(localX, localY);
+    }
+
+    bool DisplayObject::hitTestClip(double localX, double localY, double stageX, double stageY) {
+        if (m_scrollRect && !m_scrollRect->contains(localX, localY)) {
+            return false;
+        }
+        if (m_mask && !m_mask->hitTestPoint(stageX, stageY)) {
+            return false;
+        }
+        return true;
+    }
+
+    bool DisplayObject::parentToLocal(double parentX, double parentY, double& localX, double& localY) {
+        const Matrix* m = getMatrixInternal();
+        double det = m->a * m->d - m->b * m->c;
+        if (det == 0.0) {
+            return false;
+        }
+        double dx = parentX - m->tx;
+        double dy = parentY - m->ty;
+        localX = (m->d * dx - m->c * dy) / det + m_anchorOffsetX;
+        localY = (m->a * dy - m->b * dx) / det + m_anchorOffsetY;
+        return true;
+    }
+
+    // ========== 帧事件回调列表 ==========
+
+    void DisplayObject::addListener(const std::string& type, const EventListener& listener, void* thisObject,
+                                    bool useCapture, int priority, bool dispatchOnce) {
+        EventDispatcher::addListener(type, listener, thisObject, useCapture, priority, dispatchOnce);
+        int kind = frameCallbackKind(type);
+        if (kind >= 0) {
+            registerFrameCallback(kind);
+        }
+    }
+
+    void DisplayObject::removeEventListener(const std::string& type, const EventListener& listener,
+                                            void* thisObject, bool useCapture) {
+        EventDispatcher::removeEventListener(type, listener, thisObject, useCapture);
+        int kind = frameCallbackKind(type);
+        if (kind >= 0 && !hasEventListener(type)) {
+            unregisterFrameCallback(kind);
+        }
+    }
+
+    void DisplayObject::broadcastEnterFrame() {
+        broadcastFrameEvent(0, Event::ENTER_FRAME);
+    }
+
+    void DisplayObject::broadcastRender() {
+        broadcastFrameEvent(1, Event::RENDER);
+    }
+
+    size_t DisplayObject::getEnterFrameCallbackCount() {
+        return s_frameCallbacks[0].objects.size() - s_frameCallbacks[0].holes;
+    }
+
+    size_t DisplayObject::getRenderCallbackCount() {
+        return s_frameCallbacks[1].objects.size() - s_frameCallbacks[1].holes;
+    }
+
+    int DisplayObject::frameCallbackKind(const std::string& type) {
+        if (type == Event::ENTER_FRAME) {
+            return 0;
+        }
+        if (type == Event::RENDER) {
+            return 1;
+        }
+        return -1;
+    }
+
+    void DisplayObject::registerFrameCallback(int kind) {
+        if (m_frameCallbackIndex[kind] >= 0) {
+            return;
+        }
+        auto& list = s_frameCallbacks[kind];
+        m_frameCallbackIndex[kind] = static_cast<int>(list.objects.size());
+        list.objects.push_back(this);
+    }
+
+    void DisplayObject::unregisterFrameCallback(int kind) {
+        int index = m_frameCallbackIndex[kind];
+        if (index < 0) {
+            return;
+        }
+        auto& list = s_frameCallbacks[kind];
+        list.objects[index] = nullptr;
+        list.holes++;
+        m_frameCallbackIndex[kind] = -1;
+        // 空槽过半时压缩，保证注销为均摊O(1)
+        if (list.broadcasting == 0 && list.holes * 2 > list.objects.size()) {
+            compactFrameCallbacks(kind);
+        }
+    }
+
+    void DisplayObject::broadcastFrameEvent(int kind, const std::string& type) {
+        auto& list = s_frameCallbacks[kind];
+        // 广播期间新注册的对象从下一次广播开始接收事件
+        size_t length = list.objects.size();
+        if (length == list.holes) {
+            return;
+        }
+        list.broadcasting++;
+        for (size_t i = 0; i < length; ++i) {
+            DisplayObject* object = list.objects[i];
+            if (object) {
+                object->dispatchEventWith(type);
+            }
+        }
+        list.broadcasting--;
+        if (list.broadcasting == 0 && list.holes > 0) {
+            compactFrameCallbacks(kind);
+        }
+    }
+
+    void DisplayObject::compactFrameCallbacks(int kind) {
+        auto& list = s_frameCallbacks[kind];
+        size_t count = 0;
+        for (DisplayObject* object : list.objects) {
+            if (object) {
+                object->m_frameCallbackIndex[kind] = static_cast<int>(count);
+                list.objects[count++] = object;
+            }
+        }
+        list.objects.resize(count);
+        list.holes = 0;
+    }
+
+    // ========== 固定步长渲染插值 ==========
+
+    void DisplayObject::setTransformInterpolation(bool value) {
+        if (value == (m_interpolationIndex >= 0)) {
+            return;
+        }
+        if (value) {
+            m_interpolationIndex = static_cast<int>(s_interpolationStates.size());
+            s_interpolationStates.push_back({this});
+            resetTransformInterpolation();
+            return;
+        }
+        // 与末尾交换后删除
+        InterpolationState& state = s_interpolationStates[m_interpolationIndex];
+        state = s_interpolationStates.back();
+        state.object->m_interpolationIndex = m_interpolationIndex;
+        s_interpolationStates.pop_back();
+        m_interpolationIndex = -1;
+    }
+
+    void DisplayObject::resetTransformInterpolation() {
+        if (m_interpolationIndex < 0) {
+            return;
+        }
+        InterpolationState& state = s_interpolationStates[m_interpolationIndex];
+        state.prevX = m_x;
+        state.prevY = m_y;
+        state.prevScaleX = m_scaleX;
+        state.prevScaleY = m_scaleY;
+        state.prevRotation = m_rotation;
+    }
+
+    void DisplayObject::captureInterpolationStates() {
+        for (auto& state : s_interpolationStates) {
+            state.object->resetTransformInterpolation();
+        }
+    }
+
+    void DisplayObject::beginRenderInterpolation(double alpha) {
+        s_interpolationApplied = !s_interpolationStates.empty();
+        s_interpolationAlpha = std::clamp(alpha, 0.0, 1.0);
+    }
+
+    void DisplayObject::endRenderInterpolation() {
+        s_interpolationApplied = false;
+    }
+
+    bool DisplayObject::shouldUseRenderTransform() const {
+        return m_useTranslate || (s_interpolationApplied && m_interpolationIndex >= 0);
+    }
+
+    Matrix DisplayObject::getRenderMatrix() {
+        if (!s_interpolationApplied || m_interpolationIndex < 0) {
+            return *getMatrixInternal();
+        }
+        const InterpolationState& state = s_interpolationStates[m_interpolationIndex];
+        const double alpha = s_interpolationAlpha;
+        double skewX = m_skewX;
+        double skewY = m_skewY;
+        // 旋转按最短弧插值；设置了独立倾斜的对象不插值旋转，保留倾斜值
+        if (m_skewXdeg == m_skewYdeg) {
+            double delta = std::remainder(m_rotation - state.prevRotation, 360.0);
+            skewX = skewY = (state.prevRotation + delta * alpha) * glm::pi<double>() / 180.0;
+        }
+        Matrix matrix;
+        matrix.updateScaleAndRotation(state.prevScaleX + (m_scaleX - state.prevScaleX) * alpha,
+                                      state.prevScaleY + (m_scaleY - state.prevScaleY) * alpha,
+                                      skewX, skewY);
+        matrix.tx = state.prevX + (m_x - state.prevX) * alpha;
+        matrix.ty = state.prevY + (m_y - state.prevY) * alpha;
+        return matrix;
+    }
+
+    size_t DisplayObject::getInterpolatedObjectCount() {
+        return s_interpolationStates.size();
+    }
+
+    // ========== 子树边界缓存 ==========
+
+    const Rectangle& DisplayObject::getSubtreeBounds() {
+        if (m_subtreeBoundsDirty) {
+            m_subtreeBounds.setTo(0, 0, 0, 0);
+            measureSubtreeBounds(m_subtreeBounds);
+            m_subtreeBoundsDirty = false;
+            ++s_boundsRecomputeCount;
+            if (m_stage) {
+                ++m_stage->m_boundsRecomputeCount;
+            }
+        }
+        return m_subtreeBounds;
+    }
+
+    void DisplayObject::invalidateSubtreeBounds() {
+        // 已失效的节点其祖先必然已失效，可以提前停止
+        DisplayObject* current = this;
+        while (current && !current->m_subtreeBoundsDirty) {
+            current->m_subtreeBoundsDirty = true;
+            if (current->m_parent) {
+                current->m_parent->onChildBoundsChanged(current);
+            }
+            current = current->m_parent;
+        }
+    }
+
+    void DisplayObject::getBoundsInParent(Rectangle& bounds) {
+        bounds.copyFrom(getSubtreeBounds());
+        if (bounds.isEmpty()) {
+            return;
+        }
+        bounds.setX(bounds.getX() - m_anchorOffsetX);
+        bounds.setY(bounds.getY() - m_anchorOffsetY);
+        getMatrixInternal()->transformBounds(bounds);
+    }
+
+    void DisplayObject::invalidateBoundsInParent() {
+        if (m_parent) {
+            m_parent->onChildBoundsChanged(this);
+            m_parent->invalidateSubtreeBounds();
+        }
     }
 
     DisplayObject* DisplayObject::hitTestObject(DisplayObject* other) {
@@ -353,7 +704,16 @@ namespace egret {
     // ========== 内部方法实现 ==========
 
     void DisplayObject::setParentInternal(DisplayObjectContainer* parent) {
+        if (m_parent == parent) {
+            return;
+        }
+        if (m_parent) {
+            m_parent->invalidateSubtreeBounds();
+        }
         m_parent = parent;
+        // 旧索引属于原父容器，由新父容器插入时重新写入
+        m_indexInParent = -1;
+        bumpTransformVersion();
     }
 
     void DisplayObject::onAddToStageInternal(Stage* stage, int nestLevel) {
@@ -366,6 +726,10 @@ namespace egret {
     }
 
     void DisplayObject::onRemoveFromStageInternal() {
+        // 按下中的触摸点若以本对象为目标，改由舞台接收后续事件
+        if (m_stage) {
+            m_stage->getTouchHandler()->onTargetRemoved(this);
+        }
         m_stage = nullptr;
         m_nestLevel = 0;
         m_hasAddToStage = false;
@@ -397,10 +761,8 @@ namespace egret {
     }
 
     Rectangle DisplayObject::getMeasuredBounds() {
-        // 默认实现：调用虚函数 measureContentBounds 由子类填充内容边界
-        Rectangle bounds;
-        measureContentBounds(bounds);
-        return bounds;
+        // 内容边界由子类的measureContentBounds填充，容器再合并子对象边界；结果按失效标记缓存
+        return getSubtreeBounds();
     }
     
     // ========== 智能指针版本的边界计算实现 ==========
@@ -490,14 +852,14 @@ namespace egret {
 
     void DisplayObject::markMatrixDirty() {
         m_matrixDirty = true;
-        
-        // 清除缓存的连接矩阵
-        if (m_concatenatedMatrix) {
-            m_concatenatedMatrix.reset();
-        }
-        if (m_invertedConcatenatedMatrix) {
-            m_invertedConcatenatedMatrix.reset();
-        }
+        bumpTransformVersion();
+    }
+
+    void DisplayObject::bumpTransformVersion() {
+        ++m_transformVersion;
+        ++s_transformEpoch;
+        // 自身变换只影响父容器的子树边界
+        invalidateBoundsInParent();
     }
 
     void DisplayObject::onPropertyChanged() {
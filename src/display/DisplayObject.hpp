@@ -8,6 +8,7 @@
 #include <vector>
 #include <memory>
 #include <cmath>
+#include <cstdint>
 
 namespace egret {
     
@@ -30,6 +31,19 @@ namespace egret {
         SCROLLRECT = 4
     };
     
+    /**
+     * 显示对象类型标记，用于遍历热路径上替代dynamic_cast
+     * CONTAINER及其之后的取值均为DisplayObjectContainer的子类
+     */
+    enum class DisplayObjectType : uint8_t {
+        DISPLAY_OBJECT = 0,
+        BITMAP,
+        SHAPE,
+        CONTAINER,
+        SPRITE,
+        STAGE
+    };
+    
     /**
      * DisplayObject类是所有显示对象的基类
      * 对应TypeScript: export class DisplayObject extends EventDispatcher
@@ -45,7 +59,7 @@ namespace egret {
          * 显示对象的实例名称
          */
         const std::string& getName() const { return m_name; }
-        void setName(const std::string& name) { m_name = name; }
+        void setName(const std::string& name);
         
         /**
          * 父级显示对象容器
@@ -57,6 +71,21 @@ namespace egret {
          */
         Stage* getStage() const { return m_stage; }
         
+        /**
+         * 显示对象类型标记（构造时确定）
+         */
+        DisplayObjectType getDisplayObjectType() const { return m_displayObjectType; }
+        
+        /**
+         * 是否为DisplayObjectContainer（可直接static_cast）
+         */
+        bool isContainer() const { return m_displayObjectType >= DisplayObjectType::CONTAINER; }
+        
+        /**
+         * 是否正被用作其他对象的遮罩
+         */
+        bool isMaskObject() const { return m_maskedObject != nullptr; }
+        
         // ========== 坐标位置 ==========
         
         /**
@@ -154,9 +183,19 @@ namespace egret {
         virtual void setMatrix(const Matrix& matrix);
         Matrix* getMatrixInternal();
         void setMatrixInternal(const Matrix& matrix, bool needUpdateProperties = true);
+        
+        /**
+         * 世界矩阵（自身到舞台的连接矩阵）及其逆矩阵
+         * 结果被缓存，仅在自身或祖先的变换版本变化后重算；返回的指针由对象持有，只读
+         */
         Matrix* getConcatenatedMatrix();
         Matrix* getInvertedConcatenatedMatrix();
         
+        /**
+         * 世界矩阵内容版本，每次重算时递增（可用于外部缓存校验）
+         */
+        uint32_t getWorldMatrixVersion() { validateWorldMatrix(); return m_worldVersion; }
+        
         // ========== 锚点 ==========
         
         /**
@@ -247,12 +286,91 @@ namespace egret {
          */
         DisplayObject* hitTestObject(DisplayObject* other);
         
+        // ========== 事件侦听 ==========
+        
+        /**
+         * 移除侦听器；当ENTER_FRAME/RENDER的侦听器全部移除后，同时从对应的帧回调列表中注销
+         */
+        void removeEventListener(const std::string& type, const EventListener& listener,
+                                 void* thisObject = nullptr, bool useCapture = false) override;
+        
+        /**
+         * 向所有侦听了ENTER_FRAME的显示对象派发事件（由SystemTicker每帧调用）
+         * 对应TypeScript: DisplayObject.$enterFrameCallBackList
+         */
+        static void broadcastEnterFrame();
+        
+        /**
+         * 向所有侦听了RENDER的显示对象派发事件（由SystemTicker在stage.invalidate()后调用）
+         * 对应TypeScript: DisplayObject.$renderCallBackList
+         */
+        static void broadcastRender();
+        
+        /**
+         * 当前侦听ENTER_FRAME的显示对象数量
+         */
+        static size_t getEnterFrameCallbackCount();
+        
+        /**
+         * 当前侦听RENDER的显示对象数量
+         */
+        static size_t getRenderCallbackCount();
+        
+        // ========== 固定步长渲染插值 ==========
+        
+        /**
+         * 固定步长模式下是否对变换做渲染插值
+         * 开启后渲染时x/y/scaleX/scaleY/rotation取最近两个逻辑帧的状态按插值系数混合；
+         * 逻辑代码、碰撞检测与事件始终看到当前逻辑帧的值
+         */
+        void setTransformInterpolation(bool value);
+        bool getTransformInterpolation() const { return m_interpolationIndex >= 0; }
+        
+        /**
+         * 丢弃上一逻辑帧的状态（瞬移后调用），直到下一个逻辑步之前不做插值
+         */
+        void resetTransformInterpolation();
+        
+        /**
+         * 记录所有插值对象的上一逻辑帧状态（由SystemTicker在每个逻辑步之前调用）
+         */
+        static void captureInterpolationStates();
+        
+        /**
+         * 开始/结束插值渲染（由SystemTicker在渲染前后调用，必须成对）
+         * 期间getRenderMatrix返回插值后的矩阵，对象的变换属性与矩阵缓存保持逻辑帧的值
+         * @param alpha 插值系数，0为上一逻辑帧，1为当前逻辑帧
+         */
+        static void beginRenderInterpolation(double alpha);
+        static void endRenderInterpolation();
+        
+        /**
+         * 渲染用的本地变换矩阵：插值渲染期间开启了插值的对象返回混合后的矩阵，否则与getMatrix()相同
+         */
+        Matrix getRenderMatrix();
+        
+        /**
+         * 渲染时是否需要使用完整变换矩阵（插值渲染期间开启了插值的对象总是需要）
+         */
+        bool shouldUseRenderTransform() const;
+        
+        /**
+         * 当前开启插值的显示对象数量
+         */
+        static size_t getInterpolatedObjectCount();
+        
         // ========== 内部方法（由容器类和渲染系统使用） ==========
         
         /**
          * 设置父级对象（内部使用）
          */
         void setParentInternal(DisplayObjectContainer* parent);
+
+        /**
+         * 在父容器子列表中的索引缓存（内部使用，由DisplayObjectContainer维护）
+         */
+        int getIndexInParentInternal() const { return m_indexInParent; }
+        void setIndexInParentInternal(int index) { m_indexInParent = index; }
         
         /**
          * 添加到舞台时调用（内部使用）
@@ -290,12 +408,49 @@ namespace egret {
         virtual void measureContentBounds(Rectangle& bounds) {}
         
         /**
-         * 碰撞检测（虚函数，供子类重写）
+         * 碰撞检测入口：用缓存的逆世界矩阵把舞台坐标变换一次，再自顶向下调用hitTestLocal
          * @param stageX 舞台X坐标
          * @param stageY 舞台Y坐标
          * @return 碰撞的显示对象，如果没有碰撞返回nullptr
          */
-        virtual DisplayObject* hitTest(double stageX, double stageY) { return nullptr; }
+        DisplayObject* hitTest(double stageX, double stageY);
+        
+        /**
+         * 以本地坐标进行碰撞检测（虚函数，供子类重写）
+         * 容器把坐标逐级逆变换后传给子对象，整棵树只下降一次
+         * @param localX 本地内容坐标X（已计入锚点）
+         * @param localY 本地内容坐标Y（已计入锚点）
+         * @param stageX 舞台X坐标（供遮罩测试使用）
+         * @param stageY 舞台Y坐标（供遮罩测试使用）
+         */
+        virtual DisplayObject* hitTestLocal(double localX, double localY, double stageX, double stageY);
+        
+        /**
+         * 把父容器本地坐标转换为本对象的本地内容坐标（逆本地矩阵并计入锚点）
+         * @return 矩阵不可逆（如缩放为0）时返回false
+         */
+        bool parentToLocal(double parentX, double parentY, double& localX, double& localY);
+        
+        /**
+         * 子树边界（本地内容坐标系，包含自身内容与全部子对象），即getMeasuredBounds的结果
+         * 结果被缓存，只有自身或后代的几何、变换、子对象列表变化时才重算
+         */
+        const Rectangle& getSubtreeBounds();
+        
+        /**
+         * 子树边界重算次数（全局累计，只读；每帧统计见Stage::takeBoundsRecomputeCount）
+         */
+        static uint32_t getBoundsRecomputeCount() { return s_boundsRecomputeCount; }
+        
+        /**
+         * 使自身及祖先的子树边界缓存失效
+         */
+        void invalidateSubtreeBounds();
+        
+        /**
+         * 子树边界在父容器坐标系中的包围盒（减去锚点后应用本地矩阵）
+         */
+        void getBoundsInParent(Rectangle& bounds);
         
         /**
          * 获取嵌套深度
@@ -315,7 +470,7 @@ namespace egret {
         virtual Rectangle getBounds(Rectangle* resultRect = nullptr, bool calculateAnchor = true);
         
         /**
-         * 获取测量边界
+         * 获取测量边界（自身内容与子对象，不含锚点），返回缓存的子树边界
          */
         virtual Rectangle getMeasuredBounds();
         
@@ -413,6 +568,32 @@ namespace egret {
          */
         void setMeasuredSize(double width, double height);
         
+        /**
+         * 设置类型标记（仅在子类构造函数中调用）
+         */
+        void setDisplayObjectType(DisplayObjectType type) { m_displayObjectType = type; }
+        
+        /**
+         * 测试本地坐标是否落在自身内容上（不含子对象），默认使用内容边界
+         */
+        virtual bool hitTestContent(double localX, double localY);
+        
+        /**
+         * 测量子树边界（虚函数，容器重写以合并子对象边界）
+         */
+        virtual void measureSubtreeBounds(Rectangle& bounds) { measureContentBounds(bounds); }
+        
+        /**
+         * 滚动矩形与遮罩裁剪测试
+         */
+        bool hitTestClip(double localX, double localY, double stageX, double stageY);
+        
+        /**
+         * 注册侦听器；类型为ENTER_FRAME/RENDER时将自身加入对应的帧回调列表
+         */
+        void addListener(const std::string& type, const EventListener& listener, void* thisObject,
+                         bool useCapture, int priority, bool dispatchOnce = false) override;
+        
         
         // ========== 友元类声明 ==========
         friend class sys::SystemRenderer;  // 允许SystemRenderer访问受保护成员
@@ -431,8 +612,10 @@ namespace egret {
         // ========== 私有成员变量 ==========
         
         // 基本属性
+        DisplayObjectType m_displayObjectType = DisplayObjectType::DISPLAY_OBJECT;
         std::string m_name;
         DisplayObjectContainer* m_parent = nullptr;
+        int m_indexInParent = -1;
         
         // 坐标和变换
         double m_x = 0.0;
@@ -461,6 +644,14 @@ namespace egret {
         std::unique_ptr<Matrix> m_concatenatedMatrix;
         std::unique_ptr<Matrix> m_invertedConcatenatedMatrix;
         
+        // 世界矩阵缓存校验（版本号）
+        uint32_t m_transformVersion = 0;                // 本地变换或父节点变化时递增
+        uint32_t m_worldVersion = 0;                    // 世界矩阵每次重算时递增
+        uint32_t m_worldSelfVersion = 0;                // 世界矩阵对应的m_transformVersion
+        uint32_t m_worldParentVersion = 0;              // 世界矩阵对应的父节点m_worldVersion
+        uint32_t m_worldCheckedEpoch = 0;               // 最近一次校验时的全局变换纪元
+        uint32_t m_invertedWorldVersion = 0;            // 逆矩阵对应的m_worldVersion
+        
         // 显示效果
         Rectangle* m_scrollRect = nullptr;
         int m_blendMode = 0;
@@ -472,6 +663,17 @@ namespace egret {
         bool m_cacheDirty = false;
         bool m_renderDirty = false;
         
+        // 子树边界缓存（m_subtreeBoundsDirty为true时祖先也一定为true）
+        Rectangle m_subtreeBounds;
+        bool m_subtreeBoundsDirty = true;
+        static uint32_t s_boundsRecomputeCount;
+        
+        // 帧回调列表中的位置（下标0为ENTER_FRAME，1为RENDER；-1表示未注册）
+        int m_frameCallbackIndex[2] = {-1, -1};
+        
+        // 插值状态列表中的位置（-1表示未开启插值）
+        int m_interpolationIndex = -1;
+        
         // 渲染相关
         std::shared_ptr<sys::RenderNode> m_renderNode;
         
@@ -490,6 +692,43 @@ namespace egret {
          */
         void markMatrixDirty();
         
+        /**
+         * 帧事件类型对应的回调列表下标，非帧事件返回-1
+         */
+        static int frameCallbackKind(const std::string& type);
+        
+        /**
+         * 加入/移出帧回调列表
+         */
+        void registerFrameCallback(int kind);
+        void unregisterFrameCallback(int kind);
+        
+        /**
+         * 向帧回调列表中的对象派发事件
+         */
+        static void broadcastFrameEvent(int kind, const std::string& type);
+        
+        /**
+         * 压缩帧回调列表中已置空的槽位
+         */
+        static void compactFrameCallbacks(int kind);
+        
+        /**
+         * 本地变换或父节点改变：递增自身版本号与全局变换纪元
+         */
+        void bumpTransformVersion();
+        
+        /**
+         * 自身在父容器坐标系中的边界变化：通知父容器的空间索引并使其子树边界失效
+         */
+        void invalidateBoundsInParent();
+        
+        /**
+         * 按版本号校验世界矩阵，只有自身或祖先确实变化时才重算
+         * 全局纪元未变化时直接返回，不遍历父链
+         */
+        void validateWorldMatrix();
+        
         /**
          * 处理属性变更的通用逻辑
          */
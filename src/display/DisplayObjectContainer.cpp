@@ -12,8 +12,20 @@ namespace egret {
     std::vector<DisplayObject*> DisplayObjectContainer::s_eventAddToStageList;
     std::vector<DisplayObject*> DisplayObjectContainer::s_eventRemoveFromStageList;
 
+    namespace {
+        // 静态事件列表的消费位置：派发期间侦听器可能再次增删子对象，嵌套地继续消费同一列表
+        size_t s_addToStageCursor = 0;
+        size_t s_removeFromStageCursor = 0;
+
+        // 子对象少于此数时getChildByName直接线性查找，不建立名称索引
+        constexpr size_t kNameIndexThreshold = 16;
+
+        // 索引缓存失效后，线性查找达到此次数才重新编号
+        constexpr size_t kChildIndexRenumberMisses = 8;
+    }
+
     DisplayObjectContainer::DisplayObjectContainer() : DisplayObject() {
-        // 初始化子对象列表为空
+        setDisplayObjectType(DisplayObjectType::CONTAINER);
     }
 
     // ========== 子对象管理实现 ==========
@@ -55,20 +67,50 @@ namespace egret {
     }
 
     int DisplayObjectContainer::getChildIndex(DisplayObject* child) const {
-        auto it = std::find(m_children.begin(), m_children.end(), child);
-        if (it != m_children.end()) {
+        if (!child || child->getParent() != this) {
+            return -1;
+        }
+        size_t index = static_cast<size_t>(child->getIndexInParentInternal());
+        if (index < m_childIndexValidCount) {
+            return static_cast<int>(index);
+        }
+        // 索引失效后先在连续的指针数组中查找；频繁增删时重新编号会反复写所有子对象，
+        // 查询多次仍未再次失效才整体重新编号，之后的查询都是O(1)
+        if (++m_childIndexMisses < kChildIndexRenumberMisses) {
+            auto it = std::find(m_children.begin() + m_childIndexValidCount, m_children.end(), child);
             return static_cast<int>(std::distance(m_children.begin(), it));
         }
-        return -1;
+        for (size_t i = m_childIndexValidCount; i < m_children.size(); ++i) {
+            m_children[i]->setIndexInParentInternal(static_cast<int>(i));
+        }
+        m_childIndexValidCount = m_children.size();
+        return child->getIndexInParentInternal();
     }
 
     DisplayObject* DisplayObjectContainer::getChildByName(const std::string& name) const {
-        for (DisplayObject* child : m_children) {
-            if (child->getName() == name) {
-                return child;
+        if (m_children.size() < kNameIndexThreshold) {
+            for (DisplayObject* child : m_children) {
+                if (child->getName() == name) {
+                    return child;
+                }
             }
+            return nullptr;
         }
-        return nullptr;
+        if (!m_nameIndex) {
+            m_nameIndex = std::make_unique<std::unordered_map<std::string, DisplayObject*>>();
+            m_nameIndexDirty = true;
+        }
+        if (m_nameIndexDirty) {
+            m_nameIndex->clear();
+            m_nameIndex->reserve(m_children.size());
+            for (DisplayObject* child : m_children) {
+                // emplace不覆盖已有键，同名时保留索引最小的子对象
+                m_nameIndex->emplace(child->getName(), child);
+            }
+            m_nameIndexDirty = false;
+        }
+        auto it = m_nameIndex->find(name);
+        return it != m_nameIndex->end() ? it->second : nullptr;
     }
 
     DisplayObject* DisplayObjectContainer::removeChild(DisplayObject* child) {
@@ -109,87 +151,179 @@ namespace egret {
     }
 
     void DisplayObjectContainer::removeChildren() {
-        while (!m_children.empty()) {
-            doRemoveChild(static_cast<int>(m_children.size()) - 1);
-        }
+        removeChildren(0, INT_MAX);
     }
 
-    // ========== 命中测试实现 ==========
+    void DisplayObjectContainer::addChildren(const std::vector<DisplayObject*>& children) {
+        m_children.reserve(m_children.size() + children.size());
 
-    bool DisplayObjectContainer::hitTestPoint(double x, double y, bool shapeFlag) {
-        if (!getVisible()) {
-            return false;
+        // 来自其他容器的子对象按原容器分组整批移除，每个原容器只派发一轮离开舞台事件
+        std::vector<std::pair<DisplayObjectContainer*, std::vector<DisplayObject*>>> hosts;
+        for (DisplayObject* child : children) {
+            DisplayObjectContainer* host = child ? child->getParent() : nullptr;
+            if (!host || host == this || !canAddChild(child)) {
+                continue;
+            }
+            auto it = std::find_if(hosts.begin(), hosts.end(), [host](const auto& entry) { return entry.first == host; });
+            if (it == hosts.end()) {
+                hosts.push_back({host, {}});
+                it = hosts.end() - 1;
+            }
+            if (std::find(it->second.begin(), it->second.end(), child) == it->second.end()) {
+                it->second.push_back(child);
+            }
         }
-        
-        // 获取反向变换矩阵并转换坐标
-        auto matrix = getInvertedConcatenatedMatrix();
-        double localX = matrix->getA() * x + matrix->getC() * y + matrix->getTx();
-        double localY = matrix->getB() * x + matrix->getD() * y + matrix->getTy();
-        
-        // 检查滚动矩形
-        Rectangle* rect = getScrollRect();
-        if (rect && !rect->contains(localX, localY)) {
-            return false;
+        for (auto& [host, list] : hosts) {
+            host->doRemoveChildren(list);
         }
-        
-        // 检查遮罩
-        DisplayObject* mask = getMask();
-        if (mask && !mask->hitTestPoint(x, y)) {
-            return false;
+
+        std::vector<DisplayObject*> added;
+        added.reserve(children.size());
+        for (DisplayObject* child : children) {
+            if (!canAddChild(child)) {
+                continue;
+            }
+            DisplayObjectContainer* host = child->getParent();
+            if (host == this) {
+                // 已是子对象：与addChild一致，只移到最上层
+                doSetChildIndex(child, static_cast<int>(m_children.size()) - 1);
+                continue;
+            }
+            if (host) {
+                // 移除事件的侦听器又把它放进了其他容器
+                host->removeChild(child);
+            }
+            m_children.push_back(child);
+            child->setParentInternal(this);
+            updateChildIndicesOnInsert(child, m_children.size() - 1);
+            if (m_spatialIndex) {
+                m_spatialIndex->add(child);
+                m_spatialOrderDirty = true;
+            }
+            added.push_back(child);
         }
-        
-        // 检查子对象
-        for (int i = static_cast<int>(m_children.size()) - 1; i >= 0; i--) {
-            DisplayObject* child = m_children[i];
-            if (child->hitTestPoint(x, y, shapeFlag)) {
-                return true;
+        if (added.empty()) {
+            return;
+        }
+
+        // 整批进入舞台，之后统一派发事件
+        Stage* stage = getStage();
+        if (stage) {
+            for (DisplayObject* child : added) {
+                child->onAddToStage(stage, getNestLevel() + 1);
+            }
+        }
+
+        for (DisplayObject* child : added) {
+            auto addedEvent = Event::create(Event::ADDED, true);
+            child->dispatchEvent(*addedEvent);
+            Event::release(addedEvent);
+        }
+        if (stage) {
+            flushAddToStageList(true);
+        }
+
+        setCacheDirty(true);
+        for (DisplayObject* child : added) {
+            int index = getChildIndex(child);
+            if (index >= 0) {
+                onChildAdded(child, index);
             }
         }
-        
-        // 调用父类的命中测试
-        return DisplayObject::hitTestPoint(x, y, shapeFlag);
     }
 
-    DisplayObject* DisplayObjectContainer::hitTest(double stageX, double stageY) {
-        if (!getVisible()) {
-            return nullptr;
+    void DisplayObjectContainer::removeChildren(int beginIndex, int endIndex) {
+        int count = static_cast<int>(m_children.size());
+        beginIndex = std::max(beginIndex, 0);
+        endIndex = std::min(endIndex, count - 1);
+        if (beginIndex > endIndex) {
+            return;
         }
-        
-        // 获取反向变换矩阵并转换坐标
-        auto matrix = getInvertedConcatenatedMatrix();
-        double localX = matrix->getA() * stageX + matrix->getC() * stageY + matrix->getTx();
-        double localY = matrix->getB() * stageX + matrix->getD() * stageY + matrix->getTy();
-        
-        // 检查滚动矩形
-        Rectangle* rect = getScrollRect();
-        if (rect && !rect->contains(localX, localY)) {
+
+        // 派发REMOVED时侦听器可能修改子列表，先取一份待移除对象的快照
+        doRemoveChildren(std::vector<DisplayObject*>(m_children.begin() + beginIndex,
+                                                     m_children.begin() + endIndex + 1));
+    }
+
+    void DisplayObjectContainer::doRemoveChildren(const std::vector<DisplayObject*>& removed) {
+        if (removed.empty()) {
+            return;
+        }
+        for (DisplayObject* child : removed) {
+            onChildRemoved(child, getChildIndex(child));
+        }
+        for (DisplayObject* child : removed) {
+            auto removedEvent = Event::create(Event::REMOVED, true);
+            child->dispatchEvent(*removedEvent);
+            Event::release(removedEvent);
+        }
+
+        // 整批离开舞台，之后统一派发REMOVED_FROM_STAGE
+        if (getStage()) {
+            for (DisplayObject* child : removed) {
+                if (child->getParent() == this) {
+                    child->onRemoveFromStage();
+                }
+            }
+            flushRemoveFromStageList(true);
+        }
+
+        // 仍在本容器中的对象一次性移出子列表；先在断开父级之前查出最小索引，
+        // 断开之后getChildIndex对它们返回-1，重新编号也会写到已移除的对象上
+        size_t firstRemoved = m_children.size();
+        for (DisplayObject* child : removed) {
+            if (child->getParent() == this) {
+                firstRemoved = std::min(firstRemoved, static_cast<size_t>(getChildIndex(child)));
+            }
+        }
+        if (firstRemoved == m_children.size()) {
+            return;
+        }
+        for (DisplayObject* child : removed) {
+            if (child->getParent() != this) {
+                continue;
+            }
+            child->setParentInternal(nullptr);
+            if (m_spatialIndex) {
+                m_spatialIndex->remove(child);
+                m_spatialOrderDirty = true;
+            }
+        }
+        m_children.erase(std::remove_if(m_children.begin() + firstRemoved, m_children.end(),
+                                        [this](DisplayObject* child) { return child->getParent() != this; }),
+                         m_children.end());
+        invalidateChildIndices(firstRemoved);
+        setCacheDirty(true);
+    }
+
+    // ========== 命中测试实现 ==========
+
+    DisplayObject* DisplayObjectContainer::hitTestLocal(double localX, double localY, double stageX, double stageY) {
+        if (!hitTestClip(localX, localY, stageX, stageY)) {
             return nullptr;
         }
         
-        // 检查遮罩
-        DisplayObject* mask = getMask();
-        if (mask && !mask->hitTestPoint(stageX, stageY)) {
+        // 点不在整棵子树的缓存边界内时直接排除
+        if (!getSubtreeBounds().contains(localX, localY)) {
             return nullptr;
         }
         
-        // 从最上层子对象开始测试
+        // 从最上层子对象开始测试，坐标逐级逆变换传递
         bool found = false;
         DisplayObject* target = nullptr;
-        for (int i = static_cast<int>(m_children.size()) - 1; i >= 0; i--) {
-            DisplayObject* child = m_children[i];
-            if (auto childContainer = dynamic_cast<DisplayObjectContainer*>(child)) {
-                target = childContainer->hitTest(stageX, stageY);
-            } else {
-                if (child->hitTestPoint(stageX, stageY)) {
-                    target = child;
+        if (m_spatialIndex) {
+            // 只测试网格单元中的候选对象（已按层级从上到下排列）
+            updateSpatialIndex();
+            m_spatialIndex->query(localX, localY, m_spatialCandidates);
+            for (DisplayObject* child : m_spatialCandidates) {
+                if (hitTestChild(child, localX, localY, stageX, stageY, target, found)) {
+                    break;
                 }
             }
-            if (target) {
-                found = true;
-                if (target->getTouchEnabled()) {
+        } else {
+            for (int i = static_cast<int>(m_children.size()) - 1; i >= 0; i--) {
+                if (hitTestChild(m_children[i], localX, localY, stageX, stageY, target, found)) {
                     break;
-                } else {
-                    target = nullptr;
                 }
             }
         }
@@ -205,8 +339,57 @@ namespace egret {
             return this;
         }
         
-        // 调用父类的命中测试
-        return DisplayObject::hitTestPoint(stageX, stageY) ? this : nullptr;
+        // 测试自身内容（Sprite的Graphics等）
+        return hitTestContent(localX, localY) ? this : nullptr;
+    }
+
+    bool DisplayObjectContainer::hitTestChild(DisplayObject* child, double localX, double localY,
+                                              double stageX, double stageY, DisplayObject*& target, bool& found) {
+        if (!child->getVisibleInternal() || child->isMaskObject()) {
+            return false;
+        }
+        double childX, childY;
+        if (!child->parentToLocal(localX, localY, childX, childY)) {
+            return false;
+        }
+        target = child->hitTestLocal(childX, childY, stageX, stageY);
+        if (target) {
+            found = true;
+            if (target->getTouchEnabled()) {
+                return true;
+            }
+            target = nullptr;
+        }
+        return false;
+    }
+
+    // ========== 空间索引 ==========
+
+    void DisplayObjectContainer::setSpatialIndexEnabled(bool enabled, double cellSize) {
+        if (!enabled) {
+            m_spatialIndex.reset();
+            m_spatialCandidates.clear();
+            m_spatialCandidates.shrink_to_fit();
+            return;
+        }
+        if (m_spatialIndex && m_spatialIndex->getCellSize() == cellSize) {
+            return;
+        }
+        m_spatialIndex = std::make_unique<sys::SpatialGrid>(cellSize);
+        for (DisplayObject* child : m_children) {
+            m_spatialIndex->add(child);
+        }
+        m_spatialOrderDirty = true;
+    }
+
+    void DisplayObjectContainer::updateSpatialIndex() {
+        if (m_spatialOrderDirty) {
+            for (size_t i = 0; i < m_children.size(); i++) {
+                m_spatialIndex->setOrder(m_children[i], static_cast<uint32_t>(i));
+            }
+            m_spatialOrderDirty = false;
+        }
+        m_spatialIndex->update();
     }
 
     // ========== 舞台生命周期管理 ==========
@@ -232,72 +415,54 @@ namespace egret {
 
     // ========== 边界测量 ==========
 
-    void DisplayObjectContainer::measureChildBounds(Rectangle& bounds) const {
+    void DisplayObjectContainer::measureChildBounds(Rectangle& bounds) {
         if (m_children.empty()) {
             return;
         }
         
-        double xMin = 0, xMax = 0, yMin = 0, yMax = 0;
-        bool found = false;
-        
-        // 创建临时矩形
-        Rectangle tempBounds;
+        double xMin = bounds.getLeft(), xMax = bounds.getRight();
+        double yMin = bounds.getTop(), yMax = bounds.getBottom();
+        bool found = !bounds.isEmpty();
         
-        for (int i = -1; i < static_cast<int>(m_children.size()); i++) {
-            Rectangle* childBounds;
-            if (i == -1) {
-                childBounds = &bounds;
-            } else {
-                tempBounds = m_children[i]->getBounds(nullptr, true);
-                // 应用变换矩阵
-                auto childMatrix = m_children[i]->getMatrix();
-                // TODO: 实现矩阵变换边界的功能
-                // childMatrix->transformBounds(tempBounds);
-                childBounds = &tempBounds;
-            }
-            
-            if (childBounds->isEmpty()) {
+        // 子对象边界取自各自的缓存，只有失效的子树才会重新测量
+        Rectangle childBounds;
+        for (DisplayObject* child : m_children) {
+            child->getBoundsInParent(childBounds);
+            if (childBounds.isEmpty()) {
                 continue;
             }
             
             if (found) {
-                xMin = std::min(xMin, childBounds->getX());
-                xMax = std::max(xMax, childBounds->getX() + childBounds->getWidth());
-                yMin = std::min(yMin, childBounds->getY());
-                yMax = std::max(yMax, childBounds->getY() + childBounds->getHeight());
+                xMin = std::min(xMin, childBounds.getLeft());
+                xMax = std::max(xMax, childBounds.getRight());
+                yMin = std::min(yMin, childBounds.getTop());
+                yMax = std::max(yMax, childBounds.getBottom());
             } else {
                 found = true;
-                xMin = childBounds->getX();
-                xMax = xMin + childBounds->getWidth();
-                yMin = childBounds->getY();
-                yMax = yMin + childBounds->getHeight();
+                xMin = childBounds.getLeft();
+                xMax = childBounds.getRight();
+                yMin = childBounds.getTop();
+                yMax = childBounds.getBottom();
             }
         }
         
-        bounds.setTo(xMin, yMin, xMax - xMin, yMax - yMin);
+        if (found) {
+            bounds.setTo(xMin, yMin, xMax - xMin, yMax - yMin);
+        }
+    }
+
+    void DisplayObjectContainer::measureSubtreeBounds(Rectangle& bounds) {
+        measureContentBounds(bounds);
+        measureChildBounds(bounds);
     }
 
     // ========== 私有实现方法 ==========
 
     DisplayObject* DisplayObjectContainer::doAddChild(DisplayObject* child, int index, bool notifyListeners) {
-        if (!child) {
-            return nullptr;
-        }
-        
-        // 检查是否添加自身
-        if (child == this) {
-            // 错误：不能添加自身为子对象
+        if (!canAddChild(child)) {
             return nullptr;
         }
         
-        // 检查是否形成循环引用
-        if (auto container = dynamic_cast<DisplayObjectContainer*>(child)) {
-            if (container->contains(this)) {
-                // 错误：会形成循环引用
-                return nullptr;
-            }
-        }
-        
         DisplayObjectContainer* host = child->getParent();
         if (host == this) {
             doSetChildIndex(child, index);
@@ -311,6 +476,11 @@ namespace egret {
         // 插入到指定位置
         m_children.insert(m_children.begin() + index, child);
         child->setParentInternal(this);
+        updateChildIndicesOnInsert(child, static_cast<size_t>(index));
+        if (m_spatialIndex) {
+            m_spatialIndex->add(child);
+            m_spatialOrderDirty = true;
+        }
         
         // 如果当前容器在舞台上，将子对象添加到舞台
         Stage* stage = getStage();
@@ -327,16 +497,7 @@ namespace egret {
         
         // 处理ADDED_TO_STAGE事件列表
         if (stage) {
-            while (!s_eventAddToStageList.empty()) {
-                DisplayObject* childAddToStage = s_eventAddToStageList.front();
-                s_eventAddToStageList.erase(s_eventAddToStageList.begin());
-                
-                if (childAddToStage->getStage() && notifyListeners) {
-                    auto addedToStageEvent = Event::create(Event::ADDED_TO_STAGE);
-                    childAddToStage->dispatchEvent(*addedToStageEvent);
-                    Event::release(addedToStageEvent);
-                }
-            }
+            flushAddToStageList(notifyListeners);
         }
         
         // 标记缓存为脏
@@ -370,23 +531,19 @@ namespace egret {
             child->onRemoveFromStage();
             
             // 处理REMOVED_FROM_STAGE事件列表
-            while (!s_eventRemoveFromStageList.empty()) {
-                DisplayObject* childRemoveFromStage = s_eventRemoveFromStageList.front();
-                s_eventRemoveFromStageList.erase(s_eventRemoveFromStageList.begin());
-                
-                if (notifyListeners && childRemoveFromStage->getHasAddToStage()) {
-                    auto removedFromStageEvent = Event::create(Event::REMOVED_FROM_STAGE);
-                    childRemoveFromStage->dispatchEvent(*removedFromStageEvent);
-                    Event::release(removedFromStageEvent);
-                }
-            }
+            flushRemoveFromStageList(notifyListeners);
         }
         
-        // 重置父级关系
+        // 重置父级关系（同时清除索引缓存）
         child->setParentInternal(nullptr);
         
         // 从子对象列表中移除
         m_children.erase(m_children.begin() + index);
+        invalidateChildIndices(static_cast<size_t>(index));
+        if (m_spatialIndex) {
+            m_spatialIndex->remove(child);
+            m_spatialOrderDirty = true;
+        }
         
         // 标记缓存为脏
         setCacheDirty(true);
@@ -413,6 +570,8 @@ namespace egret {
         
         // 插入到新位置
         m_children.insert(m_children.begin() + index, child);
+        invalidateChildIndices(static_cast<size_t>(std::min(lastIndex, index)));
+        m_spatialOrderDirty = true;
         
         // 调用子类回调
         onChildAdded(child, index);
@@ -438,6 +597,10 @@ namespace egret {
         // 交换位置
         m_children[index1] = child2;
         m_children[index2] = child1;
+        child2->setIndexInParentInternal(index1);
+        child1->setIndexInParentInternal(index2);
+        m_nameIndexDirty = true;  // 同名子对象的先后可能变化
+        m_spatialOrderDirty = true;
         
         // 调用子类回调
         onChildAdded(child2, index1);
@@ -447,4 +610,75 @@ namespace egret {
         setCacheDirty(true);
     }
 
+    // ========== 索引与事件列表 ==========
+
+    bool DisplayObjectContainer::canAddChild(DisplayObject* child) {
+        if (!child) {
+            return false;
+        }
+        
+        // 检查是否添加自身
+        if (child == this) {
+            // 错误：不能添加自身为子对象
+            return false;
+        }
+        
+        // 检查是否形成循环引用
+        if (child->isContainer()) {
+            if (static_cast<DisplayObjectContainer*>(child)->contains(this)) {
+                // 错误：会形成循环引用
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void DisplayObjectContainer::invalidateChildIndices(size_t index) {
+        m_childIndexValidCount = std::min(m_childIndexValidCount, index);
+        m_childIndexMisses = 0;
+        m_nameIndexDirty = true;
+    }
+
+    void DisplayObjectContainer::updateChildIndicesOnInsert(DisplayObject* child, size_t index) {
+        child->setIndexInParentInternal(static_cast<int>(index));
+        if (index + 1 != m_children.size() || m_childIndexValidCount != index) {
+            // 插入中间时其后的索引都已后移
+            invalidateChildIndices(index);
+            return;
+        }
+        // 追加到末尾且之前的索引都有效：名称索引增量加入
+        m_childIndexValidCount = index + 1;
+        if (m_nameIndex && !m_nameIndexDirty) {
+            m_nameIndex->emplace(child->getName(), child);
+        }
+    }
+
+    void DisplayObjectContainer::flushAddToStageList(bool notifyListeners) {
+        auto& list = s_eventAddToStageList;
+        while (s_addToStageCursor < list.size()) {
+            DisplayObject* childAddToStage = list[s_addToStageCursor++];
+            if (childAddToStage->getStage() && notifyListeners) {
+                auto addedToStageEvent = Event::create(Event::ADDED_TO_STAGE);
+                childAddToStage->dispatchEvent(*addedToStageEvent);
+                Event::release(addedToStageEvent);
+            }
+        }
+        list.clear();
+        s_addToStageCursor = 0;
+    }
+
+    void DisplayObjectContainer::flushRemoveFromStageList(bool notifyListeners) {
+        auto& list = s_eventRemoveFromStageList;
+        while (s_removeFromStageCursor < list.size()) {
+            DisplayObject* childRemoveFromStage = list[s_removeFromStageCursor++];
+            if (notifyListeners && childRemoveFromStage->getHasAddToStage()) {
+                auto removedFromStageEvent = Event::create(Event::REMOVED_FROM_STAGE);
+                childRemoveFromStage->dispatchEvent(*removedFromStageEvent);
+                Event::release(removedFromStageEvent);
+            }
+        }
+        list.clear();
+        s_removeFromStageCursor = 0;
+    }
+
 } // namespace egret
\ No newline at end of file
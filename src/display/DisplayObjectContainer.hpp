@@ -1,8 +1,11 @@
 #pragma once
 #include "DisplayObject.hpp"
+#include "SpatialGrid.hpp"
+#include <climits>
 #include <vector>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 namespace egret {
 
@@ -38,6 +41,13 @@ namespace egret {
          * 将一个 DisplayObject 子实例添加到该 DisplayObjectContainer 实例的指定索引位置
          */
         virtual DisplayObject* addChildAt(DisplayObject* child, int index);
+
+        /**
+         * 批量添加子对象到子列表末尾
+         * 子列表只扩容一次；来自其他容器的子对象按原容器整批移除，整批进入舞台后统一派发ADDED_TO_STAGE；
+         * 与逐个addChild不同，整批的REMOVED事件先于所有ADDED事件，ADDED事件又都先于ADDED_TO_STAGE事件派发
+         */
+        void addChildren(const std::vector<DisplayObject*>& children);
         
         /**
          * 确定指定显示对象是 DisplayObjectContainer 实例的子项或该实例本身
@@ -51,11 +61,13 @@ namespace egret {
         
         /**
          * 返回 DisplayObject 的 child 实例的索引位置
+         * 子对象缓存了自身索引，插入/移除位置之后的索引失效，多次查询后才重新编号
          */
         int getChildIndex(DisplayObject* child) const;
         
         /**
-         * 返回具有指定名称的子显示对象
+         * 返回具有指定名称的子显示对象（同名时返回索引最小的）
+         * 首次查询时建立名称索引，之后追加子对象增量维护，其余结构变化或改名时重建
          */
         DisplayObject* getChildByName(const std::string& name) const;
         
@@ -88,6 +100,11 @@ namespace egret {
          * 从 DisplayObjectContainer 实例的子级列表中删除所有 child DisplayObject 实例
          */
         void removeChildren();
+
+        /**
+         * 删除索引在[beginIndex, endIndex]之间（含两端）的子对象，离开舞台的事件统一派发
+         */
+        void removeChildren(int beginIndex, int endIndex = INT_MAX);
         
         // ========== 触摸控制 ==========
         
@@ -112,14 +129,37 @@ namespace egret {
         // ========== 重写的显示对象方法 ==========
         
         /**
-         * 点碰撞检测 - 重写基类方法以支持容器层次结构
+         * 命中测试 - 子树边界快速排除后，从最上层子对象开始逐个下降
          */
-        bool hitTestPoint(double x, double y, bool shapeFlag = false) override;
+        DisplayObject* hitTestLocal(double localX, double localY, double stageX, double stageY) override;
+        
+        // ========== 空间索引 ==========
         
         /**
-         * 命中测试 - 递归检测子对象
+         * 启用或关闭子对象空间索引（均匀网格）
+         * 适用于直接包含大量子对象的容器（地图格子、背包格、单位等），
+         * 启用后命中测试只检查点所在网格单元中的子对象，开销与子对象数量无关
+         * @param enabled 是否启用
+         * @param cellSize 网格单元边长（本容器坐标），宜接近单个子对象的尺寸
          */
-        DisplayObject* hitTest(double stageX, double stageY);
+        void setSpatialIndexEnabled(bool enabled, double cellSize = 128.0);
+        bool getSpatialIndexEnabled() const { return m_spatialIndex != nullptr; }
+        
+        /**
+         * 子对象在本容器坐标系中的边界变化（内部使用，由DisplayObject调用）
+         */
+        void onChildBoundsChanged(DisplayObject* child) {
+            if (m_spatialIndex) {
+                m_spatialIndex->markDirty(child);
+            }
+        }
+
+        /**
+         * 子对象改名（内部使用，由DisplayObject::setName调用）
+         */
+        void onChildNameChanged() {
+            m_nameIndexDirty = true;
+        }
         
         /**
          * 添加到舞台时的处理 - 重写基类方法
@@ -133,9 +173,14 @@ namespace egret {
         
     protected:
         /**
-         * 测量子对象边界
+         * 测量子对象边界：将各子对象在本容器坐标系中的边界并入bounds
+         */
+        void measureChildBounds(Rectangle& bounds);
+        
+        /**
+         * 测量子树边界：自身内容并上各子对象变换后的子树边界
          */
-        void measureChildBounds(Rectangle& bounds) const;
+        void measureSubtreeBounds(Rectangle& bounds) override;
         
         /**
          * 子项被添加时的回调（可被子类重写）
@@ -158,6 +203,25 @@ namespace egret {
          */
         bool m_touchChildren = true;
         
+        /**
+         * 子对象空间索引（未启用时为空）
+         */
+        std::unique_ptr<sys::SpatialGrid> m_spatialIndex;
+        bool m_spatialOrderDirty = false;
+        std::vector<DisplayObject*> m_spatialCandidates;
+
+        /**
+         * 子对象索引缓存：[0, m_childIndexValidCount) 范围内子对象缓存的索引有效
+         */
+        mutable size_t m_childIndexValidCount = 0;
+        mutable size_t m_childIndexMisses = 0;
+
+        /**
+         * 名称到子对象的索引（首次getChildByName时建立）
+         */
+        mutable std::unique_ptr<std::unordered_map<std::string, DisplayObject*>> m_nameIndex;
+        mutable bool m_nameIndexDirty = false;
+        
         // ========== 私有实现方法 ==========
         
         /**
@@ -169,7 +233,34 @@ namespace egret {
          * 内部移除子对象方法
          */
         DisplayObject* doRemoveChild(int index, bool notifyListeners = true);
+
+        /**
+         * 批量移除子对象：整批派发REMOVED，整批离开舞台后统一派发REMOVED_FROM_STAGE，最后一次性移出子列表
+         * @param removed 待移除的子对象（均为本容器的子对象）；派发期间被侦听器移走的对象会被跳过
+         */
+        void doRemoveChildren(const std::vector<DisplayObject*>& removed);
         
+        /**
+         * 子列表从index位置起发生变化：之后的索引缓存失效，名称索引需要重建
+         */
+        void invalidateChildIndices(size_t index);
+
+        /**
+         * 在index位置插入子对象后更新索引缓存：追加到末尾时增量维护，否则从index起失效
+         */
+        void updateChildIndicesOnInsert(DisplayObject* child, size_t index);
+
+        /**
+         * 校验能否把child加入本容器（非空、非自身、不形成循环）
+         */
+        bool canAddChild(DisplayObject* child);
+
+        /**
+         * 派发待处理的ADDED_TO_STAGE/REMOVED_FROM_STAGE事件，线性消费静态列表
+         */
+        static void flushAddToStageList(bool notifyListeners);
+        static void flushRemoveFromStageList(bool notifyListeners);
+
         /**
          * 内部设置子对象索引方法
          */
@@ -179,6 +270,17 @@ namespace egret {
          * 内部交换子对象方法
          */
         void doSwapChildrenAt(int index1, int index2);
+        
+        /**
+         * 查询前刷新空间索引：重新分桶边界变化的子对象，必要时重排层级序号
+         */
+        void updateSpatialIndex();
+        
+        /**
+         * 测试单个子对象，返回是否应停止遍历
+         */
+        bool hitTestChild(DisplayObject* child, double localX, double localY, double stageX, double stageY,
+                          DisplayObject*& target, bool& found);
     };
 
 } // namespace egret
\ No newline at end of file
@@ -435,7 +435,10 @@ namespace egret {
         // 将舞台坐标转为目标显示对象本地坐标
         Matrix* inv = m_targetDisplay->getInvertedConcatenatedMatrix();
         Point lp = inv->transformPoint(Point(stageX, stageY));
+        return hitTestLocal(lp.getX(), lp.getY()) ? m_targetDisplay : nullptr;
+    }
 
+    bool Graphics::hitTestLocal(double localX, double localY) {
         // 优先使用填充路径进行包含测试
         if (m_renderNode) {
             const auto& drawData = m_renderNode->getDrawData();
@@ -444,8 +447,8 @@ namespace egret {
                 // 仅对有填充的路径进行 contains 判断
                 if (path->hasFill()) {
                     SkPath* skp = path->getSkiaPath();
-                    if (skp && skp->contains(static_cast<SkScalar>(lp.getX()), static_cast<SkScalar>(lp.getY()))) {
-                        return m_targetDisplay;
+                    if (skp && skp->contains(static_cast<SkScalar>(localX), static_cast<SkScalar>(localY))) {
+                        return true;
                     }
                 }
             }
@@ -454,10 +457,7 @@ namespace egret {
         // 回退：使用测量边界做粗略命中
         Rectangle bounds;
         measureContentBounds(bounds);
-        if (bounds.contains(lp.getX(), lp.getY())) {
-            return m_targetDisplay;
-        }
-        return nullptr;
+        return bounds.contains(localX, localY);
     }
 
     // ========== 内部系统方法 ==========
@@ -516,6 +516,7 @@ namespace egret {
         if (m_targetDisplay) {
             m_targetDisplay->setCacheDirty(true);
             m_targetDisplay->cacheDirtyUp();
+            m_targetDisplay->invalidateSubtreeBounds();
         }
     }
 
@@ -222,6 +222,12 @@ namespace egret {
          */
         DisplayObject* hitTest(double stageX, double stageY);
 
+        /**
+         * 以目标显示对象的本地坐标进行点击测试（不再查询逆世界矩阵）
+         * @return 命中填充路径或内容边界时返回true
+         */
+        bool hitTestLocal(double localX, double localY);
+
         // ========== 填充规则 ==========
         /**
          * 设置当前及后续 beginFill 创建的路径为 Even-Odd 填充规则（空心支持）
@@ -11,9 +11,10 @@
 #include "display/BitmapData.hpp"
 #include "geom/Rectangle.hpp"
 #include "geom/Matrix.hpp"
-#include "player/RenderBuffer.hpp"
+#include "player/SkiaRenderBuffer.hpp"
 #include "player/SystemRenderer.hpp"
 #include <algorithm>
+#include <cmath>
 
 namespace egret {
 
@@ -21,9 +22,9 @@ namespace egret {
 
     RenderTexture::RenderTexture() : Texture() {
         // 创建内部渲染缓冲区（对应TypeScript中的this.$renderBuffer = new sys.RenderBuffer();）
-        m_renderBuffer = std::make_shared<sys::RenderBuffer>();
+        m_renderBuffer = sys::createSkiaRenderBuffer();
         
-        // 创建基于RenderBuffer的BitmapData
+        // 创建以RenderBuffer为内容来源的BitmapData
         // 对应TypeScript中的let bitmapData = new egret.BitmapData(this.$renderBuffer.surface);
         auto bitmapData = std::make_shared<BitmapData>(nullptr);
         
@@ -84,13 +85,29 @@ namespace egret {
             height = (bounds->getY() + bounds->getHeight()) * scale;
         }
 
+        int pixelWidth = static_cast<int>(width);
+        int pixelHeight = static_cast<int>(height);
+        if (pixelWidth <= 0 || pixelHeight <= 0) {
+            return false;
+        }
+
         // 调整RenderBuffer大小（对应TypeScript中的renderBuffer.resize(width, height);）
-        m_renderBuffer->resize(static_cast<int>(width), static_cast<int>(height));
-        
-        // 重新创建BitmapData以匹配新尺寸
+        // 尺寸不变时复用现有渲染目标，只清空内容
+        bool sizeChanged = static_cast<int>(m_renderBuffer->getWidth()) != pixelWidth ||
+                           static_cast<int>(m_renderBuffer->getHeight()) != pixelHeight ||
+                           !m_renderBuffer->isValid();
+        if (sizeChanged) {
+            m_renderBuffer->resize(pixelWidth, pixelHeight);
+        } else {
+            m_renderBuffer->clear();
+        }
+
         // 对应TypeScript中的this.$bitmapData.width = width; this.$bitmapData.height = height;
-        auto bitmapData = BitmapData::create(static_cast<int>(width), static_cast<int>(height));
-        setBitmapDataInternal(bitmapData);
+        auto bitmapData = getBitmapData();
+        if (!bitmapData) {
+            bitmapData = std::make_shared<BitmapData>(nullptr);
+            setBitmapDataInternal(bitmapData);
+        }
 
         // 创建变换矩阵（对应TypeScript中的let matrix = Matrix.create();）
         auto matrix = Matrix::create();
@@ -110,10 +127,13 @@ namespace egret {
         // 释放矩阵（对应TypeScript中的Matrix.release(matrix);）
         Matrix::release(matrix);
 
+        // 同步尺寸并递增版本号，使依赖BitmapData版本的缓存失效
+        bitmapData->setRenderBufferSource(m_renderBuffer);
+
         // 设置纹理参数（对应TypeScript中的this.$initData(...)调用）
-        initData(0, 0, static_cast<int>(width), static_cast<int>(height), 
-                 0, 0, static_cast<int>(width), static_cast<int>(height), 
-                 static_cast<int>(width), static_cast<int>(height));
+        initData(0, 0, pixelWidth, pixelHeight, 
+                 0, 0, pixelWidth, pixelHeight, 
+                 pixelWidth, pixelHeight);
 
         return true;
     }
@@ -121,29 +141,46 @@ namespace egret {
     std::vector<int> RenderTexture::getPixel32(int x, int y) const {
         std::vector<int> data;
         
-        if (m_renderBuffer) {
-            // 应用纹理缩放因子
-            // 对应TypeScript中的let scale = $TextureScaleFactor;
-            double textureScaleFactor = TextureScaleFactor;
-            x = static_cast<int>(std::round(x / textureScaleFactor));
-            y = static_cast<int>(std::round(y / textureScaleFactor));
-            
-            // 获取像素数据（对应TypeScript中的data = this.$renderBuffer.getPixels(x, y, 1, 1);）
-            void* pixelData = m_renderBuffer->getPixels(x, y, 1, 1);
-            if (pixelData) {
-                // 将void*转换为uint8_t*并提取RGBA值
-                uint8_t* bytes = static_cast<uint8_t*>(pixelData);
-                data.resize(4);  // RGBA
-                data[0] = bytes[0];  // R
-                data[1] = bytes[1];  // G  
-                data[2] = bytes[2];  // B
-                data[3] = bytes[3];  // A
-            }
+        // 获取像素数据（对应TypeScript中的data = this.$renderBuffer.getPixels(x, y, 1, 1);）
+        uint32_t pixel = 0;
+        if (readPixels(x, y, 1, 1, &pixel)) {
+            data.resize(4);  // RGBA
+            data[0] = static_cast<int>((pixel >> 16) & 0xFF);  // R
+            data[1] = static_cast<int>((pixel >> 8) & 0xFF);   // G
+            data[2] = static_cast<int>(pixel & 0xFF);          // B
+            data[3] = static_cast<int>((pixel >> 24) & 0xFF);  // A
         }
         
         return data;
     }
 
+    std::vector<uint32_t> RenderTexture::getPixels(int x, int y, int width, int height) const {
+        std::vector<uint32_t> pixels;
+        if (width <= 0 || height <= 0) {
+            return pixels;
+        }
+        
+        pixels.resize(static_cast<size_t>(width) * height);
+        if (!readPixels(x, y, width, height, pixels.data())) {
+            pixels.clear();
+        }
+        return pixels;
+    }
+
+    bool RenderTexture::readPixels(int x, int y, int width, int height, uint32_t* dst) const {
+        if (!m_renderBuffer || !dst) {
+            return false;
+        }
+        
+        // 应用纹理缩放因子
+        // 对应TypeScript中的let scale = $TextureScaleFactor;
+        double textureScaleFactor = TextureScaleFactor;
+        x = static_cast<int>(std::round(x / textureScaleFactor));
+        y = static_cast<int>(std::round(y / textureScaleFactor));
+        
+        return m_renderBuffer->readPixels(x, y, width, height, dst, static_cast<size_t>(width) * sizeof(uint32_t));
+    }
+
     void RenderTexture::dispose() {
         // 调用父类dispose方法
         Texture::dispose();
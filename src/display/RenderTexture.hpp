@@ -9,6 +9,7 @@
 #pragma once
 
 #include "display/Texture.hpp"
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -19,6 +20,7 @@ class DisplayObject;
 class Rectangle;
 namespace sys {
     class RenderBuffer;
+    class SkiaRenderBuffer;
 }
 
 /**
@@ -52,6 +54,8 @@ public:
      * 
      * 这是RenderTexture的核心功能。将指定的显示对象及其所有子对象
      * 渲染到这个RenderTexture中。
+     * 渲染目标在多次绘制间复用，尺寸不变时只清空不重建；渲染器直接使用
+     * 目标表面的快照作为纹理内容，不做像素回读。
      * 
      * @param displayObject 需要绘制的显示对象
      * @param clipBounds 绘制矩形区域，为空则使用对象的完整边界
@@ -75,6 +79,32 @@ public:
      */
     std::vector<int> getPixel32(int x, int y) const;
 
+    /**
+     * @brief 批量读取指定区域的像素
+     * 
+     * 一次读取整个区域，替代逐像素调用getPixel32。坐标与getPixel32相同，
+     * 会按纹理缩放因子换算到渲染缓冲区像素。
+     * 
+     * @param x 区域X坐标
+     * @param y 区域Y坐标
+     * @param width 区域宽度（渲染缓冲区像素）
+     * @param height 区域高度（渲染缓冲区像素）
+     * @return 非预乘32位ARGB像素数组（与BitmapData::getPixels格式相同），区域无效时为空
+     */
+    std::vector<uint32_t> getPixels(int x, int y, int width, int height) const;
+
+    /**
+     * @brief 批量读取像素到调用方提供的内存（不分配）
+     * 
+     * @param x 区域X坐标
+     * @param y 区域Y坐标
+     * @param width 区域宽度（渲染缓冲区像素）
+     * @param height 区域高度（渲染缓冲区像素）
+     * @param dst 输出内存，至少width * height个像素，行紧密排列
+     * @return 是否读取成功
+     */
+    bool readPixels(int x, int y, int width, int height, uint32_t* dst) const;
+
     /**
      * @brief 释放纹理资源
      * 
@@ -99,9 +129,9 @@ protected:
      * @brief 内部渲染缓冲区
      * 
      * RenderTexture内部使用的渲染缓冲区，用于实际的离屏渲染。
-     * 对应TypeScript中的$renderBuffer成员。
+     * 对应TypeScript中的$renderBuffer成员。同时作为BitmapData的内容来源。
      */
-    std::shared_ptr<sys::RenderBuffer> m_renderBuffer;
+    std::shared_ptr<sys::SkiaRenderBuffer> m_renderBuffer;
 
 private:
     // 禁用拷贝构造和赋值操作
@@ -8,6 +8,8 @@ namespace egret {
     // ========== 构造和析构 ==========
     
     Shape::Shape() : DisplayObject() {
+        setDisplayObjectType(DisplayObjectType::SHAPE);
+        
         // 创建Graphics对象
         m_graphics = std::make_unique<Graphics>();
         
@@ -30,22 +32,8 @@ namespace egret {
         }
     }
     
-    DisplayObject* Shape::hitTest(double stageX, double stageY) {
-        // 首先调用父类的碰撞检测
-        DisplayObject* target = DisplayObject::hitTest(stageX, stageY);
-        
-        if (target == this) {
-            // 如果基础碰撞检测通过，进一步检测Graphics内容
-            if (m_graphics) {
-                target = m_graphics->hitTest(stageX, stageY);
-                // 如果Graphics碰撞检测失败，返回nullptr
-                if (!target) {
-                    target = nullptr;
-                }
-            }
-        }
-        
-        return target;
+    bool Shape::hitTestContent(double localX, double localY) {
+        return m_graphics && m_graphics->hitTestLocal(localX, localY);
     }
 
     // ========== 生命周期方法 ==========
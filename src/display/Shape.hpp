@@ -46,16 +46,13 @@ namespace egret {
          * @param bounds 边界矩形，用于接收测量结果
          */
         void measureContentBounds(Rectangle& bounds) override;
-        
-        /**
-         * 碰撞检测
-         * @param stageX 舞台X坐标
-         * @param stageY 舞台Y坐标
-         * @return 碰撞的显示对象，如果没有碰撞返回nullptr
-         */
-        DisplayObject* hitTest(double stageX, double stageY) override;
 
     protected:
+        /**
+         * 内容碰撞检测：测试Graphics绘图内容
+         */
+        bool hitTestContent(double localX, double localY) override;
+        
         // ========== 生命周期方法 ==========
         
         /**
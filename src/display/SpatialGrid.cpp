@@ -0,0 +1,155 @@
+#include "display/SpatialGrid.hpp"
+#include "display/DisplayObject.hpp"
+#include "geom/Rectangle.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace egret {
+namespace sys {
+
+    SpatialGrid::SpatialGrid(double cellSize)
+        : m_cellSize(cellSize > 0.0 ? cellSize : 128.0)
+        , m_invCellSize(1.0 / m_cellSize) {
+    }
+
+    void SpatialGrid::add(DisplayObject* object) {
+        auto result = m_entries.try_emplace(object);
+        Entry& entry = result.first->second;
+        if (result.second) {
+            entry.object = object;
+            entry.order = static_cast<uint32_t>(m_entries.size() - 1);
+            m_dirty.push_back(&entry);
+        } else {
+            markDirty(object);
+        }
+    }
+
+    void SpatialGrid::remove(DisplayObject* object) {
+        auto it = m_entries.find(object);
+        if (it == m_entries.end()) {
+            return;
+        }
+        Entry* entry = &it->second;
+        unlink(*entry);
+        if (entry->dirty) {
+            m_dirty.erase(std::remove(m_dirty.begin(), m_dirty.end(), entry), m_dirty.end());
+        }
+        m_entries.erase(it);
+    }
+
+    void SpatialGrid::clear() {
+        m_entries.clear();
+        m_cells.clear();
+        m_large.clear();
+        m_dirty.clear();
+    }
+
+    void SpatialGrid::markDirty(DisplayObject* object) {
+        auto it = m_entries.find(object);
+        if (it == m_entries.end() || it->second.dirty) {
+            return;
+        }
+        it->second.dirty = true;
+        m_dirty.push_back(&it->second);
+    }
+
+    void SpatialGrid::setOrder(DisplayObject* object, uint32_t order) {
+        auto it = m_entries.find(object);
+        if (it != m_entries.end()) {
+            it->second.order = order;
+        }
+    }
+
+    void SpatialGrid::update() {
+        if (m_dirty.empty()) {
+            return;
+        }
+        Rectangle bounds;
+        for (Entry* entry : m_dirty) {
+            entry->object->getBoundsInParent(bounds);
+            unlink(*entry);
+            link(*entry, bounds);
+            entry->dirty = false;
+        }
+        m_dirty.clear();
+    }
+
+    void SpatialGrid::query(double x, double y, std::vector<DisplayObject*>& result) const {
+        result.clear();
+        
+        // 单元内对象与大对象合并后按层级排序
+        static thread_local std::vector<const Entry*> candidates;
+        candidates.clear();
+        auto it = m_cells.find(cellKey(toCell(x), toCell(y)));
+        if (it != m_cells.end()) {
+            candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+        }
+        candidates.insert(candidates.end(), m_large.begin(), m_large.end());
+        
+        std::sort(candidates.begin(), candidates.end(), [](const Entry* a, const Entry* b) {
+            return a->order > b->order;
+        });
+        for (const Entry* entry : candidates) {
+            result.push_back(entry->object);
+        }
+    }
+
+    int SpatialGrid::toCell(double value) const {
+        double cell = std::floor(value * m_invCellSize);
+        constexpr double limit = static_cast<double>(std::numeric_limits<int>::max() / 2);
+        return static_cast<int>(std::clamp(cell, -limit, limit));
+    }
+
+    void SpatialGrid::unlink(Entry& entry) {
+        if (entry.large) {
+            m_large.erase(std::find(m_large.begin(), m_large.end(), &entry));
+            entry.large = false;
+        } else {
+            for (int cy = entry.minY; cy <= entry.maxY; ++cy) {
+                for (int cx = entry.minX; cx <= entry.maxX; ++cx) {
+                    auto it = m_cells.find(cellKey(cx, cy));
+                    if (it == m_cells.end()) {
+                        continue;
+                    }
+                    auto& list = it->second;
+                    auto pos = std::find(list.begin(), list.end(), &entry);
+                    if (pos != list.end()) {
+                        *pos = list.back();
+                        list.pop_back();
+                    }
+                    if (list.empty()) {
+                        m_cells.erase(it);
+                    }
+                }
+            }
+        }
+        entry.maxX = entry.minX - 1;
+        entry.maxY = entry.minY - 1;
+    }
+
+    void SpatialGrid::link(Entry& entry, const Rectangle& bounds) {
+        // 空边界不可能被命中，不放入任何单元
+        if (bounds.isEmpty()) {
+            return;
+        }
+        entry.minX = toCell(bounds.getLeft());
+        entry.minY = toCell(bounds.getTop());
+        entry.maxX = toCell(bounds.getRight());
+        entry.maxY = toCell(bounds.getBottom());
+        
+        int64_t cellCount = static_cast<int64_t>(entry.maxX - entry.minX + 1) * (entry.maxY - entry.minY + 1);
+        if (cellCount > kMaxCellsPerEntry) {
+            entry.large = true;
+            m_large.push_back(&entry);
+            return;
+        }
+        for (int cy = entry.minY; cy <= entry.maxY; ++cy) {
+            for (int cx = entry.minX; cx <= entry.maxX; ++cx) {
+                m_cells[cellKey(cx, cy)].push_back(&entry);
+            }
+        }
+    }
+
+} // namespace sys
+} // namespace egret
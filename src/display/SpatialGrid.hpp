@@ -0,0 +1,98 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace egret {
+    class DisplayObject;  // 前向声明
+    class Rectangle;
+namespace sys {
+
+    /**
+     * 均匀网格空间索引 - 按子对象在容器坐标系中的边界分桶，用于大量子对象的命中测试
+     * 边界延迟计算：新增或标记变化的对象在下次查询前统一重新分桶
+     */
+    class SpatialGrid {
+    public:
+        /**
+         * @param cellSize 网格单元边长（容器本地坐标）
+         */
+        explicit SpatialGrid(double cellSize = 128.0);
+        
+        /**
+         * 网格单元边长
+         */
+        double getCellSize() const { return m_cellSize; }
+        
+        /**
+         * 已索引的对象数量
+         */
+        size_t size() const { return m_entries.size(); }
+        
+        /**
+         * 新增对象，边界在下次update时计算
+         */
+        void add(DisplayObject* object);
+        
+        /**
+         * 移除对象
+         */
+        void remove(DisplayObject* object);
+        
+        /**
+         * 清空索引
+         */
+        void clear();
+        
+        /**
+         * 标记对象边界已变化（未索引的对象忽略）
+         */
+        void markDirty(DisplayObject* object);
+        
+        /**
+         * 设置对象的层级序号（越大越靠上）
+         */
+        void setOrder(DisplayObject* object, uint32_t order);
+        
+        /**
+         * 重新计算所有已标记对象的边界并调整所在单元
+         */
+        void update();
+        
+        /**
+         * 查询边界可能包含该点的对象，结果按层级从上到下排列
+         * 调用前需保证已执行update
+         */
+        void query(double x, double y, std::vector<DisplayObject*>& result) const;
+        
+    private:
+        struct Entry {
+            DisplayObject* object = nullptr;
+            uint32_t order = 0;
+            int minX = 0, minY = 0, maxX = -1, maxY = -1;  // 所占单元范围，max < min 表示不在任何单元中
+            bool large = false;                             // 覆盖单元过多，放入m_large
+            bool dirty = true;
+        };
+        
+        // 单个对象最多占用的单元数量，超过则作为大对象单独存放
+        static constexpr int kMaxCellsPerEntry = 64;
+        
+        static uint64_t cellKey(int cx, int cy) {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy);
+        }
+        
+        int toCell(double value) const;
+        void unlink(Entry& entry);
+        void link(Entry& entry, const Rectangle& bounds);
+        
+        double m_cellSize;
+        double m_invCellSize;
+        std::unordered_map<DisplayObject*, Entry> m_entries;      // 节点地址稳定，单元中直接存Entry指针
+        std::unordered_map<uint64_t, std::vector<Entry*>> m_cells;
+        std::vector<Entry*> m_large;
+        std::vector<Entry*> m_dirty;
+    };
+
+} // namespace sys
+} // namespace egret
@@ -16,6 +16,8 @@ namespace egret {
     // ========== 构造函数和析构函数 ==========
 
     Sprite::Sprite() : DisplayObjectContainer() {
+        setDisplayObjectType(DisplayObjectType::SPRITE);
+        
         // 创建Graphics对象（对应TypeScript中的this.$graphics = new Graphics();）
         m_graphics = std::make_shared<Graphics>();
         
@@ -36,91 +38,9 @@ namespace egret {
         return m_graphics.get();
     }
 
-    DisplayObject* Sprite::hitTest(double stageX, double stageY) {
-        // 检查可见性（对应TypeScript中的if (!this.$visible)）
-        if (!getVisible()) {
-            return nullptr;
-        }
-
-        // 获取逆变换矩阵，将舞台坐标转换为本地坐标
-        // 对应TypeScript中的let m = this.$getInvertedConcatenatedMatrix();
-        auto invertMatrix = getInvertedConcatenatedMatrix();
-        double localX = invertMatrix->getA() * stageX + invertMatrix->getC() * stageY + invertMatrix->getTx();
-        double localY = invertMatrix->getB() * stageX + invertMatrix->getD() * stageY + invertMatrix->getTy();
-
-        // 检查滚动矩形
-        // 对应TypeScript中的let rect = this.$scrollRect ? this.$scrollRect : this.$maskRect;
-        Rectangle* rect = getScrollRect();
-        if (rect && !rect->contains(localX, localY)) {
-            return nullptr;
-        }
-
-        // 检查遮罩对象
-        // 对应TypeScript中的if (this.$mask && !this.$mask.$hitTest(stageX, stageY))
-        DisplayObject* mask = getMask();
-        if (mask && !mask->hitTestPoint(stageX, stageY)) {
-            return nullptr;
-        }
-
-        // 测试子对象（从最上层开始）
-        // 对应TypeScript中的let children = this.$children; for (let i = children.length - 1; i >= 0; i--)
-        bool found = false;
-        DisplayObject* target = nullptr;
-        
-        for (int i = getNumChildren() - 1; i >= 0; i--) {
-            DisplayObject* child = getChildAt(i);
-            
-            // 跳过被遮罩的对象 - 由于C++中getMaskedObject是protected，这里简化处理
-            // 对应TypeScript中的if (child.$maskedObject) { continue; }
-            // 在C++实现中，我们可以通过其他方式检查或者暂时跳过这个检查
-            
-            // 递归测试子对象
-            // 对应TypeScript中的target = child.$hitTest(stageX, stageY);
-            if (auto childContainer = dynamic_cast<DisplayObjectContainer*>(child)) {
-                target = childContainer->hitTest(stageX, stageY);
-            } else {
-                target = child->hitTestPoint(stageX, stageY) ? child : nullptr;
-            }
-            
-            if (target) {
-                found = true;
-                // 检查是否可触摸
-                // 对应TypeScript中的if(target.$touchEnabled){ break; } else{ target = null; }
-                if (target->getTouchEnabled()) {
-                    break;
-                } else {
-                    target = nullptr;
-                }
-            }
-        }
-
-        // 如果找到了子对象
-        if (target) {
-            // 对应TypeScript中的if (this.$touchChildren) { return target; } return this;
-            if (getTouchChildren()) {
-                return target;
-            }
-            return this;
-        }
-
-        // 如果找到了子对象但不可触摸
-        // 对应TypeScript中的if (found) { return this; }
-        if (found) {
-            return this;
-        }
-
-        // 测试自身（调用父类的命中测试）
-        // 对应TypeScript中的target = DisplayObject.prototype.$hitTest.call(this, stageX, stageY);
-        bool parentHitTest = DisplayObject::hitTestPoint(stageX, stageY);
-        if (parentHitTest) {
-            // 测试Graphics绘图内容
-            // 对应TypeScript中的target = this.$graphics.$hitTest(stageX, stageY);
-            target = m_graphics->hitTest(stageX, stageY);
-        } else {
-            target = nullptr;
-        }
-
-        return target;
+    bool Sprite::hitTestContent(double localX, double localY) {
+        // 对应TypeScript中的target = this.$graphics.$hitTest(stageX, stageY);
+        return m_graphics && m_graphics->hitTestLocal(localX, localY);
     }
 
     void Sprite::onRemoveFromStage() {
@@ -50,21 +50,6 @@ public:
      */
     Graphics* getGraphics() const;
 
-    /**
-     * @brief 命中测试 - 检测点击位置是否在显示对象内
-     * 
-     * 重写DisplayObjectContainer的命中测试方法，加入Graphics绘图内容的命中测试。
-     * 测试顺序：
-     * 1. 检查基本可见性和边界
-     * 2. 递归测试所有子对象（从最上层开始）
-     * 3. 如果子对象未命中，则测试自身的Graphics绘图内容
-     * 
-     * @param stageX 舞台X坐标
-     * @param stageY 舞台Y坐标
-     * @return DisplayObject* 命中的显示对象，未命中返回nullptr
-     */
-    DisplayObject* hitTest(double stageX, double stageY);
-
     /**
      * @brief 从舞台移除时的清理操作
      * 
@@ -73,6 +58,18 @@ public:
     void onRemoveFromStage();
 
 protected:
+    /**
+     * @brief 内容命中测试
+     * 
+     * 子对象均未命中时，由DisplayObjectContainer::hitTestLocal调用，
+     * 使用本地坐标测试Graphics绘图内容。
+     * 
+     * @param localX 本地X坐标
+     * @param localY 本地Y坐标
+     * @return bool 是否命中Graphics内容
+     */
+    bool hitTestContent(double localX, double localY) override;
+
     /**
      * @brief 测量内容边界
      * 
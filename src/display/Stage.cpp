@@ -1,6 +1,7 @@
 #include "Stage.hpp"
 #include "events/Event.hpp"
 #include "sys/Screen.hpp"
+#include "sys/TouchHandler.hpp"
 #include "display/DisplayList.hpp"
 #include "player/RenderBuffer.hpp"
 #include "player/SystemTicker.hpp"
@@ -14,14 +15,20 @@ namespace egret {
     double Stage::s_globalFrameRate = 30.0;
 
     Stage::Stage() : DisplayObjectContainer() {
+        setDisplayObjectType(DisplayObjectType::STAGE);
+        
         // 舞台自己就在舞台上，且是根节点
         m_hasAddToStage = true;
         m_nestLevel = 1;
         
         // Stage自己是Stage引用
         m_stage = this;
+
+        m_touchHandler = std::make_unique<sys::TouchHandler>(this);
     }
 
+    Stage::~Stage() = default;
+
     // ========== 帧率控制实现 ==========
 
     void Stage::setFrameRate(double value) {
@@ -94,6 +101,8 @@ namespace egret {
 
     void Stage::invalidate() {
         m_invalidateRenderFlag = true;
+        // 通知心跳在下一次渲染前广播RENDER事件
+        sys::invalidateRenderFlag = true;
     }
 
     // ========== 绘制方法实现 ==========
@@ -165,6 +174,12 @@ namespace egret {
         EGRET_DEBUG("Finished");
     }
 
+    uint32_t Stage::takeBoundsRecomputeCount() {
+        uint32_t count = m_boundsRecomputeCount;
+        m_boundsRecomputeCount = 0;
+        return count;
+    }
+
     void Stage::resize(double width, double height) {
         // 优先交由Screen处理，以应用scaleMode/showAll/noScale等逻辑
         if (m_screen) {
@@ -192,6 +207,7 @@ namespace egret {
     }
 
     void Stage::updateMaxTouches() {
+        m_touchHandler->initMaxTouches();
         if (m_screen) {
             m_screen->updateMaxTouches();
         }
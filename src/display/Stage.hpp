@@ -2,6 +2,7 @@
 #include "DisplayObjectContainer.hpp"
 #include <string>
 #include <functional>
+#include <memory>
 
 namespace egret {
 
@@ -9,6 +10,7 @@ namespace egret {
     namespace sys {
         class Screen;
         class DisplayList;
+        class TouchHandler;
     }
 
     /**
@@ -40,7 +42,7 @@ namespace egret {
     class Stage : public DisplayObjectContainer {
     public:
         Stage();
-        virtual ~Stage() = default;
+        virtual ~Stage();
         
         // ========== 帧率控制 ==========
         
@@ -130,6 +132,11 @@ namespace egret {
          */
         int getMaxTouches() const { return m_maxTouches; }
         void setMaxTouches(int value);
+
+        /**
+         * 触摸处理器：记录各触摸点按下时的目标，输入层通过它派发触摸事件
+         */
+        sys::TouchHandler* getTouchHandler() const { return m_touchHandler.get(); }
         
         // ========== 内容尺寸 ==========
         
@@ -205,6 +212,18 @@ namespace egret {
          */
         void buildRenderContent();
         
+        // ========== 统计 ==========
+        
+        /**
+         * 本舞台上子树边界重算次数（只统计舞台上的对象，多个Player互不影响）
+         */
+        uint32_t getBoundsRecomputeCount() const { return m_boundsRecomputeCount; }
+        
+        /**
+         * 取出并清零本舞台的子树边界重算次数（每帧调用一次即得到每帧重算次数）
+         */
+        uint32_t takeBoundsRecomputeCount();
+        
         // ========== 重写父类方法 ==========
         
         /**
@@ -238,10 +257,15 @@ namespace egret {
         // 纹理和触摸
         double m_textureScaleFactor = 1.0;
         int m_maxTouches = 99;
+        std::unique_ptr<sys::TouchHandler> m_touchHandler;
         
         // 渲染控制
         bool m_invalidateRenderFlag = false;
         
+        // 统计（DisplayObject在重算子树边界时累加）
+        friend class DisplayObject;
+        uint32_t m_boundsRecomputeCount = 0;
+        
         // 系统引用
         sys::Screen* m_screen = nullptr;
         std::shared_ptr<sys::DisplayList> m_displayList = nullptr;  // 显示列表渲染系统
@@ -34,7 +34,6 @@ namespace egret {
     const std::string Event::SOUND_COMPLETE = "soundComplete";
     
     // 静态成员变量定义
-    std::vector<std::shared_ptr<Event>> Event::s_eventPool;
     std::unordered_map<std::string, std::unordered_map<std::string, std::any>> Event::s_propertyData;
     
     // ========== 构造函数实现 ==========
@@ -42,11 +41,13 @@ namespace egret {
     Event::Event(const std::string& type, bool bubbles, bool cancelable, const std::any& data)
         : HashObject()
         , m_type(type)
+        , m_typeId(EventTypeRegistry::intern(type))
         , m_bubbles(bubbles)
         , m_cancelable(cancelable)
         , m_eventPhase(EventPhase::AT_TARGET)
         , m_currentTarget(nullptr)
         , m_target(nullptr)
+        , m_targetDisplayObject(nullptr)
         , m_isDefaultPrevented(false)
         , m_isPropagationStopped(false)
         , m_isPropagationImmediateStopped(false)
@@ -87,45 +88,43 @@ namespace egret {
         data = std::any();
         m_currentTarget = std::any();
         setTarget(std::any());
+        m_targetDisplayObject = nullptr;
     }
     
     // ========== 静态工厂方法和对象池实现 ==========
     
-    std::shared_ptr<Event> Event::create(const std::string& type, bool bubbles, bool cancelable) {
-        // 尝试从对象池中获取可用的事件对象
-        if (!s_eventPool.empty()) {
-            auto event = s_eventPool.back();
-            s_eventPool.pop_back();
-            
-            // 重置事件对象的状态
-            event->m_type = type;
-            event->m_bubbles = bubbles;
-            event->m_cancelable = cancelable;
-            event->m_isDefaultPrevented = false;
-            event->m_isPropagationStopped = false;
-            event->m_isPropagationImmediateStopped = false;
-            event->m_eventPhase = EventPhase::AT_TARGET;
-            event->m_currentTarget = std::any();
-            event->m_target = std::any();
-            event->data = std::any();
-            
-            return event;
+    namespace {
+        EventPool<Event>& eventPool() {
+            static EventPool<Event> pool("Event", 64);
+            return pool;
         }
-        
-        // 如果对象池为空，创建新的事件对象
-        return std::make_shared<Event>(type, bubbles, cancelable);
+    }
+    
+    void Event::reinit(const std::string& type, bool bubbles, bool cancelable) {
+        m_type = type;
+        m_typeId = EventTypeRegistry::intern(type);
+        m_bubbles = bubbles;
+        m_cancelable = cancelable;
+        m_isDefaultPrevented = false;
+        m_isPropagationStopped = false;
+        m_isPropagationImmediateStopped = false;
+        m_eventPhase = EventPhase::AT_TARGET;
+        m_currentTarget = std::any();
+        m_target = std::any();
+        m_targetDisplayObject = nullptr;
+        data = std::any();
+    }
+    
+    std::shared_ptr<Event> Event::create(const std::string& type, bool bubbles, bool cancelable) {
+        return eventPool().acquire(type, bubbles, cancelable);
     }
     
     void Event::release(std::shared_ptr<Event> event) {
-        if (!event) {
-            return;
-        }
-        
-        // 调用清理方法
-        event->clean();
-        
-        // 将事件对象放回对象池
-        s_eventPool.push_back(event);
+        eventPool().release(std::move(event));
+    }
+    
+    const EventPoolStats& Event::getPoolStats() {
+        return eventPool().getStats();
     }
     
     bool Event::dispatchEvent(IEventDispatcher* target, const std::string& type, bool bubbles, const std::any& data) {
@@ -10,12 +10,15 @@
 #include <functional>
 #include <unordered_map>
 #include "events/EventPhase.hpp"
+#include "events/EventType.hpp"
+#include "events/EventPool.hpp"
 #include "core/HashObject.hpp"
 
 namespace egret
 {
     // 前向声明
     class IEventDispatcher;
+    class DisplayObject;
     
     /**
      * Event类是创建事件实例的基类，当发生事件时，Event实例将作为参数传递给事件侦听器。
@@ -93,6 +96,11 @@ namespace egret
          */
         const std::string& getType() const { return m_type; }
         
+        /**
+         * 事件类型的驻留ID（构造时计算，用于侦听器表查找）
+         */
+        EventTypeId getTypeId() const { return m_typeId; }
+        
         /**
          * 表示事件是否为冒泡事件。如果事件可以冒泡，则此值为true；否则为false
          */
@@ -122,6 +130,11 @@ namespace egret
          */
         const std::any& getTarget() const { return m_target; }
         
+        /**
+         * 事件目标为显示对象时的类型化指针，否则为nullptr（无需any_cast）
+         */
+        DisplayObject* getTargetDisplayObject() const { return m_targetDisplayObject; }
+        
         // ========== 事件控制方法 ==========
         
         /**
@@ -169,6 +182,11 @@ namespace egret
          */
         virtual bool setTarget(const std::any& target);
         
+        /**
+         * 设置类型化的显示对象目标（内部使用，由EventDispatcher在派发时与setTarget一同设置）
+         */
+        void setTargetDisplayObject(DisplayObject* target) { m_targetDisplayObject = target; }
+        
         /**
          * 设置当前目标（内部使用）
          * @param currentTarget 当前处理事件的对象
@@ -203,6 +221,11 @@ namespace egret
          */
         static void release(std::shared_ptr<Event> event);
         
+        /**
+         * 获取Event对象池的统计信息
+         */
+        static const EventPoolStats& getPoolStats();
+        
         /**
          * 使用指定的EventDispatcher对象来抛出Event事件对象
          * 抛出的对象将会缓存在对象池上，供下次循环复用
@@ -231,24 +254,61 @@ namespace egret
         virtual void clean();
         
     private:
+        template <typename T> friend class EventPool;
+        
+        /**
+         * 按新的类型重置基类状态（对象池复用时调用）
+         */
+        void reinit(const std::string& type, bool bubbles, bool cancelable);
+        
         // ========== 私有成员变量 ==========
         
         std::string m_type;                           // 事件类型
+        EventTypeId m_typeId;                        // 事件类型驻留ID
         bool m_bubbles;                              // 是否冒泡
         bool m_cancelable;                           // 是否可取消
         EventPhase m_eventPhase;                     // 事件阶段
         std::any m_currentTarget;                    // 当前目标
         std::any m_target;                          // 事件目标
+        DisplayObject* m_targetDisplayObject;        // 显示对象目标（类型化）
         bool m_isDefaultPrevented;                   // 是否已阻止默认行为
         bool m_isPropagationStopped;                 // 是否已停止传播
         bool m_isPropagationImmediateStopped;        // 是否已立即停止传播
         
         // ========== 静态成员变量 ==========
         
-        /** 事件对象池 */
-        static std::vector<std::shared_ptr<Event>> s_eventPool;
-        
         /** 属性数据映射（用于对象池复用时的属性存储） */
         static std::unordered_map<std::string, std::unordered_map<std::string, std::any>> s_propertyData;
     };
+
+    // ========== EventPool模板实现（需要完整的Event定义） ==========
+
+    template <typename T>
+    std::shared_ptr<T> EventPool<T>::acquire(const std::string& type, bool bubbles, bool cancelable) {
+        if (m_free.empty()) {
+            ++m_stats.created;
+            return std::make_shared<T>(type, bubbles, cancelable);
+        }
+        std::shared_ptr<T> event = std::move(m_free.back());
+        m_free.pop_back();
+        m_stats.pooled = m_free.size();
+        ++m_stats.reused;
+        static_cast<Event&>(*event).reinit(type, bubbles, cancelable);
+        return event;
+    }
+
+    template <typename T>
+    void EventPool<T>::release(std::shared_ptr<T> event) {
+        if (!event) {
+            return;
+        }
+        static_cast<Event&>(*event).clean();
+        ++m_stats.released;
+        if (m_free.size() < m_maxSize) {
+            m_free.push_back(std::move(event));
+            m_stats.pooled = m_free.size();
+        } else {
+            ++m_stats.discarded;
+        }
+    }
 } // egret
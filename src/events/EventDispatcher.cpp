@@ -4,6 +4,9 @@
 
 #include "EventDispatcher.hpp"
 
+#include <algorithm>
+#include <utility>
+
 #include "Event.hpp"
 #include "display/DisplayObject.hpp"
 #include "display/DisplayObjectContainer.hpp"
@@ -12,11 +15,62 @@ namespace egret
 {
     std::vector<EventBin> EventDispatcher::s_onceEventList;
 
+    namespace
+    {
+        // 传播路径缓冲区：线程内复用，嵌套派发时在尾部追加并在结束时截回，避免每次派发分配
+        thread_local std::vector<DisplayObject*> t_propagationPath;
+
+        struct PropagationPathScope
+        {
+            size_t begin;
+
+            PropagationPathScope() : begin(t_propagationPath.size()) {}
+            ~PropagationPathScope() { t_propagationPath.resize(begin); }
+        };
+
+        // 正在遍历的侦听器缓冲区（嵌套派发时逐层压入），用于判断修改某个列表前是否需要复制
+        thread_local std::vector<const EventBin*> t_dispatchingBins;
+        // 派发期间被替换下来的旧缓冲区，本线程所有派发结束后统一释放
+        thread_local std::vector<std::vector<EventBin>> t_retiredBins;
+
+        bool isDispatching(const std::vector<EventBin>& bins)
+        {
+            return !bins.empty() &&
+                   std::find(t_dispatchingBins.begin(), t_dispatchingBins.end(), bins.data()) != t_dispatchingBins.end();
+        }
+
+        struct DispatchingScope
+        {
+            explicit DispatchingScope(const EventBin* bins) { t_dispatchingBins.push_back(bins); }
+
+            ~DispatchingScope()
+            {
+                t_dispatchingBins.pop_back();
+                if (t_dispatchingBins.empty())
+                {
+                    t_retiredBins.clear();
+                }
+            }
+        };
+    }
+
 
     EventDispatcher::EventDispatcher(IEventDispatcher* target)
     {
         m_eventDispatcher.eventTarget = target ? target : this;
-        m_eventDispatcher.notifyLevel = 0;
+        m_eventDispatcher.displayObject = nullptr;
+    }
+
+    EventDispatcher::~EventDispatcher()
+    {
+        // 侦听器中销毁了派发器自身时，外层派发仍在遍历其列表，交给派发结束后释放
+        for (auto& entry : m_eventDispatcher.listeners)
+        {
+            if (isDispatching(entry.bins))
+            {
+                t_retiredBins.push_back(std::move(entry.bins));
+            }
+        }
     }
 
     void EventDispatcher::addEventListener(const std::string& type, const EventListener& listener, void* thisObject,
@@ -34,34 +88,32 @@ namespace egret
     void EventDispatcher::removeEventListener(const std::string& type, const EventListener& listener, void* thisObject,
                                               bool useCapture)
     {
-        auto& eventMap = getEventMap(useCapture);
-        auto it = eventMap.find(type);
-        if (it == eventMap.end())
+        // 未驻留的类型不可能有侦听器，不为其分配ID
+        EventTypeId typeId = EventTypeRegistry::find(type);
+        ListenerList* entry = findListenerList(typeId, useCapture);
+        if (!entry)
         {
             return;
         }
 
-        auto& list = it->second;
-        if (m_eventDispatcher.notifyLevel != 0)
-        {
-            // 正在派发事件时，复制列表以避免修改原始列表
-            eventMap[type] = list; // 这里会触发拷贝
-        }
-
+        auto& list = getWritableBins(typeId, useCapture);
         if (removeEventBin(list, listener, thisObject))
         {
             if (list.empty())
             {
-                eventMap.erase(type);
+                removeListenerList(typeId, useCapture);
             }
         }
     }
 
     bool EventDispatcher::hasEventListener(const std::string& type) const
     {
-        auto& eventMap = const_cast<EventDispatcher*>(this)->getEventMap(false);
-        auto& captureEventsMap = const_cast<EventDispatcher*>(this)->getEventMap(true);
-        return eventMap.find(type) != eventMap.end() || captureEventsMap.find(type) != captureEventsMap.end();
+        return hasEventListener(EventTypeRegistry::find(type));
+    }
+
+    bool EventDispatcher::hasEventListener(EventTypeId type) const
+    {
+        return findListenerList(type, false) != nullptr || findListenerList(type, true) != nullptr;
     }
 
     bool EventDispatcher::dispatchEvent(Event& event)
@@ -69,13 +121,8 @@ namespace egret
         // 设置事件目标（首次）
         event.setTarget(m_eventDispatcher.eventTarget);
 
-        // 如果目标是DisplayObject，构建祖先链路以支持 捕获->目标->冒泡
-        DisplayObject* targetDO = nullptr;
-        try {
-            targetDO = std::any_cast<DisplayObject*>(event.getTarget());
-        } catch (...) {
-            targetDO = nullptr;
-        }
+        DisplayObject* targetDO = m_eventDispatcher.displayObject;
+        event.setTargetDisplayObject(targetDO);
 
         if (!targetDO) {
             // 非显示对象，直接在当前dispatcher上触发
@@ -84,22 +131,21 @@ namespace egret
             return notifyListener(event, false);
         }
 
-        // 构建从Stage到目标的祖先链（不含空）
-        std::vector<DisplayObject*> chain;
-        DisplayObject* node = targetDO;
-        while (node) {
-            chain.push_back(node);
-            node = node->getParent();
+        // 构建从目标到Stage的祖先链：[target, parent, ..., stage]
+        // 嵌套派发会继续向缓冲区追加，可能导致重新分配，因此下面只用下标访问
+        PropagationPathScope scope;
+        const size_t begin = scope.begin;
+        for (DisplayObject* node = targetDO; node; node = node->getParent()) {
+            t_propagationPath.push_back(node);
         }
-        // chain: [target, parent, ..., stage]，我们需要从后往前捕获
+        const size_t end = t_propagationPath.size();
 
         // 捕获阶段：stage -> parent（不包括 target）
-        for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
-            DisplayObject* current = *it;
-            if (current == targetDO) break;
+        for (size_t i = end - 1; i > begin; --i) {
+            DisplayObject* current = t_propagationPath[i];
             event.setCurrentTarget(current);
             event.setEventPhase(EventPhase::CAPTURING_PHASE);
-            notifyListener(event, true);
+            static_cast<EventDispatcher*>(current)->notifyListener(event, true);
             if (event.isPropagationStopped() || event.isPropagationImmediateStopped()) {
                 return !event.isDefaultPrevented();
             }
@@ -118,11 +164,11 @@ namespace egret
 
         // 冒泡阶段：从 parent -> stage（仅当事件可冒泡）
         if (event.getBubbles()) {
-            for (size_t i = 1; i < chain.size(); ++i) {
-                DisplayObject* current = chain[i];
+            for (size_t i = begin + 1; i < end; ++i) {
+                DisplayObject* current = t_propagationPath[i];
                 event.setCurrentTarget(current);
                 event.setEventPhase(EventPhase::BUBBLING_PHASE);
-                notifyListener(event, false);
+                static_cast<EventDispatcher*>(current)->notifyListener(event, false);
                 if (event.isPropagationStopped() || event.isPropagationImmediateStopped()) {
                     break;
                 }
@@ -150,32 +196,82 @@ namespace egret
         return true;
     }
 
-    std::map<std::string, std::vector<EventBin>>& EventDispatcher::getEventMap(bool useCapture)
+    EventDispatcher::ListenerList* EventDispatcher::findListenerList(EventTypeId type, bool useCapture)
     {
-        return useCapture ? m_eventDispatcher.captureEventsMap : m_eventDispatcher.eventsMap;
+        return const_cast<ListenerList*>(std::as_const(*this).findListenerList(type, useCapture));
     }
 
-    void EventDispatcher::addListener(const std::string& type, const EventListener& listener, void* thisObject,
-                                      bool useCapture, int priority, bool dispatchOnce)
+    const EventDispatcher::ListenerList* EventDispatcher::findListenerList(EventTypeId type, bool useCapture) const
+    {
+        if (type == EventTypes::INVALID)
+        {
+            return nullptr;
+        }
+        for (const auto& entry : m_eventDispatcher.listeners)
+        {
+            if (entry.type == type && entry.useCapture == useCapture)
+            {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    std::vector<EventBin>& EventDispatcher::getWritableBins(EventTypeId type, bool useCapture)
     {
-        auto& eventMap = getEventMap(useCapture);
-        auto& list = eventMap[type];
+        ListenerList* entry = findListenerList(type, useCapture);
+        if (!entry)
+        {
+            auto& listeners = m_eventDispatcher.listeners;
+            if (listeners.empty())
+            {
+                listeners.reserve(2);
+            }
+            listeners.push_back({type, useCapture, {}});
+            return listeners.back().bins;
+        }
+
+        // 列表正在被派发遍历时，复制一份再修改，旧缓冲区留给遍历方（对应TypeScript中派发期间的 list.concat()）
+        if (isDispatching(entry->bins))
+        {
+            std::vector<EventBin> copy = entry->bins;
+            t_retiredBins.push_back(std::move(entry->bins));
+            entry->bins = std::move(copy);
+        }
+        return entry->bins;
+    }
 
-        // 正在派发期间，为该类型的监听列表做一次性拷贝，避免边派发边修改产生迭代风险
-        if (m_eventDispatcher.notifyLevel != 0)
+    void EventDispatcher::removeListenerList(EventTypeId type, bool useCapture)
+    {
+        auto& listeners = m_eventDispatcher.listeners;
+        for (size_t i = 0; i < listeners.size(); ++i)
         {
-            auto& clonedSet = useCapture ? m_eventDispatcher.clonedCaptureTypes : m_eventDispatcher.clonedTypes;
-            if (clonedSet.find(type) == clonedSet.end()) {
-                auto copy = list; // 拷贝一份
-                list = std::move(copy);
-                clonedSet.insert(type);
+            if (listeners[i].type == type && listeners[i].useCapture == useCapture)
+            {
+                listeners[i] = std::move(listeners.back());
+                listeners.pop_back();
+                break;
             }
         }
+        if (listeners.empty())
+        {
+            listeners.shrink_to_fit();
+        }
+    }
 
-        insertEventBin(list, type, listener, thisObject, useCapture, priority, dispatchOnce);
+    void EventDispatcher::addListener(const std::string& type, const EventListener& listener, void* thisObject,
+                                      bool useCapture, int priority, bool dispatchOnce)
+    {
+        EventTypeId typeId = EventTypeRegistry::intern(type);
+        if (typeId == EventTypes::INVALID)
+        {
+            return;
+        }
+        auto& list = getWritableBins(typeId, useCapture);
+        insertEventBin(list, typeId, listener, thisObject, useCapture, priority, dispatchOnce);
     }
 
-    bool EventDispatcher::insertEventBin(std::vector<EventBin>& list, const std::string& type,
+    bool EventDispatcher::insertEventBin(std::vector<EventBin>& list, EventTypeId type,
                                          const EventListener& listener, void* thisObject, bool useCapture, int priority,
                                          bool dispatchOnce)
     {
@@ -218,50 +314,40 @@ namespace egret
 
     bool EventDispatcher::notifyListener(Event& event, bool capturePhase)
     {
-        auto& eventMap = getEventMap(capturePhase);
-        auto it = eventMap.find(event.getType());
-        if (it == eventMap.end())
-        {
-            return true;
-        }
-
-        const auto& list = it->second;
-        if (list.empty())
+        const ListenerList* entry = findListenerList(event.getTypeId(), capturePhase);
+        if (!entry || entry->bins.empty())
         {
             return true;
         }
 
-        m_eventDispatcher.notifyLevel++;
-
-        for (auto& eventBin : list)
+        // 直接遍历当前缓冲区：侦听器中增删侦听器时会复制新列表，此缓冲区在派发结束前不会释放
+        const EventBin* bins = entry->bins.data();
+        const size_t count = entry->bins.size();
         {
-            eventBin.listener(event);
-
-            if (eventBin.dispatchOnce)
+            DispatchingScope scope(bins);
+            for (size_t i = 0; i < count; ++i)
             {
-                s_onceEventList.push_back(eventBin);
-            }
+                const EventBin& eventBin = bins[i];
+                eventBin.listener(event);
 
-            if (event.isPropagationImmediateStopped())
-            {
-                break;
+                if (eventBin.dispatchOnce)
+                {
+                    s_onceEventList.push_back(eventBin);
+                }
+
+                if (event.isPropagationImmediateStopped())
+                {
+                    break;
+                }
             }
         }
 
-        m_eventDispatcher.notifyLevel--;
-
         while (!s_onceEventList.empty())
         {
-            auto& eventBin = s_onceEventList.back();
-            eventBin.target->removeEventListener(eventBin.type, eventBin.listener, eventBin.thisObject,
-                                                 eventBin.useCapture);
+            EventBin eventBin = std::move(s_onceEventList.back());
             s_onceEventList.pop_back();
-        }
-
-        if (m_eventDispatcher.notifyLevel == 0) {
-            // 一次派发结束，清理克隆标记
-            m_eventDispatcher.clonedTypes.clear();
-            m_eventDispatcher.clonedCaptureTypes.clear();
+            eventBin.target->removeEventListener(EventTypeRegistry::getName(eventBin.type), eventBin.listener,
+                                                 eventBin.thisObject, eventBin.useCapture);
         }
 
         return !event.isDefaultPrevented();
@@ -3,18 +3,20 @@
 //
 
 #pragma once
-#include <map>
 #include <string>
-#include <unordered_set>
+#include <vector>
 
 #include "events/IEventDispatcher.hpp"
+#include "events/EventType.hpp"
 
 
 namespace egret
 {
+    class DisplayObject;
+
     struct EventBin
     {
-        std::string type;
+        EventTypeId type;
         EventListener listener;
         void* thisObject;
         int priority;
@@ -26,15 +28,25 @@ namespace egret
     class EventDispatcher : public virtual IEventDispatcher
     {
     private:
+        /**
+         * 某一类型、某一阶段的侦听器列表
+         * 派发时直接遍历bins的缓冲区；派发期间对同一列表的增删会先复制（写时复制，对应TypeScript中的list.concat()），
+         * 旧缓冲区在本线程所有派发结束后才释放，不影响正在进行的遍历
+         */
+        struct ListenerList
+        {
+            EventTypeId type;
+            bool useCapture;
+            std::vector<EventBin> bins;
+        };
+
         struct EventDispatcherData
         {
             IEventDispatcher* eventTarget;
-            std::map<std::string, std::vector<EventBin>> eventsMap;
-            std::map<std::string, std::vector<EventBin>> captureEventsMap;
-            int notifyLevel;
-            // 在一次派发期间，哪些 type 已经克隆过，避免重复复制
-            std::unordered_set<std::string> clonedTypes;
-            std::unordered_set<std::string> clonedCaptureTypes;
+            // 派发器本身是显示对象时指向自身，派发时据此构建传播路径，无需any_cast
+            DisplayObject* displayObject;
+            // 扁平侦听器表，按(type, useCapture)线性查找；没有侦听器时不占用堆内存
+            std::vector<ListenerList> listeners;
         };
 
         EventDispatcherData m_eventDispatcher;
@@ -42,7 +54,7 @@ namespace egret
 
     public:
         explicit EventDispatcher(IEventDispatcher* target = nullptr);
-        ~EventDispatcher() override = default;
+        ~EventDispatcher() override;
 
         void addEventListener(const std::string& type, const EventListener& listener, void* thisObject, bool useCapture,
                               int priority) override;
@@ -54,24 +66,48 @@ namespace egret
                                  bool useCapture) override;
 
         bool hasEventListener(const std::string& type) const override;
+
+        /**
+         * 按驻留ID判断是否存在侦听器（冒泡或捕获阶段）
+         */
+        bool hasEventListener(EventTypeId type) const;
         bool dispatchEvent(Event& event) override;
         bool willTrigger(const std::string& type) const override;
 
         bool dispatchEventWith(const std::string& type, bool bubbles = false, void* data = nullptr,
                                bool cancelable = false);
 
+        /**
+         * 派发器是否为显示对象（事件会沿显示列表捕获/冒泡）
+         */
+        bool isDisplayObject() const { return m_eventDispatcher.displayObject != nullptr; }
+
+    protected:
+        /**
+         * 标记派发器为显示对象（仅由DisplayObject构造函数调用）
+         */
+        void setDisplayObjectTarget(DisplayObject* displayObject) { m_eventDispatcher.displayObject = displayObject; }
+
+        /**
+         * addEventListener与once的公共入口，子类可重写以感知特定类型侦听器的注册
+         */
+        virtual void addListener(const std::string& type,
+                                 const EventListener& listener,
+                                 void* thisObject,
+                                 bool useCapture,
+                                 int priority,
+                                 bool dispatchOnce = false);
+
     private:
-        std::map<std::string, std::vector<EventBin>>& getEventMap(bool useCapture = false);
+        ListenerList* findListenerList(EventTypeId type, bool useCapture);
+        const ListenerList* findListenerList(EventTypeId type, bool useCapture) const;
+
+        std::vector<EventBin>& getWritableBins(EventTypeId type, bool useCapture);
 
-        void addListener(const std::string& type,
-                         const EventListener& listener,
-                         void* thisObject,
-                         bool useCapture,
-                         int priority,
-                         bool dispatchOnce = false);
+        void removeListenerList(EventTypeId type, bool useCapture);
 
         bool insertEventBin(std::vector<EventBin>& list,
-                            const std::string& type,
+                            EventTypeId type,
                             const EventListener& listener,
                             void* thisObject,
                             bool useCapture,
@@ -0,0 +1,34 @@
+#include "events/EventPool.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+
+namespace egret {
+
+    namespace {
+        std::vector<EventPoolBase*>& registeredPools() {
+            static std::vector<EventPoolBase*> pools;
+            return pools;
+        }
+    }
+
+    EventPoolBase::EventPoolBase(const char* name, size_t maxSize)
+        : m_name(name)
+        , m_maxSize(maxSize) {
+        registeredPools().push_back(this);
+    }
+
+    EventPoolBase::~EventPoolBase() {
+        auto& pools = registeredPools();
+        pools.erase(std::remove(pools.begin(), pools.end(), this), pools.end());
+    }
+
+    void EventPoolBase::logEventPoolStats() {
+        for (const EventPoolBase* pool : registeredPools()) {
+            const EventPoolStats& stats = pool->m_stats;
+            EGRET_INFOF("事件对象池 {}: 新建={} 复用={} 归还={} 丢弃={} 空闲={}/{}",
+                        pool->m_name, stats.created, stats.reused, stats.released,
+                        stats.discarded, stats.pooled, pool->m_maxSize);
+        }
+    }
+
+} // namespace egret
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace egret {
+
+    class Event;
+
+    /**
+     * 事件对象池统计
+     */
+    struct EventPoolStats {
+        size_t created = 0;     // 池为空时新建的实例数
+        size_t reused = 0;      // 从池中复用的次数
+        size_t released = 0;    // 归还次数
+        size_t discarded = 0;   // 池已满而直接释放的实例数
+        size_t pooled = 0;      // 当前池中空闲实例数
+    };
+
+    /**
+     * 事件对象池基类：保存名称与统计，并登记到全局列表以便统一输出
+     */
+    class EventPoolBase {
+    public:
+        EventPoolBase(const char* name, size_t maxSize);
+        virtual ~EventPoolBase();
+
+        EventPoolBase(const EventPoolBase&) = delete;
+        EventPoolBase& operator=(const EventPoolBase&) = delete;
+
+        const char* getName() const { return m_name; }
+        const EventPoolStats& getStats() const { return m_stats; }
+        size_t getMaxSize() const { return m_maxSize; }
+
+        /**
+         * 输出所有事件对象池的统计信息
+         */
+        static void logEventPoolStats();
+
+    protected:
+        const char* m_name;
+        size_t m_maxSize;
+        EventPoolStats m_stats;
+    };
+
+    /**
+     * 类型化的事件对象池
+     * acquire取出实例并按新的type/bubbles/cancelable重置Event基类状态，子类字段由调用方设置；
+     * release调用clean()后放回池中。空闲列表预留了maxSize的容量，稳定状态下取出与归还都不分配内存
+     * 归还后调用方不得再持有该实例；非线程安全，与事件系统一样只在主线程使用
+     * @tparam T Event或其子类，需提供 T(type, bubbles, cancelable) 构造函数
+     */
+    template <typename T>
+    class EventPool : public EventPoolBase {
+    public:
+        explicit EventPool(const char* name, size_t maxSize = 32)
+            : EventPoolBase(name, maxSize) {
+            m_free.reserve(maxSize);
+        }
+
+        // acquire/release需要完整的Event定义（访问其私有的reinit与受保护的clean），定义在Event.hpp中Event类之后
+        std::shared_ptr<T> acquire(const std::string& type, bool bubbles, bool cancelable);
+        void release(std::shared_ptr<T> event);
+
+    private:
+        std::vector<std::shared_ptr<T>> m_free;
+    };
+
+} // namespace egret
@@ -0,0 +1,93 @@
+#include "events/EventType.hpp"
+#include "utils/Logger.hpp"
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace egret {
+
+    namespace {
+
+        struct EventTypeTable {
+            // 事件可能在任务线程上创建（如资源加载完成事件），查找取共享锁，驻留新类型取独占锁
+            std::shared_mutex mutex;
+            std::unordered_map<std::string, EventTypeId> ids;
+            std::deque<std::string> names;  // deque保证已返回的引用不失效
+
+            EventTypeTable() {
+                // 顺序必须与EventTypes中的常量一致
+                // 这里直接使用字面量，避免依赖其他编译单元中静态字符串的初始化顺序
+                static const char* const builtinTypes[] = {
+                    "",
+                    "addedToStage", "removedFromStage", "added", "removed",
+                    "enterFrame", "render", "resize", "change", "changing",
+                    "complete", "loopComplete", "focusIn", "focusOut", "ended",
+                    "activate", "deactivate", "close", "connect", "leaveStage",
+                    "soundComplete",
+                    "touchMove", "touchBegin", "touchEnd", "touchCancel", "touchTap",
+                    "touchReleaseOutside"
+                };
+                for (const char* type : builtinTypes) {
+                    add(type);
+                }
+            }
+
+            EventTypeId add(const std::string& type) {
+                auto id = static_cast<EventTypeId>(names.size());
+                names.push_back(type);
+                ids.emplace(type, id);
+                return id;
+            }
+        };
+
+        EventTypeTable& table() {
+            static EventTypeTable instance;
+            return instance;
+        }
+
+    } // namespace
+
+    EventTypeId EventTypeRegistry::intern(const std::string& type) {
+        auto& t = table();
+        {
+            std::shared_lock lock(t.mutex);
+            auto it = t.ids.find(type);
+            if (it != t.ids.end()) {
+                return it->second;
+            }
+        }
+        std::unique_lock lock(t.mutex);
+        // 释放共享锁后其他线程可能已驻留同一类型
+        auto it = t.ids.find(type);
+        if (it != t.ids.end()) {
+            return it->second;
+        }
+        if (t.names.size() > std::numeric_limits<EventTypeId>::max()) {
+            EGRET_ERRORF("事件类型数量超出上限，无法驻留: {}", type);
+            return EventTypes::INVALID;
+        }
+        return t.add(type);
+    }
+
+    EventTypeId EventTypeRegistry::find(const std::string& type) {
+        auto& t = table();
+        std::shared_lock lock(t.mutex);
+        auto it = t.ids.find(type);
+        return it != t.ids.end() ? it->second : EventTypes::INVALID;
+    }
+
+    const std::string& EventTypeRegistry::getName(EventTypeId id) {
+        auto& t = table();
+        std::shared_lock lock(t.mutex);
+        return id < t.names.size() ? t.names[id] : t.names[EventTypes::INVALID];
+    }
+
+    size_t EventTypeRegistry::size() {
+        auto& t = table();
+        std::shared_lock lock(t.mutex);
+        return t.names.size() - 1;
+    }
+
+} // namespace egret
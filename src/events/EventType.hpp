@@ -0,0 +1,74 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+namespace egret {
+
+    /**
+     * 驻留后的事件类型ID，0表示无效类型
+     */
+    using EventTypeId = uint16_t;
+
+    /**
+     * 预先驻留的内置事件类型ID，与Event/TouchEvent中的类型常量一一对应
+     * 热路径上可直接与Event::getTypeId()比较，无需字符串比较
+     */
+    namespace EventTypes {
+        constexpr EventTypeId INVALID = 0;
+        constexpr EventTypeId ADDED_TO_STAGE = 1;
+        constexpr EventTypeId REMOVED_FROM_STAGE = 2;
+        constexpr EventTypeId ADDED = 3;
+        constexpr EventTypeId REMOVED = 4;
+        constexpr EventTypeId ENTER_FRAME = 5;
+        constexpr EventTypeId RENDER = 6;
+        constexpr EventTypeId RESIZE = 7;
+        constexpr EventTypeId CHANGE = 8;
+        constexpr EventTypeId CHANGING = 9;
+        constexpr EventTypeId COMPLETE = 10;
+        constexpr EventTypeId LOOP_COMPLETE = 11;
+        constexpr EventTypeId FOCUS_IN = 12;
+        constexpr EventTypeId FOCUS_OUT = 13;
+        constexpr EventTypeId ENDED = 14;
+        constexpr EventTypeId ACTIVATE = 15;
+        constexpr EventTypeId DEACTIVATE = 16;
+        constexpr EventTypeId CLOSE = 17;
+        constexpr EventTypeId CONNECT = 18;
+        constexpr EventTypeId LEAVE_STAGE = 19;
+        constexpr EventTypeId SOUND_COMPLETE = 20;
+        constexpr EventTypeId TOUCH_MOVE = 21;
+        constexpr EventTypeId TOUCH_BEGIN = 22;
+        constexpr EventTypeId TOUCH_END = 23;
+        constexpr EventTypeId TOUCH_CANCEL = 24;
+        constexpr EventTypeId TOUCH_TAP = 25;
+        constexpr EventTypeId TOUCH_RELEASE_OUTSIDE = 26;
+    }
+
+    /**
+     * 事件类型驻留表：把事件类型字符串映射为小整数ID
+     * 侦听器表与派发路径只比较ID，字符串只在注册和创建事件时查找一次
+     * 线程安全：事件可以在任意线程创建，侦听器表与派发仍只应在主线程使用
+     */
+    class EventTypeRegistry {
+    public:
+        /**
+         * 获取类型对应的ID，未驻留时分配新ID
+         */
+        static EventTypeId intern(const std::string& type);
+
+        /**
+         * 查找已驻留的类型，未驻留时返回EventTypes::INVALID（不分配新ID）
+         */
+        static EventTypeId find(const std::string& type);
+
+        /**
+         * 获取ID对应的类型字符串（引用在程序生命周期内有效）
+         */
+        static const std::string& getName(EventTypeId id);
+
+        /**
+         * 已驻留的类型数量（不含INVALID）
+         */
+        static size_t size();
+    };
+
+} // namespace egret
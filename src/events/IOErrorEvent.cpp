@@ -10,9 +10,6 @@ namespace egret
     // ========== 静态常量定义 ==========
     const std::string IOErrorEvent::IO_ERROR = "ioError";
     
-    // ========== 静态成员变量定义 ==========
-    std::vector<std::shared_ptr<IOErrorEvent>> IOErrorEvent::s_ioErrorEventPool;
-    
     // ========== 构造函数 ==========
     IOErrorEvent::IOErrorEvent(const std::string& type, bool bubbles, bool cancelable)
         : Event(type, bubbles, cancelable)
@@ -21,36 +18,26 @@ namespace egret
     }
     
     // ========== 静态工厂方法实现 ==========
+    namespace {
+        EventPool<IOErrorEvent>& iOErrorEventPool() {
+            static EventPool<IOErrorEvent> pool("IOErrorEvent");
+            return pool;
+        }
+    }
+    
     std::shared_ptr<IOErrorEvent> IOErrorEvent::create(const std::string& type, bool bubbles, bool cancelable)
     {
-        std::shared_ptr<IOErrorEvent> event;
-        
-        // 尝试从对象池中获取
-        if (!s_ioErrorEventPool.empty()) {
-            event = s_ioErrorEventPool.back();
-            s_ioErrorEventPool.pop_back();
-        }
-        
-        // 创建新实例
-        if (!event) {
-            event = std::shared_ptr<IOErrorEvent>(new IOErrorEvent(type, bubbles, cancelable));
-        }
-        
-        return event;
+        return iOErrorEventPool().acquire(type, bubbles, cancelable);
     }
     
     void IOErrorEvent::release(std::shared_ptr<IOErrorEvent> event)
     {
-        if (event) {
-            // 清理事件状态
-            event->clean();
-            
-            // 缓存到对象池（限制对象池大小）
-            if (s_ioErrorEventPool.size() < 10) { // 限制对象池最大为10个对象
-                s_ioErrorEventPool.push_back(event);
-            }
-            // 超出限制的对象将自动释放
-        }
+        iOErrorEventPool().release(std::move(event));
+    }
+    
+    const EventPoolStats& IOErrorEvent::getPoolStats()
+    {
+        return iOErrorEventPool().getStats();
     }
     
     bool IOErrorEvent::dispatchIOErrorEvent(IEventDispatcher* target, const std::string& type, bool bubbles)
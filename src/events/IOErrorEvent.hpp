@@ -61,6 +61,11 @@ namespace egret
          */
         static void release(std::shared_ptr<IOErrorEvent> event);
         
+        /**
+         * 获取IOErrorEvent对象池的统计信息
+         */
+        static const EventPoolStats& getPoolStats();
+        
         /**
          * 派发IO错误事件的便捷方法
          * @param target 派发事件目标
@@ -75,10 +80,6 @@ namespace egret
          * 清理方法，用于对象池复用时重置状态
          */
         virtual void clean() override;
-        
-    private:
-        /** IOErrorEvent对象池 */
-        static std::vector<std::shared_ptr<IOErrorEvent>> s_ioErrorEventPool;
     };
     
 } // namespace egret
\ No newline at end of file
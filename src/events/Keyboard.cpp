@@ -1,4 +1,5 @@
 #include "events/Keyboard.hpp"
+#include <algorithm>
 
 namespace egret {
 
@@ -7,11 +8,19 @@ Keyboard& Keyboard::instance() {
     return inst;
 }
 
+Keyboard::Keyboard() {
+    m_down.reserve(16);
+}
+
 void Keyboard::setKeyDown(int keyCode, bool down) {
+    auto it = std::find(m_down.begin(), m_down.end(), keyCode);
     if (down) {
-        m_down.insert(keyCode);
-    } else {
-        m_down.erase(keyCode);
+        if (it == m_down.end()) {
+            m_down.push_back(keyCode);
+        }
+    } else if (it != m_down.end()) {
+        *it = m_down.back();
+        m_down.pop_back();
     }
 }
 
@@ -22,19 +31,19 @@ void Keyboard::setModifiers(bool ctrl, bool alt, bool shift) {
 }
 
 bool Keyboard::isDown(int keyCode) const {
-    return m_down.find(keyCode) != m_down.end();
+    return std::find(m_down.begin(), m_down.end(), keyCode) != m_down.end();
 }
 
 bool Keyboard::isAnyDown(std::initializer_list<int> keys) const {
     for (int k : keys) {
-        if (m_down.find(k) != m_down.end()) return true;
+        if (isDown(k)) return true;
     }
     return false;
 }
 
 bool Keyboard::areAllDown(std::initializer_list<int> keys) const {
     for (int k : keys) {
-        if (m_down.find(k) == m_down.end()) return false;
+        if (!isDown(k)) return false;
     }
     return true;
 }
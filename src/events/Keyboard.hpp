@@ -1,7 +1,7 @@
 #pragma once
 
-#include <unordered_set>
 #include <initializer_list>
+#include <vector>
 
 namespace egret {
 
@@ -30,8 +30,9 @@ namespace egret {
         bool isShiftDown()const { return m_shift; }
 
     private:
-        Keyboard() = default;
-        std::unordered_set<int> m_down;
+        Keyboard();
+        // 同时按下的键很少，用预留容量的数组线性查找，按键时不分配内存
+        std::vector<int> m_down;
         bool m_ctrl = false;
         bool m_alt  = false;
         bool m_shift= false;
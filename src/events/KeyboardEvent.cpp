@@ -53,13 +53,34 @@ namespace egret {
 
     // ========== 静态工厂方法实现 ==========
     
+    namespace {
+        EventPool<KeyboardEvent>& keyboardEventPool() {
+            static EventPool<KeyboardEvent> pool("KeyboardEvent");
+            return pool;
+        }
+    }
+    
     std::shared_ptr<KeyboardEvent> KeyboardEvent::create(const std::string& type, 
                                                         int keyCode, int charCode, 
                                                         int keyLocation,
                                                         bool ctrlKey, bool altKey, 
                                                         bool shiftKey) {
-        return std::make_shared<KeyboardEvent>(type, true, true, keyCode, charCode, 
-                                             keyLocation, ctrlKey, altKey, shiftKey);
+        auto event = keyboardEventPool().acquire(type, true, true);
+        event->m_keyCode = keyCode;
+        event->m_charCode = charCode;
+        event->m_keyLocation = keyLocation;
+        event->m_ctrlKey = ctrlKey;
+        event->m_altKey = altKey;
+        event->m_shiftKey = shiftKey;
+        return event;
+    }
+    
+    void KeyboardEvent::release(std::shared_ptr<KeyboardEvent> event) {
+        keyboardEventPool().release(std::move(event));
+    }
+    
+    const EventPoolStats& KeyboardEvent::getPoolStats() {
+        return keyboardEventPool().getStats();
     }
     
     std::shared_ptr<KeyboardEvent> KeyboardEvent::createFromSDLEvent(const SDL_Event& sdlEvent) {
@@ -68,10 +89,10 @@ namespace egret {
         }
         
         // 确定事件类型
-        std::string type = (sdlEvent.type == SDL_EVENT_KEY_DOWN) ? KEY_DOWN : KEY_UP;
+        const std::string& type = (sdlEvent.type == SDL_EVENT_KEY_DOWN) ? KEY_DOWN : KEY_UP;
         
-        // 创建事件实例
-        auto keyboardEvent = std::make_shared<KeyboardEvent>(type);
+        // 从对象池取出事件实例
+        auto keyboardEvent = create(type);
         
         // 从SDL事件初始化
         keyboardEvent->initFromSDLEvent(sdlEvent);
@@ -95,6 +116,9 @@ namespace egret {
         // 派发事件
         bool result = target->dispatchEvent(*keyboardEvent);
         
+        // 释放事件对象到对象池
+        release(keyboardEvent);
+        
         return result;
     }
 
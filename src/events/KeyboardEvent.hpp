@@ -158,6 +158,17 @@ namespace egret {
          */
         static std::shared_ptr<KeyboardEvent> createFromSDLEvent(const SDL_Event& sdlEvent);
         
+        /**
+         * 释放 KeyboardEvent 实例，并缓存到对象池
+         * @param event 要释放的事件对象（必须是由create()或createFromSDLEvent()创建的）
+         */
+        static void release(std::shared_ptr<KeyboardEvent> event);
+        
+        /**
+         * 获取 KeyboardEvent 对象池的统计信息
+         */
+        static const EventPoolStats& getPoolStats();
+        
         /**
          * 使用指定的 EventDispatcher 派发键盘事件
          * @param target 事件目标
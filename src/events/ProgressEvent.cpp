@@ -11,9 +11,6 @@ namespace egret
     const std::string ProgressEvent::PROGRESS = "progress";
     const std::string ProgressEvent::SOCKET_DATA = "socketData";
     
-    // ========== 静态成员变量定义 ==========
-    std::vector<std::shared_ptr<ProgressEvent>> ProgressEvent::s_progressEventPool;
-    
     // ========== 构造函数 ==========
     ProgressEvent::ProgressEvent(const std::string& type, bool bubbles, bool cancelable, double bytesLoaded, double bytesTotal)
         : Event(type, bubbles, cancelable)
@@ -24,40 +21,29 @@ namespace egret
     }
     
     // ========== 静态工厂方法实现 ==========
+    namespace {
+        EventPool<ProgressEvent>& progressEventPool() {
+            static EventPool<ProgressEvent> pool("ProgressEvent");
+            return pool;
+        }
+    }
+    
     std::shared_ptr<ProgressEvent> ProgressEvent::create(const std::string& type, bool bubbles, bool cancelable, double bytesLoaded, double bytesTotal)
     {
-        std::shared_ptr<ProgressEvent> event;
-        
-        // 尝试从对象池中获取
-        if (!s_progressEventPool.empty()) {
-            event = s_progressEventPool.back();
-            s_progressEventPool.pop_back();
-            
-            // 重新设置属性
-            event->setBytesLoaded(bytesLoaded);
-            event->setBytesTotal(bytesTotal);
-        }
-        
-        // 创建新实例
-        if (!event) {
-            event = std::shared_ptr<ProgressEvent>(new ProgressEvent(type, bubbles, cancelable, bytesLoaded, bytesTotal));
-        }
-        
+        auto event = progressEventPool().acquire(type, bubbles, cancelable);
+        event->m_bytesLoaded = bytesLoaded;
+        event->m_bytesTotal = bytesTotal;
         return event;
     }
     
     void ProgressEvent::release(std::shared_ptr<ProgressEvent> event)
     {
-        if (event) {
-            // 清理事件状态
-            event->clean();
-            
-            // 缓存到对象池（限制对象池大小）
-            if (s_progressEventPool.size() < 10) { // 限制对象池最大为10个对象
-                s_progressEventPool.push_back(event);
-            }
-            // 超出限制的对象将自动释放
-        }
+        progressEventPool().release(std::move(event));
+    }
+    
+    const EventPoolStats& ProgressEvent::getPoolStats()
+    {
+        return progressEventPool().getStats();
     }
     
     bool ProgressEvent::dispatchProgressEvent(IEventDispatcher* target, const std::string& type, double bytesLoaded, double bytesTotal, bool bubbles)
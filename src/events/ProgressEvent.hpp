@@ -103,6 +103,11 @@ namespace egret
          */
         static void release(std::shared_ptr<ProgressEvent> event);
         
+        /**
+         * 获取ProgressEvent对象池的统计信息
+         */
+        static const EventPoolStats& getPoolStats();
+        
         /**
          * 派发进度事件的便捷方法
          * @param target 派发事件目标
@@ -131,9 +136,6 @@ namespace egret
          * 如果加载过程成功，将加载的总项数或总字节数
          */
         double m_bytesTotal;
-        
-        /** ProgressEvent对象池 */
-        static std::vector<std::shared_ptr<ProgressEvent>> s_progressEventPool;
     };
     
 } // namespace egret
\ No newline at end of file
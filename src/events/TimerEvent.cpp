@@ -11,9 +11,6 @@ namespace egret
     const std::string TimerEvent::TIMER = "timer";
     const std::string TimerEvent::TIMER_COMPLETE = "timerComplete";
     
-    // ========== 静态成员变量定义 ==========
-    std::vector<std::shared_ptr<TimerEvent>> TimerEvent::s_timerEventPool;
-    
     // ========== 构造函数 ==========
     TimerEvent::TimerEvent(const std::string& type, bool bubbles, bool cancelable)
         : Event(type, bubbles, cancelable)
@@ -22,40 +19,26 @@ namespace egret
     }
     
     // ========== 静态工厂方法实现 ==========
+    namespace {
+        EventPool<TimerEvent>& timerEventPool() {
+            static EventPool<TimerEvent> pool("TimerEvent");
+            return pool;
+        }
+    }
+    
     std::shared_ptr<TimerEvent> TimerEvent::create(const std::string& type, bool bubbles, bool cancelable)
     {
-        std::shared_ptr<TimerEvent> event;
-        
-        // 尝试从对象池中获取
-        if (!s_timerEventPool.empty()) {
-            event = s_timerEventPool.back();
-            s_timerEventPool.pop_back();
-            
-            // 重新初始化事件对象
-            // 由于Event的成员变量是private，我们需要通过构造函数重新初始化
-            // 这里我们直接创建新对象，因为重用机制需要更复杂的设计
-        }
-        
-        // 创建新实例
-        if (!event) {
-            event = std::shared_ptr<TimerEvent>(new TimerEvent(type, bubbles, cancelable));
-        }
-        
-        return event;
+        return timerEventPool().acquire(type, bubbles, cancelable);
     }
     
     void TimerEvent::release(std::shared_ptr<TimerEvent> event)
     {
-        if (event) {
-            // 清理事件状态
-            event->clean();
-            
-            // 缓存到对象池（限制对象池大小）
-            if (s_timerEventPool.size() < 10) { // 限制对象池最大为10个对象
-                s_timerEventPool.push_back(event);
-            }
-            // 超出限制的对象将自动释放
-        }
+        timerEventPool().release(std::move(event));
+    }
+    
+    const EventPoolStats& TimerEvent::getPoolStats()
+    {
+        return timerEventPool().getStats();
     }
     
     bool TimerEvent::dispatchTimerEvent(IEventDispatcher* target, const std::string& type, bool bubbles)
@@ -68,6 +68,11 @@ namespace egret
          */
         static void release(std::shared_ptr<TimerEvent> event);
         
+        /**
+         * 获取TimerEvent对象池的统计信息
+         */
+        static const EventPoolStats& getPoolStats();
+        
         /**
          * 派发定时器事件的便捷方法
          * @param target 派发事件目标
@@ -82,10 +87,6 @@ namespace egret
          * 清理方法，用于对象池复用时重置状态
          */
         virtual void clean() override;
-        
-    private:
-        /** TimerEvent对象池 */
-        static std::vector<std::shared_ptr<TimerEvent>> s_timerEventPool;
     };
     
 } // namespace egret
\ No newline at end of file
@@ -22,7 +22,9 @@ namespace egret {
         , localY_(0.0)
         , touchPointID_(0)
         , touchDown_(false)
-        , targetChanged_(true) {
+        , targetChanged_(true)
+        , coalescedCount_(1)
+        , coalescedSamples_(nullptr) {
         initTo(stageX, stageY, touchPointID);
     }
 
@@ -83,17 +85,13 @@ namespace egret {
 
     void TouchEvent::getLocalXY() {
         targetChanged_ = false;
-        try {
-            if (auto displayObjectPtr = std::any_cast<DisplayObject*>(getTarget())) {
-                // 使用对象的逆连接矩阵将舞台坐标转换为本地坐标
-                Matrix* inv = displayObjectPtr->getInvertedConcatenatedMatrix();
-                Point p = inv->transformPoint(Point(stageX_, stageY_));
-                localX_ = p.getX();
-                localY_ = p.getY();
-                return;
-            }
-        } catch (const std::bad_any_cast&) {
-            // 忽略
+        if (DisplayObject* displayObject = getTargetDisplayObject()) {
+            // 使用对象的逆连接矩阵将舞台坐标转换为本地坐标
+            Matrix* inv = displayObject->getInvertedConcatenatedMatrix();
+            Point p = inv->transformPoint(Point(stageX_, stageY_));
+            localX_ = p.getX();
+            localY_ = p.getY();
+            return;
         }
         // 回退
         localX_ = stageX_;
@@ -108,12 +106,61 @@ namespace egret {
             return true;
         }
         
-        // TODO: Implement Event.create() and Event.release() for object pooling
-        TouchEvent event(type, bubbles, cancelable);
-        event.initTo(stageX, stageY, touchPointID);
-        event.setTouchDown(touchDown);
-        bool result = target->dispatchEvent(event);
+        auto event = create(type, bubbles, cancelable, stageX, stageY, touchPointID, touchDown);
+        bool result = target->dispatchEvent(*event);
+        release(event);
         return result;
     }
 
+    namespace {
+        EventPool<TouchEvent>& touchEventPool() {
+            static EventPool<TouchEvent> pool("TouchEvent");
+            return pool;
+        }
+    }
+
+    std::shared_ptr<TouchEvent> TouchEvent::create(const std::string& type, bool bubbles, bool cancelable,
+                                                   double stageX, double stageY,
+                                                   int touchPointID, bool touchDown) {
+        auto event = touchEventPool().acquire(type, bubbles, cancelable);
+        event->initTo(stageX, stageY, touchPointID);
+        event->setTouchDown(touchDown);
+        return event;
+    }
+
+    void TouchEvent::release(std::shared_ptr<TouchEvent> event) {
+        touchEventPool().release(std::move(event));
+    }
+
+    const EventPoolStats& TouchEvent::getPoolStats() {
+        return touchEventPool().getStats();
+    }
+
+    void TouchEvent::clean() {
+        Event::clean();
+        stageX_ = 0.0;
+        stageY_ = 0.0;
+        localX_ = 0.0;
+        localY_ = 0.0;
+        touchPointID_ = 0;
+        touchDown_ = false;
+        targetChanged_ = true;
+        coalescedCount_ = 1;
+        coalescedSamples_ = nullptr;
+    }
+
+    size_t TouchEvent::getCoalescedCount() const {
+        return coalescedCount_;
+    }
+
+    const std::vector<TouchEvent::MoveSample>& TouchEvent::getCoalescedSamples() const {
+        static const std::vector<MoveSample> empty;
+        return coalescedSamples_ ? *coalescedSamples_ : empty;
+    }
+
+    void TouchEvent::setCoalesced(size_t count, const std::vector<MoveSample>* samples) {
+        coalescedCount_ = count;
+        coalescedSamples_ = samples;
+    }
+
 }
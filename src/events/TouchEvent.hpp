@@ -2,6 +2,7 @@
 
 #include "Event.hpp"
 #include "../geom/Point.hpp"
+#include <vector>
 
 namespace egret {
 
@@ -36,6 +37,19 @@ namespace egret {
 
         void updateAfterEvent();
 
+        // 合并移动：一帧内同一触摸点的多次移动合并为一个TOUCH_MOVE派发
+        struct MoveSample {
+            double stageX;
+            double stageY;
+        };
+
+        // 本事件合并的原始移动次数，未合并时为1
+        size_t getCoalescedCount() const;
+        // 合并前的各次移动位置（舞台坐标，按到达顺序，最后一个即本事件位置）
+        // 仅在输入端开启了历史记录时非空，数据只在派发期间有效
+        const std::vector<MoveSample>& getCoalescedSamples() const;
+        void setCoalesced(size_t count, const std::vector<MoveSample>* samples);
+
         bool setTarget(const std::any& target) override;
 
         static bool dispatchTouchEvent(IEventDispatcher* target, const std::string& type, 
@@ -43,6 +57,16 @@ namespace egret {
                                      double stageX = 0.0, double stageY = 0.0, 
                                      int touchPointID = 0, bool touchDown = false);
 
+        // 对象池：输入事件频率高，取出/归还在稳定状态下不分配内存
+        static std::shared_ptr<TouchEvent> create(const std::string& type, bool bubbles = false, bool cancelable = false,
+                                                  double stageX = 0.0, double stageY = 0.0,
+                                                  int touchPointID = 0, bool touchDown = false);
+        static void release(std::shared_ptr<TouchEvent> event);
+        static const EventPoolStats& getPoolStats();
+
+    protected:
+        void clean() override;
+
     private:
         double stageX_;
         double stageY_;
@@ -51,6 +75,8 @@ namespace egret {
         int touchPointID_;
         bool touchDown_;
         bool targetChanged_;
+        size_t coalescedCount_;
+        const std::vector<MoveSample>* coalescedSamples_;
 
         void getLocalXY();
         
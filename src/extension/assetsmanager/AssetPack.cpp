@@ -0,0 +1,653 @@
+/**
+ * @file AssetPack.cpp
+ * @brief 资源包实现 - 文件映射、目录查找、打包与挂载表
+ *
+ * 本文件只依赖标准库与操作系统接口，离线打包工具直接编译它而不需要链接引擎。
+ */
+
+#include "extension/assetsmanager/AssetPack.hpp"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace RES {
+
+    namespace {
+
+        // ========== 小端序读写 ==========
+
+        uint16_t readU16(const uint8_t* p) {
+            return static_cast<uint16_t>(p[0] | (p[1] << 8));
+        }
+
+        uint32_t readU32(const uint8_t* p) {
+            return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8)
+                 | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+        }
+
+        uint64_t readU64(const uint8_t* p) {
+            return static_cast<uint64_t>(readU32(p)) | (static_cast<uint64_t>(readU32(p + 4)) << 32);
+        }
+
+        void writeU16(uint8_t* p, uint16_t value) {
+            p[0] = static_cast<uint8_t>(value);
+            p[1] = static_cast<uint8_t>(value >> 8);
+        }
+
+        void writeU32(uint8_t* p, uint32_t value) {
+            for (int i = 0; i < 4; ++i) {
+                p[i] = static_cast<uint8_t>(value >> (i * 8));
+            }
+        }
+
+        void writeU64(uint8_t* p, uint64_t value) {
+            writeU32(p, static_cast<uint32_t>(value));
+            writeU32(p + 4, static_cast<uint32_t>(value >> 32));
+        }
+
+        // 文件头字段偏移
+        constexpr size_t kHeaderVersion = 4;
+        constexpr size_t kHeaderEntryCount = 8;
+        constexpr size_t kHeaderStringsSize = 12;
+        constexpr size_t kHeaderStringsOffset = 16;
+
+        // 目录项字段偏移
+        constexpr size_t kEntryHash = 0;
+        constexpr size_t kEntryOffset = 8;
+        constexpr size_t kEntrySize = 16;
+        constexpr size_t kEntryCrc = 24;
+        constexpr size_t kEntryPathOffset = 28;
+        constexpr size_t kEntryPathLength = 32;
+        constexpr size_t kEntryTypeLength = 34;
+
+        // CRC32查表（slicing-by-8）：kCrcTables[k][b]为字节b后跟k个零字节的CRC，每次处理8字节
+        constexpr std::array<std::array<uint32_t, 256>, 8> kCrcTables = [] {
+            std::array<std::array<uint32_t, 256>, 8> tables{};
+            for (uint32_t i = 0; i < 256; ++i) {
+                uint32_t c = i;
+                for (int k = 0; k < 8; ++k) {
+                    c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                }
+                tables[0][i] = c;
+            }
+            for (uint32_t i = 0; i < 256; ++i) {
+                for (size_t k = 1; k < 8; ++k) {
+                    tables[k][i] = (tables[k - 1][i] >> 8) ^ tables[0][tables[k - 1][i] & 0xFF];
+                }
+            }
+            return tables;
+        }();
+
+        void setError(std::string* error, std::string message) {
+            if (error) {
+                *error = std::move(message);
+            }
+        }
+
+        bool readWholeFile(const std::string& file, std::vector<uint8_t>& data, std::string* error) {
+            std::ifstream in(file, std::ios::binary | std::ios::ate);
+            if (!in) {
+                setError(error, "无法打开文件: " + file);
+                return false;
+            }
+            std::streamoff size = in.tellg();
+            if (size < 0) {
+                setError(error, "无法读取文件大小: " + file);
+                return false;
+            }
+            data.resize(static_cast<size_t>(size));
+            in.seekg(0, std::ios::beg);
+            if (size > 0 && !in.read(reinterpret_cast<char*>(data.data()), size)) {
+                setError(error, "读取文件失败: " + file);
+                return false;
+            }
+            return true;
+        }
+
+        // ========== 挂载表 ==========
+
+        struct Mount {
+            std::shared_ptr<AssetPack> pack;
+            std::string prefix;     // 规范化的挂载路径，非空时以'/'结尾
+        };
+
+        struct MountTable {
+            std::shared_mutex mutex;
+            std::vector<Mount> mounts;
+        };
+
+        MountTable& mountTable() {
+            static MountTable instance;
+            return instance;
+        }
+
+    } // namespace
+
+    // ========== AssetPack ==========
+
+    AssetPack::AssetPack()
+        : m_base(nullptr)
+        , m_size(0)
+        , m_entryCount(0)
+        , m_strings(nullptr)
+        , m_stringsSize(0)
+        , m_verifyOnRead(false)
+#ifdef _WIN32
+        , m_fileHandle(nullptr)
+        , m_mappingHandle(nullptr)
+#endif
+    {
+    }
+
+    AssetPack::~AssetPack() {
+#ifdef _WIN32
+        if (m_base) {
+            UnmapViewOfFile(m_base);
+        }
+        if (m_mappingHandle) {
+            CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+        }
+        if (m_fileHandle) {
+            CloseHandle(static_cast<HANDLE>(m_fileHandle));
+        }
+#else
+        if (m_base) {
+            munmap(const_cast<uint8_t*>(m_base), m_size);
+        }
+#endif
+    }
+
+    std::shared_ptr<AssetPack> AssetPack::open(const std::string& file, std::string* error) {
+        std::shared_ptr<AssetPack> pack(new AssetPack());
+        pack->m_filePath = file;
+
+#ifdef _WIN32
+        HANDLE fileHandle = CreateFileA(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) {
+            setError(error, "无法打开资源包: " + file);
+            return nullptr;
+        }
+        pack->m_fileHandle = fileHandle;
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(fileHandle, &size) || size.QuadPart < static_cast<LONGLONG>(HEADER_SIZE)) {
+            setError(error, "资源包文件过小: " + file);
+            return nullptr;
+        }
+        HANDLE mapping = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            setError(error, "无法映射资源包: " + file);
+            return nullptr;
+        }
+        pack->m_mappingHandle = mapping;
+        void* base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!base) {
+            setError(error, "无法映射资源包: " + file);
+            return nullptr;
+        }
+        pack->m_base = static_cast<const uint8_t*>(base);
+        pack->m_size = static_cast<size_t>(size.QuadPart);
+#else
+        int fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            setError(error, "无法打开资源包: " + file);
+            return nullptr;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(HEADER_SIZE)) {
+            ::close(fd);
+            setError(error, "资源包文件过小: " + file);
+            return nullptr;
+        }
+        void* base = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        // 映射建立后即可关闭文件描述符
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            setError(error, "无法映射资源包: " + file);
+            return nullptr;
+        }
+        pack->m_base = static_cast<const uint8_t*>(base);
+        pack->m_size = static_cast<size_t>(st.st_size);
+#endif
+
+        if (!pack->validate(error)) {
+            return nullptr;
+        }
+        return pack;
+    }
+
+    bool AssetPack::validate(std::string* error) {
+        if (std::memcmp(m_base, MAGIC, sizeof(MAGIC)) != 0) {
+            setError(error, "不是资源包文件: " + m_filePath);
+            return false;
+        }
+        uint32_t version = readU32(m_base + kHeaderVersion);
+        if (version != VERSION) {
+            setError(error, "不支持的资源包版本 " + std::to_string(version) + ": " + m_filePath);
+            return false;
+        }
+
+        size_t count = readU32(m_base + kHeaderEntryCount);
+        uint64_t stringsSize = readU32(m_base + kHeaderStringsSize);
+        uint64_t stringsOffset = readU64(m_base + kHeaderStringsOffset);
+        if (count > (m_size - HEADER_SIZE) / ENTRY_SIZE
+            || stringsOffset < HEADER_SIZE + count * ENTRY_SIZE
+            || stringsOffset > m_size || stringsSize > m_size - stringsOffset) {
+            setError(error, "资源包目录已损坏: " + m_filePath);
+            return false;
+        }
+        m_entryCount = count;
+        m_strings = m_base + stringsOffset;
+        m_stringsSize = static_cast<size_t>(stringsSize);
+
+        // 只检查目录与字符串表，不触及文件数据
+        uint64_t previousHash = 0;
+        for (size_t i = 0; i < m_entryCount; ++i) {
+            const uint8_t* p = entryAt(i);
+            uint64_t offset = readU64(p + kEntryOffset);
+            uint64_t size = readU64(p + kEntrySize);
+            uint64_t pathOffset = readU32(p + kEntryPathOffset);
+            uint64_t stringsEnd = pathOffset + readU16(p + kEntryPathLength) + readU16(p + kEntryTypeLength);
+            bool valid = offset <= m_size && size <= m_size - offset && stringsEnd <= m_stringsSize;
+            if (valid) {
+                Entry entry = getEntry(i);
+                valid = entry.hash >= previousHash && entry.hash == hashPath(entry.path);
+                previousHash = entry.hash;
+            }
+            if (!valid) {
+                setError(error, "资源包目录第" + std::to_string(i) + "项已损坏: " + m_filePath);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const uint8_t* AssetPack::entryAt(size_t index) const {
+        return m_base + HEADER_SIZE + index * ENTRY_SIZE;
+    }
+
+    AssetPack::Entry AssetPack::getEntry(size_t index) const {
+        const uint8_t* p = entryAt(index);
+        Entry entry;
+        entry.hash = readU64(p + kEntryHash);
+        entry.offset = readU64(p + kEntryOffset);
+        entry.size = readU64(p + kEntrySize);
+        entry.crc32 = readU32(p + kEntryCrc);
+        const char* strings = reinterpret_cast<const char*>(m_strings) + readU32(p + kEntryPathOffset);
+        uint16_t pathLength = readU16(p + kEntryPathLength);
+        entry.path = std::string_view(strings, pathLength);
+        entry.type = std::string_view(strings + pathLength, readU16(p + kEntryTypeLength));
+        return entry;
+    }
+
+    bool AssetPack::find(std::string_view path, Entry& entry) const {
+        std::string normalized = normalizePath(path);
+        uint64_t hash = hashPath(normalized);
+
+        // 目录按哈希升序排列，二分查找第一个不小于hash的项
+        size_t low = 0;
+        size_t high = m_entryCount;
+        while (low < high) {
+            size_t mid = low + (high - low) / 2;
+            if (readU64(entryAt(mid) + kEntryHash) < hash) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        // 哈希相同的项相邻，逐个比较路径
+        for (size_t i = low; i < m_entryCount && readU64(entryAt(i) + kEntryHash) == hash; ++i) {
+            Entry candidate = getEntry(i);
+            if (candidate.path == normalized) {
+                entry = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool AssetPack::contains(std::string_view path) const {
+        Entry entry;
+        return find(path, entry);
+    }
+
+    ByteSpan AssetPack::getData(const Entry& entry) const {
+        return ByteSpan(m_base + entry.offset, static_cast<size_t>(entry.size));
+    }
+
+    bool AssetPack::verify(const Entry& entry) const {
+        return crc32(getData(entry)) == entry.crc32;
+    }
+
+    bool AssetPack::read(std::string_view path, ByteSpan& data, std::string* error) const {
+        Entry entry;
+        if (!find(path, entry)) {
+            setError(error, "资源包 " + m_filePath + " 中没有文件: " + std::string(path));
+            return false;
+        }
+        if (getVerifyOnRead() && !verify(entry)) {
+            setError(error, "资源包 " + m_filePath + " 中的文件CRC32校验失败: " + std::string(entry.path));
+            return false;
+        }
+        data = getData(entry);
+        return true;
+    }
+
+    std::string AssetPack::normalizePath(std::string_view path) {
+        bool absolute = !path.empty() && (path.front() == '/' || path.front() == '\\');
+        std::vector<std::string_view> segments;
+        size_t start = 0;
+        while (start <= path.size()) {
+            size_t end = path.find_first_of("/\\", start);
+            if (end == std::string_view::npos) {
+                end = path.size();
+            }
+            std::string_view segment = path.substr(start, end - start);
+            if (segment == "..") {
+                if (!segments.empty() && segments.back() != "..") {
+                    segments.pop_back();
+                } else if (!absolute) {
+                    segments.push_back(segment);
+                }
+            } else if (!segment.empty() && segment != ".") {
+                segments.push_back(segment);
+            }
+            start = end + 1;
+        }
+
+        std::string result;
+        result.reserve(path.size());
+        if (absolute) {
+            result += '/';
+        }
+        for (size_t i = 0; i < segments.size(); ++i) {
+            if (i > 0) {
+                result += '/';
+            }
+            result += segments[i];
+        }
+        return result;
+    }
+
+    uint64_t AssetPack::hashPath(std::string_view normalizedPath) {
+        uint64_t hash = 14695981039346656037ull;
+        for (char c : normalizedPath) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    uint32_t AssetPack::crc32(ByteSpan data, uint32_t crc) {
+        const uint8_t* p = data.data();
+        size_t length = data.size();
+        crc = ~crc;
+        while (length >= 8) {
+            uint32_t low = readU32(p) ^ crc;
+            uint32_t high = readU32(p + 4);
+            crc = kCrcTables[7][low & 0xFF] ^ kCrcTables[6][(low >> 8) & 0xFF]
+                ^ kCrcTables[5][(low >> 16) & 0xFF] ^ kCrcTables[4][low >> 24]
+                ^ kCrcTables[3][high & 0xFF] ^ kCrcTables[2][(high >> 8) & 0xFF]
+                ^ kCrcTables[1][(high >> 16) & 0xFF] ^ kCrcTables[0][high >> 24];
+            p += 8;
+            length -= 8;
+        }
+        while (length-- > 0) {
+            crc = kCrcTables[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+        }
+        return ~crc;
+    }
+
+    // ========== AssetPackWriter ==========
+
+    void AssetPackWriter::addData(const std::string& path, const std::string& type, std::vector<uint8_t> data) {
+        m_files.push_back(PendingFile{path, type, std::string(), std::move(data)});
+    }
+
+    void AssetPackWriter::addFile(const std::string& path, const std::string& type, const std::string& sourceFile) {
+        m_files.push_back(PendingFile{path, type.empty() ? guessType(path) : type, sourceFile, {}});
+    }
+
+    bool AssetPackWriter::write(const std::string& file, std::string* error) const {
+        struct Item {
+            const PendingFile* source;
+            std::string path;
+            uint64_t hash;
+            uint32_t pathOffset;
+        };
+
+        // 同一路径保留最后一次添加的文件
+        std::vector<Item> items;
+        std::unordered_map<std::string, size_t> indexOfPath;
+        for (const PendingFile& pending : m_files) {
+            std::string path = AssetPack::normalizePath(pending.path);
+            if (path.empty() || path.size() > 0xFFFF || pending.type.size() > 0xFFFF) {
+                setError(error, "无效的包内路径或类型: " + pending.path);
+                return false;
+            }
+            auto it = indexOfPath.find(path);
+            if (it != indexOfPath.end()) {
+                items[it->second].source = &pending;
+                continue;
+            }
+            indexOfPath.emplace(path, items.size());
+            uint64_t hash = AssetPack::hashPath(path);
+            items.push_back(Item{&pending, std::move(path), hash, 0});
+        }
+        std::sort(items.begin(), items.end(), [](const Item& a, const Item& b) {
+            return a.hash != b.hash ? a.hash < b.hash : a.path < b.path;
+        });
+
+        std::vector<uint8_t> strings;
+        for (Item& item : items) {
+            item.pathOffset = static_cast<uint32_t>(strings.size());
+            strings.insert(strings.end(), item.path.begin(), item.path.end());
+            strings.insert(strings.end(), item.source->type.begin(), item.source->type.end());
+        }
+        if (strings.size() > UINT32_MAX || items.size() > UINT32_MAX) {
+            setError(error, "资源包目录过大");
+            return false;
+        }
+
+        // 先写到临时文件，全部成功后再替换目标文件
+        std::string tempFile = file + ".tmp";
+        std::ofstream out(tempFile, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            setError(error, "无法创建文件: " + tempFile);
+            return false;
+        }
+
+        size_t stringsOffset = AssetPack::HEADER_SIZE + items.size() * AssetPack::ENTRY_SIZE;
+        std::vector<uint8_t> header(stringsOffset, 0);
+        std::memcpy(header.data(), AssetPack::MAGIC, sizeof(AssetPack::MAGIC));
+        writeU32(header.data() + kHeaderVersion, AssetPack::VERSION);
+        writeU32(header.data() + kHeaderEntryCount, static_cast<uint32_t>(items.size()));
+        writeU32(header.data() + kHeaderStringsSize, static_cast<uint32_t>(strings.size()));
+        writeU64(header.data() + kHeaderStringsOffset, stringsOffset);
+
+        // 目录在写完数据之后才能确定，先占位
+        out.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+        out.write(reinterpret_cast<const char*>(strings.data()), static_cast<std::streamsize>(strings.size()));
+        uint64_t position = stringsOffset + strings.size();
+
+        std::vector<uint8_t> buffer;
+        static const char kPadding[AssetPack::DATA_ALIGNMENT] = {};
+        bool ok = static_cast<bool>(out);
+        for (size_t i = 0; ok && i < items.size(); ++i) {
+            const PendingFile& source = *items[i].source;
+            const std::vector<uint8_t>* data = &source.data;
+            if (!source.sourceFile.empty()) {
+                if (!readWholeFile(source.sourceFile, buffer, error)) {
+                    ok = false;
+                    break;
+                }
+                data = &buffer;
+            }
+
+            size_t padding = static_cast<size_t>((AssetPack::DATA_ALIGNMENT - position % AssetPack::DATA_ALIGNMENT)
+                                                 % AssetPack::DATA_ALIGNMENT);
+            out.write(kPadding, static_cast<std::streamsize>(padding));
+            position += padding;
+
+            uint8_t* entry = header.data() + AssetPack::HEADER_SIZE + i * AssetPack::ENTRY_SIZE;
+            writeU64(entry + kEntryHash, items[i].hash);
+            writeU64(entry + kEntryOffset, position);
+            writeU64(entry + kEntrySize, data->size());
+            writeU32(entry + kEntryCrc, AssetPack::crc32(ByteSpan(data->data(), data->size())));
+            writeU32(entry + kEntryPathOffset, items[i].pathOffset);
+            writeU16(entry + kEntryPathLength, static_cast<uint16_t>(items[i].path.size()));
+            writeU16(entry + kEntryTypeLength, static_cast<uint16_t>(source.type.size()));
+
+            out.write(reinterpret_cast<const char*>(data->data()), static_cast<std::streamsize>(data->size()));
+            position += data->size();
+            ok = static_cast<bool>(out);
+        }
+
+        if (ok) {
+            out.seekp(0);
+            out.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+            out.close();
+            ok = static_cast<bool>(out);
+            if (!ok) {
+                setError(error, "写入文件失败: " + tempFile);
+            }
+        }
+        if (!ok) {
+            if (error && error->empty()) {
+                *error = "写入文件失败: " + tempFile;
+            }
+            out.close();
+            std::error_code ignored;
+            std::filesystem::remove(tempFile, ignored);
+            return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tempFile, file, ec);
+        if (ec) {
+            setError(error, "无法替换文件 " + file + ": " + ec.message());
+            std::filesystem::remove(tempFile, ec);
+            return false;
+        }
+        return true;
+    }
+
+    std::string AssetPackWriter::guessType(const std::string& path) {
+        std::string ext = std::filesystem::path(path).extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) {
+            return static_cast<char>(std::tolower(c));
+        });
+        if (ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".gif" || ext == ".bmp" || ext == ".webp") {
+            return "image";
+        }
+        if (ext == ".json") {
+            return "json";
+        }
+        if (ext == ".txt" || ext == ".xml" || ext == ".csv") {
+            return "text";
+        }
+        if (ext == ".fnt") {
+            return "font";
+        }
+        if (ext == ".mp3" || ext == ".ogg" || ext == ".wav") {
+            return "sound";
+        }
+        return "bin";
+    }
+
+    // ========== 挂载 ==========
+
+    void mountPack(std::shared_ptr<AssetPack> pack, const std::string& mountPoint) {
+        if (!pack) {
+            return;
+        }
+        std::string prefix = AssetPack::normalizePath(mountPoint);
+        if (!prefix.empty() && prefix.back() != '/') {
+            prefix += '/';
+        }
+        MountTable& table = mountTable();
+        std::unique_lock<std::shared_mutex> lock(table.mutex);
+        table.mounts.push_back(Mount{std::move(pack), std::move(prefix)});
+    }
+
+    std::shared_ptr<AssetPack> mountPack(const std::string& file, const std::string& mountPoint, std::string* error) {
+        std::shared_ptr<AssetPack> pack = AssetPack::open(file, error);
+        if (pack) {
+            mountPack(pack, mountPoint);
+        }
+        return pack;
+    }
+
+    bool unmountPack(const std::shared_ptr<AssetPack>& pack) {
+        MountTable& table = mountTable();
+        std::unique_lock<std::shared_mutex> lock(table.mutex);
+        auto it = std::remove_if(table.mounts.begin(), table.mounts.end(),
+                                 [&pack](const Mount& mount) { return mount.pack == pack; });
+        bool found = it != table.mounts.end();
+        table.mounts.erase(it, table.mounts.end());
+        return found;
+    }
+
+    void unmountAllPacks() {
+        MountTable& table = mountTable();
+        std::unique_lock<std::shared_mutex> lock(table.mutex);
+        table.mounts.clear();
+    }
+
+    bool findPackedFile(const std::string& path, PackedFile& file, std::string* error) {
+        MountTable& table = mountTable();
+        std::shared_ptr<const AssetPack> pack;
+        AssetPack::Entry entry;
+        {
+            std::shared_lock<std::shared_mutex> lock(table.mutex);
+            if (table.mounts.empty()) {
+                return false;
+            }
+            std::string normalized = AssetPack::normalizePath(path);
+            // 后挂载的资源包优先
+            for (auto it = table.mounts.rbegin(); it != table.mounts.rend(); ++it) {
+                const std::string& prefix = it->prefix;
+                if (normalized.size() <= prefix.size() || normalized.compare(0, prefix.size(), prefix) != 0) {
+                    continue;
+                }
+                if (it->pack->find(std::string_view(normalized).substr(prefix.size()), entry)) {
+                    pack = it->pack;
+                    break;
+                }
+            }
+        }
+        if (!pack) {
+            return false;
+        }
+        // 校验在锁外进行，避免阻塞挂载与其他读取
+        if (pack->getVerifyOnRead() && !pack->verify(entry)) {
+            setError(error, "资源包 " + pack->getFilePath() + " 中的文件CRC32校验失败: " + std::string(entry.path));
+            return false;
+        }
+        file.data = pack->getData(entry);
+        file.pack = std::move(pack);
+        return true;
+    }
+
+} // namespace RES
@@ -0,0 +1,299 @@
+/**
+ * @file AssetPack.hpp
+ * @brief 资源包 - 把大量小文件合并为一个带索引的文件，运行时通过内存映射读取
+ *
+ * TypeScript版本由浏览器逐个请求资源URL，没有对应的实现。
+ * 在本地文件系统上逐个打开数百个小文件时，耗时主要花在open/read系统调用与文件系统查找上
+ * （SD卡等慢速存储尤其明显），资源包把这些文件合并为一个文件：
+ * 文件头之后是按路径哈希排序的目录（偏移、大小、类型、CRC32），运行时映射整个文件，
+ * 按路径二分查找后直接返回映射内存中的字节，解码器无需复制即可读取。
+ *
+ * 文件格式（整数均为小端序）：
+ * - 文件头（32字节）：magic "EPAK"、版本、条目数、字符串表大小、字符串表偏移、保留字段
+ * - 目录（每项40字节，按哈希升序）：路径哈希、数据偏移、数据大小、CRC32、
+ *   路径在字符串表中的偏移、路径长度、类型长度（类型字符串紧跟在路径之后）、保留字段
+ * - 字符串表
+ * - 文件数据（每个文件按16字节对齐）
+ *
+ * 资源包由离线工具egret-pack（tools/AssetPacker.cpp）或AssetPackWriter生成。
+ * 挂载（mountPack）之后，RES读取文件时先在已挂载的资源包中查找，找不到再读取磁盘。
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace RES {
+
+/**
+ * @brief 只读字节区间
+ */
+using ByteSpan = std::span<const uint8_t>;
+
+/**
+ * @brief AssetPack类 - 内存映射的只读资源包
+ *
+ * 打开时只校验文件头与目录，不读取文件数据；文件数据在首次访问时由操作系统按页载入。
+ * 所有查询方法都是线程安全的，可以在任务线程上并发调用。
+ * 返回的ByteSpan指向映射内存，在AssetPack销毁前一直有效，使用期间应持有其shared_ptr。
+ */
+class AssetPack {
+public:
+    /**
+     * @brief 目录中的一项
+     *
+     * path与type指向映射内存，生命周期与AssetPack相同。
+     */
+    struct Entry {
+        uint64_t hash = 0;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        uint32_t crc32 = 0;
+        std::string_view path;
+        std::string_view type;
+    };
+
+    static constexpr char MAGIC[4] = {'E', 'P', 'A', 'K'};
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t HEADER_SIZE = 32;
+    static constexpr size_t ENTRY_SIZE = 40;
+    static constexpr size_t DATA_ALIGNMENT = 16;
+
+    /**
+     * @brief 打开并映射资源包
+     *
+     * @param file 资源包文件路径
+     * @param error 失败时写入错误信息，可为nullptr
+     * @return std::shared_ptr<AssetPack> 资源包，文件不存在或格式错误时返回nullptr
+     */
+    static std::shared_ptr<AssetPack> open(const std::string& file, std::string* error = nullptr);
+
+    ~AssetPack();
+
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    // ========== 查询 ==========
+
+    /**
+     * @brief 按路径查找文件
+     *
+     * @param path 包内路径，按normalizePath规范化后比较
+     * @param entry 输出目录项
+     * @return bool 找到返回true
+     */
+    bool find(std::string_view path, Entry& entry) const;
+
+    /**
+     * @brief 是否包含文件
+     */
+    bool contains(std::string_view path) const;
+
+    /**
+     * @brief 获取文件数据（零复制）
+     *
+     * 开启setVerifyOnRead时先校验CRC32，不一致时返回false。
+     *
+     * @param path 包内路径
+     * @param data 输出文件数据，指向映射内存
+     * @param error 失败时写入错误信息，可为nullptr
+     * @return bool 成功返回true
+     */
+    bool read(std::string_view path, ByteSpan& data, std::string* error = nullptr) const;
+
+    /**
+     * @brief 获取目录项对应的数据（不校验）
+     */
+    ByteSpan getData(const Entry& entry) const;
+
+    /**
+     * @brief 校验目录项的CRC32
+     */
+    bool verify(const Entry& entry) const;
+
+    /**
+     * @brief 按目录顺序（哈希升序）获取目录项
+     */
+    Entry getEntry(size_t index) const;
+    size_t getEntryCount() const { return m_entryCount; }
+
+    /**
+     * @brief 资源包文件路径
+     */
+    const std::string& getFilePath() const { return m_filePath; }
+
+    /**
+     * @brief 是否在read时校验CRC32，默认false
+     *
+     * 校验需要完整读取一遍文件数据，适合存储介质不可靠（如SD卡）的设备开启。
+     */
+    void setVerifyOnRead(bool value) { m_verifyOnRead.store(value, std::memory_order_relaxed); }
+    bool getVerifyOnRead() const { return m_verifyOnRead.load(std::memory_order_relaxed); }
+
+    // ========== 工具函数 ==========
+
+    /**
+     * @brief 规范化包内路径
+     *
+     * 反斜杠转为'/'，合并重复的'/'，去掉"."段并解析".."段。
+     * 例如："assets\\ui//./bg.png" => "assets/ui/bg.png"
+     */
+    static std::string normalizePath(std::string_view path);
+
+    /**
+     * @brief 计算规范化路径的哈希（64位FNV-1a）
+     */
+    static uint64_t hashPath(std::string_view normalizedPath);
+
+    /**
+     * @brief 计算CRC32（IEEE 802.3，与zlib相同）
+     *
+     * @param data 数据
+     * @param crc 之前数据的CRC32，用于分段计算
+     */
+    static uint32_t crc32(ByteSpan data, uint32_t crc = 0);
+
+private:
+    AssetPack();
+
+    bool validate(std::string* error);
+    const uint8_t* entryAt(size_t index) const;
+
+    std::string m_filePath;
+    const uint8_t* m_base;
+    size_t m_size;
+    size_t m_entryCount;
+    const uint8_t* m_strings;
+    size_t m_stringsSize;
+    std::atomic<bool> m_verifyOnRead;
+
+#ifdef _WIN32
+    void* m_fileHandle;
+    void* m_mappingHandle;
+#endif
+};
+
+/**
+ * @brief AssetPackWriter类 - 生成资源包
+ *
+ * 离线打包工具与运行时生成缓存包都可以使用。
+ * 从磁盘添加的文件在write时才逐个读取，不会一次性把所有文件读入内存。
+ */
+class AssetPackWriter {
+public:
+    /**
+     * @brief 添加内存中的数据
+     *
+     * @param path 包内路径
+     * @param type 资源类型，如ResourceItem::TYPE_IMAGE
+     * @param data 文件数据
+     */
+    void addData(const std::string& path, const std::string& type, std::vector<uint8_t> data);
+
+    /**
+     * @brief 添加磁盘上的文件
+     *
+     * @param path 包内路径
+     * @param type 资源类型，为空时按扩展名推断（见guessType）
+     * @param sourceFile 磁盘文件路径
+     */
+    void addFile(const std::string& path, const std::string& type, const std::string& sourceFile);
+
+    /**
+     * @brief 写出资源包
+     *
+     * 同一路径添加多次时保留最后一次。
+     *
+     * @param file 输出文件路径
+     * @param error 失败时写入错误信息，可为nullptr
+     * @return bool 成功返回true
+     */
+    bool write(const std::string& file, std::string* error = nullptr) const;
+
+    size_t getFileCount() const { return m_files.size(); }
+
+    /**
+     * @brief 按扩展名推断资源类型
+     *
+     * png/jpg/jpeg/gif/bmp/webp => image，json => json，txt/xml/csv => text，
+     * fnt => font，mp3/ogg/wav => sound，其余 => bin。
+     * 精灵表与普通JSON扩展名相同，需要在resource.json或打包参数中指定sheet类型。
+     */
+    static std::string guessType(const std::string& path);
+
+private:
+    struct PendingFile {
+        std::string path;
+        std::string type;
+        std::string sourceFile;
+        std::vector<uint8_t> data;
+    };
+
+    std::vector<PendingFile> m_files;
+};
+
+// ========== 挂载 ==========
+
+/**
+ * @brief 从已挂载资源包中找到的文件
+ *
+ * 持有资源包的引用，保证data在使用期间有效（即使资源包已被卸载）。
+ */
+struct PackedFile {
+    std::shared_ptr<const AssetPack> pack;
+    ByteSpan data;
+};
+
+/**
+ * @brief 挂载资源包
+ *
+ * 挂载后，路径在mountPoint之下的文件先在资源包中查找：
+ * 例如mountPoint为"resource"时，"resource/assets/bg.png"对应包内路径"assets/bg.png"。
+ * mountPoint为空时直接使用完整路径查找。后挂载的资源包优先，可用于热更新补丁包。
+ * 可以在任意线程调用。
+ *
+ * @param pack 资源包
+ * @param mountPoint 挂载路径，通常是资源根路径
+ */
+void mountPack(std::shared_ptr<AssetPack> pack, const std::string& mountPoint = "");
+
+/**
+ * @brief 打开并挂载资源包
+ *
+ * @return std::shared_ptr<AssetPack> 资源包，打开失败时返回nullptr
+ */
+std::shared_ptr<AssetPack> mountPack(const std::string& file, const std::string& mountPoint = "",
+                                     std::string* error = nullptr);
+
+/**
+ * @brief 卸载资源包
+ *
+ * 正在读取的任务仍持有资源包引用，映射在它们结束后才解除。
+ *
+ * @return bool 资源包已挂载时返回true
+ */
+bool unmountPack(const std::shared_ptr<AssetPack>& pack);
+
+/**
+ * @brief 卸载所有资源包
+ */
+void unmountAllPacks();
+
+/**
+ * @brief 在已挂载的资源包中查找文件（线程安全）
+ *
+ * @param path 文件路径（已拼接资源根路径）
+ * @param file 输出找到的文件
+ * @param error 找到文件但CRC32校验失败时写入错误信息（此时返回false），可为nullptr
+ * @return bool 找到并读取成功返回true，没有资源包包含该文件时返回false且不写入error
+ */
+bool findPackedFile(const std::string& path, PackedFile& file, std::string* error = nullptr);
+
+} // namespace RES
@@ -26,7 +26,7 @@ namespace RES {
 
     void NewFileSystem::profile() {
         EGRET_INFO("FileSystem 内容:");
-        printDictionary(m_data);
+        printDictionary(std::any_cast<const Dictionary&>(m_data));
     }
 
     void NewFileSystem::addFile(const std::string& filename, const std::string& type) {
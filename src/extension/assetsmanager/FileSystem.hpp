@@ -189,9 +189,10 @@ private:
     /**
      * @brief 文件系统数据存储
      * 
-     * 使用Dictionary结构存储整个文件系统的层次化数据。
+     * 使用Dictionary结构存储整个文件系统的层次化数据，
+     * 以std::any保存根节点，与子目录节点统一按std::any*解析。
      */
-    Dictionary m_data;
+    std::any m_data;
 
     /**
      * @brief 文件缓存
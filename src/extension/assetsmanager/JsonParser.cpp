@@ -0,0 +1,430 @@
+/**
+ * @file JsonParser.cpp
+ * @brief JSON解析器实现 - 递归下降解析，输出std::any表示的值
+ */
+
+#include "extension/assetsmanager/JsonParser.hpp"
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <system_error>
+
+namespace RES {
+
+namespace json {
+
+    namespace {
+
+        // 嵌套层数上限，防止恶意或损坏的文件导致栈溢出
+        constexpr int kMaxDepth = 512;
+
+        class Parser {
+        public:
+            explicit Parser(std::string_view text)
+                : m_text(text.data())
+                , m_end(text.data() + text.size())
+                , m_pos(text.data()) {
+                // 忽略UTF-8 BOM
+                if (m_end - m_pos >= 3 && std::memcmp(m_pos, "\xEF\xBB\xBF", 3) == 0) {
+                    m_pos += 3;
+                }
+            }
+
+            bool parseDocument(std::any& result) {
+                skipWhitespace();
+                if (!parseValue(result, 0)) {
+                    return false;
+                }
+                skipWhitespace();
+                if (m_pos != m_end) {
+                    return fail("多余的内容");
+                }
+                return true;
+            }
+
+            std::string getError() const {
+                return m_error + " (位置 " + std::to_string(m_errorOffset) + ")";
+            }
+
+        private:
+            bool fail(const char* message) {
+                if (m_error.empty()) {
+                    m_error = message;
+                    m_errorOffset = static_cast<size_t>(m_pos - m_text);
+                }
+                return false;
+            }
+
+            void skipWhitespace() {
+                while (m_pos < m_end && (*m_pos == ' ' || *m_pos == '\t' || *m_pos == '\n' || *m_pos == '\r')) {
+                    ++m_pos;
+                }
+            }
+
+            bool consumeLiteral(const char* literal) {
+                size_t length = std::strlen(literal);
+                if (static_cast<size_t>(m_end - m_pos) < length || std::memcmp(m_pos, literal, length) != 0) {
+                    return fail("无效的字面量");
+                }
+                m_pos += length;
+                return true;
+            }
+
+            bool parseValue(std::any& out, int depth) {
+                if (m_pos >= m_end) {
+                    return fail("意外的文件结尾");
+                }
+                switch (*m_pos) {
+                    case '{':
+                        return parseObject(out, depth + 1);
+                    case '[':
+                        return parseArray(out, depth + 1);
+                    case '"': {
+                        std::string value;
+                        if (!parseString(value)) {
+                            return false;
+                        }
+                        out = std::move(value);
+                        return true;
+                    }
+                    case 't':
+                        out = true;
+                        return consumeLiteral("true");
+                    case 'f':
+                        out = false;
+                        return consumeLiteral("false");
+                    case 'n':
+                        out.reset();
+                        return consumeLiteral("null");
+                    default:
+                        return parseNumber(out);
+                }
+            }
+
+            bool parseObject(std::any& out, int depth) {
+                if (depth > kMaxDepth) {
+                    return fail("嵌套层数过多");
+                }
+                ++m_pos; // '{'
+                Dictionary object;
+                skipWhitespace();
+                if (m_pos < m_end && *m_pos == '}') {
+                    ++m_pos;
+                    out = std::move(object);
+                    return true;
+                }
+                while (true) {
+                    skipWhitespace();
+                    if (m_pos >= m_end || *m_pos != '"') {
+                        return fail("对象的键必须是字符串");
+                    }
+                    std::string key;
+                    if (!parseString(key)) {
+                        return false;
+                    }
+                    skipWhitespace();
+                    if (m_pos >= m_end || *m_pos != ':') {
+                        return fail("缺少':'");
+                    }
+                    ++m_pos;
+                    skipWhitespace();
+                    std::any value;
+                    if (!parseValue(value, depth)) {
+                        return false;
+                    }
+                    object[std::move(key)] = std::move(value);
+                    skipWhitespace();
+                    if (m_pos < m_end && *m_pos == ',') {
+                        ++m_pos;
+                        continue;
+                    }
+                    if (m_pos < m_end && *m_pos == '}') {
+                        ++m_pos;
+                        out = std::move(object);
+                        return true;
+                    }
+                    return fail("缺少','或'}'");
+                }
+            }
+
+            bool parseArray(std::any& out, int depth) {
+                if (depth > kMaxDepth) {
+                    return fail("嵌套层数过多");
+                }
+                ++m_pos; // '['
+                JsonArray array;
+                skipWhitespace();
+                if (m_pos < m_end && *m_pos == ']') {
+                    ++m_pos;
+                    out = std::move(array);
+                    return true;
+                }
+                while (true) {
+                    skipWhitespace();
+                    std::any value;
+                    if (!parseValue(value, depth)) {
+                        return false;
+                    }
+                    array.push_back(std::move(value));
+                    skipWhitespace();
+                    if (m_pos < m_end && *m_pos == ',') {
+                        ++m_pos;
+                        continue;
+                    }
+                    if (m_pos < m_end && *m_pos == ']') {
+                        ++m_pos;
+                        out = std::move(array);
+                        return true;
+                    }
+                    return fail("缺少','或']'");
+                }
+            }
+
+            bool parseHex4(uint32_t& value) {
+                if (m_end - m_pos < 4) {
+                    return fail("无效的\\u转义");
+                }
+                value = 0;
+                for (int i = 0; i < 4; ++i) {
+                    char c = *m_pos++;
+                    value <<= 4;
+                    if (c >= '0' && c <= '9') {
+                        value |= static_cast<uint32_t>(c - '0');
+                    } else if (c >= 'a' && c <= 'f') {
+                        value |= static_cast<uint32_t>(c - 'a' + 10);
+                    } else if (c >= 'A' && c <= 'F') {
+                        value |= static_cast<uint32_t>(c - 'A' + 10);
+                    } else {
+                        return fail("无效的\\u转义");
+                    }
+                }
+                return true;
+            }
+
+            static void appendUtf8(std::string& out, uint32_t codepoint) {
+                if (codepoint < 0x80) {
+                    out.push_back(static_cast<char>(codepoint));
+                } else if (codepoint < 0x800) {
+                    out.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+                    out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+                } else if (codepoint < 0x10000) {
+                    out.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+                    out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+                    out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+                } else {
+                    out.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+                    out.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+                    out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+                    out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+                }
+            }
+
+            bool parseString(std::string& out) {
+                ++m_pos; // '"'
+                while (true) {
+                    // 连续的普通字符整段追加
+                    const char* start = m_pos;
+                    while (m_pos < m_end && *m_pos != '"' && *m_pos != '\\'
+                           && static_cast<unsigned char>(*m_pos) >= 0x20) {
+                        ++m_pos;
+                    }
+                    out.append(start, m_pos);
+                    if (m_pos >= m_end) {
+                        return fail("字符串未结束");
+                    }
+                    char c = *m_pos++;
+                    if (c == '"') {
+                        return true;
+                    }
+                    if (c != '\\') {
+                        --m_pos;
+                        return fail("字符串中包含控制字符");
+                    }
+                    if (m_pos >= m_end) {
+                        return fail("字符串未结束");
+                    }
+                    char escape = *m_pos++;
+                    switch (escape) {
+                        case '"': out.push_back('"'); break;
+                        case '\\': out.push_back('\\'); break;
+                        case '/': out.push_back('/'); break;
+                        case 'b': out.push_back('\b'); break;
+                        case 'f': out.push_back('\f'); break;
+                        case 'n': out.push_back('\n'); break;
+                        case 'r': out.push_back('\r'); break;
+                        case 't': out.push_back('\t'); break;
+                        case 'u': {
+                            uint32_t codepoint = 0;
+                            if (!parseHex4(codepoint)) {
+                                return false;
+                            }
+                            // 代理对
+                            if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+                                uint32_t low = 0;
+                                if (m_end - m_pos < 2 || m_pos[0] != '\\' || m_pos[1] != 'u') {
+                                    return fail("缺少低位代理");
+                                }
+                                m_pos += 2;
+                                if (!parseHex4(low)) {
+                                    return false;
+                                }
+                                if (low < 0xDC00 || low > 0xDFFF) {
+                                    return fail("无效的低位代理");
+                                }
+                                codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                            } else if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+                                return fail("孤立的低位代理");
+                            }
+                            appendUtf8(out, codepoint);
+                            break;
+                        }
+                        default:
+                            return fail("无效的转义字符");
+                    }
+                }
+            }
+
+            bool parseNumber(std::any& out) {
+                // 先按JSON语法校验，再交给from_chars转换
+                const char* start = m_pos;
+                const char* p = m_pos;
+                if (p < m_end && *p == '-') {
+                    ++p;
+                }
+                if (p >= m_end) {
+                    return fail("无效的数字");
+                }
+                if (*p == '0') {
+                    ++p;
+                } else if (*p >= '1' && *p <= '9') {
+                    while (p < m_end && *p >= '0' && *p <= '9') {
+                        ++p;
+                    }
+                } else {
+                    return fail("无效的值");
+                }
+                if (p < m_end && *p == '.') {
+                    ++p;
+                    if (p >= m_end || *p < '0' || *p > '9') {
+                        return fail("无效的数字");
+                    }
+                    while (p < m_end && *p >= '0' && *p <= '9') {
+                        ++p;
+                    }
+                }
+                if (p < m_end && (*p == 'e' || *p == 'E')) {
+                    ++p;
+                    if (p < m_end && (*p == '+' || *p == '-')) {
+                        ++p;
+                    }
+                    if (p >= m_end || *p < '0' || *p > '9') {
+                        return fail("无效的数字");
+                    }
+                    while (p < m_end && *p >= '0' && *p <= '9') {
+                        ++p;
+                    }
+                }
+
+                // from_chars不受全局locale影响（strtod在小数点为','的locale下会截断"1.5"），可在工作线程上安全调用
+                double value = 0.0;
+                auto [end, error] = std::from_chars(start, p, value);
+                if (error == std::errc::result_out_of_range) {
+                    value = outOfRangeValue(start, p);
+                } else if (error != std::errc() || end != p) {
+                    return fail("无效的数字");
+                }
+                out = value;
+                m_pos = p;
+                return true;
+            }
+
+            /**
+             * 超出double范围的数字按strtod的约定取值：上溢为±HUGE_VAL，下溢为±0
+             * 以首个有效数字的十进制数量级加上指数判断方向，[start, end)已通过JSON语法校验
+             */
+            static double outOfRangeValue(const char* start, const char* end) {
+                const bool negative = *start == '-';
+                const char* p = negative ? start + 1 : start;
+                long magnitude = 0;
+                if (*p != '0') {
+                    while (p < end && *p >= '0' && *p <= '9') {
+                        ++magnitude;
+                        ++p;
+                    }
+                    --magnitude;
+                } else {
+                    ++p;
+                    if (p < end && *p == '.') {
+                        ++p;
+                        magnitude = -1;
+                        while (p < end && *p == '0') {
+                            --magnitude;
+                            ++p;
+                        }
+                    }
+                }
+                while (p < end && *p != 'e' && *p != 'E') {
+                    ++p;
+                }
+                long exponent = 0;
+                if (p < end) {
+                    ++p;
+                    const bool negativeExponent = *p == '-';
+                    if (*p == '+' || *p == '-') {
+                        ++p;
+                    }
+                    // 指数位数可能很多，饱和到足以判断方向的范围
+                    for (; p < end && exponent < 100000; ++p) {
+                        exponent = exponent * 10 + (*p - '0');
+                    }
+                    if (negativeExponent) {
+                        exponent = -exponent;
+                    }
+                }
+                const double value = magnitude + exponent > 0 ? HUGE_VAL : 0.0;
+                return negative ? -value : value;
+            }
+
+            const char* m_text;
+            const char* m_end;
+            const char* m_pos;
+            std::string m_error;
+            size_t m_errorOffset = 0;
+        };
+
+    } // namespace
+
+    bool parse(std::string_view text, std::any& result, std::string* error) {
+        Parser parser(text);
+        std::any value;
+        if (!parser.parseDocument(value)) {
+            if (error) {
+                *error = parser.getError();
+            }
+            return false;
+        }
+        result = std::move(value);
+        return true;
+    }
+
+    std::string getString(const Dictionary& object, const std::string& key, const std::string& defaultValue) {
+        auto it = object.find(key);
+        if (it != object.end() && it->second.type() == typeid(std::string)) {
+            return std::any_cast<const std::string&>(it->second);
+        }
+        return defaultValue;
+    }
+
+    double getNumber(const Dictionary& object, const std::string& key, double defaultValue) {
+        auto it = object.find(key);
+        if (it != object.end() && it->second.type() == typeid(double)) {
+            return std::any_cast<double>(it->second);
+        }
+        return defaultValue;
+    }
+
+} // namespace json
+
+} // namespace RES
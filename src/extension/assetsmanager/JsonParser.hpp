@@ -0,0 +1,64 @@
+/**
+ * @file JsonParser.hpp
+ * @brief JSON解析器 - 资源配置文件与JSON资源的解析
+ *
+ * TypeScript版本直接使用浏览器的JSON.parse，C++版本没有对应的内置实现，
+ * 这里提供一个只依赖标准库的解析器，把JSON文本转换为std::any表示的值：
+ * 对象为Dictionary，数组为JsonArray，数字为double，字符串为std::string，
+ * 布尔值为bool，null为空的std::any。
+ * 解析器不访问任何全局状态，可以在工作线程中使用。
+ */
+
+#pragma once
+
+#include "extension/assetsmanager/FileSystem.hpp"
+#include <any>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace RES {
+
+/**
+ * @brief JSON数组类型
+ */
+using JsonArray = std::vector<std::any>;
+
+namespace json {
+
+    /**
+     * @brief 解析JSON文本
+     *
+     * 支持完整的JSON语法（RFC 8259），包括\\uXXXX转义与代理对，
+     * 字符串按UTF-8输出。文本开头的UTF-8 BOM会被忽略。
+     *
+     * @param text JSON文本（可以直接指向资源包中映射的内存，不需要复制）
+     * @param result 解析结果
+     * @param error 解析失败时写入错误描述（含出错位置），可为nullptr
+     * @return bool 解析成功返回true
+     */
+    bool parse(std::string_view text, std::any& result, std::string* error = nullptr);
+
+    /**
+     * @brief 读取对象中的字符串字段
+     *
+     * @param object JSON对象
+     * @param key 字段名
+     * @param defaultValue 字段不存在或不是字符串时的返回值
+     * @return std::string 字段值
+     */
+    std::string getString(const Dictionary& object, const std::string& key, const std::string& defaultValue = "");
+
+    /**
+     * @brief 读取对象中的数字字段
+     *
+     * @param object JSON对象
+     * @param key 字段名
+     * @param defaultValue 字段不存在或不是数字时的返回值
+     * @return double 字段值
+     */
+    double getNumber(const Dictionary& object, const std::string& key, double defaultValue = 0.0);
+
+} // namespace json
+
+} // namespace RES
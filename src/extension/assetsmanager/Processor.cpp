@@ -0,0 +1,294 @@
+/**
+ * @file Processor.cpp
+ * @brief 资源处理器实现 - 内置的image、json、text、bin、sheet处理器与注册表
+ *
+ * 翻译自：egret-core-5.4.1/src/extension/assetsmanager/src/processor/Processor.ts
+ */
+
+#include "extension/assetsmanager/Processor.hpp"
+#include "extension/assetsmanager/JsonParser.hpp"
+#include "extension/assetsmanager/Path.hpp"
+#include "display/BitmapData.hpp"
+#include "display/SpriteSheet.hpp"
+#include "display/Texture.hpp"
+#include "net/ImageLoader.hpp"
+#include <fstream>
+#include <string_view>
+#include <unordered_map>
+
+namespace RES {
+
+namespace processor {
+
+    namespace {
+
+        /**
+         * 精灵表在任务线程上的解码结果
+         */
+        struct SheetDecoded {
+            egret::ImageLoader::DecodedImage image;
+            std::any config;
+        };
+
+        /**
+         * 任务线程上只解码出像素；BitmapData会登记纹理内存统计、释放时通知渲染器，只能在主线程创建
+         */
+        bool decodeImageFile(const std::string& path, egret::ImageLoader::DecodedImage& image, std::string& error) {
+            FileData file;
+            if (!openFile(path, file, &error)) {
+                return false;
+            }
+            return egret::ImageLoader::decodeImagePixels(file.data.data(), file.data.size(), image, &error);
+        }
+
+        std::string_view asText(const FileData& file) {
+            return std::string_view(reinterpret_cast<const char*>(file.data.data()), file.data.size());
+        }
+
+        bool readDiskFile(const std::string& path, std::vector<uint8_t>& data, std::string* error) {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (!file) {
+                if (error) {
+                    *error = "无法打开文件: " + path;
+                }
+                return false;
+            }
+            std::streamoff size = file.tellg();
+            if (size < 0) {
+                if (error) {
+                    *error = "无法读取文件大小: " + path;
+                }
+                return false;
+            }
+            data.resize(static_cast<size_t>(size));
+            file.seekg(0, std::ios::beg);
+            if (size > 0 && !file.read(reinterpret_cast<char*>(data.data()), size)) {
+                if (error) {
+                    *error = "读取文件失败: " + path;
+                }
+                return false;
+            }
+            return true;
+        }
+
+        std::shared_ptr<egret::Texture> createTexture(egret::ImageLoader::DecodedImage&& image) {
+            auto texture = std::make_shared<egret::Texture>();
+            texture->setBitmapData(egret::ImageLoader::createBitmapData(
+                std::move(image), egret::ImageLoader::getGlobalAutoPixelFormat()));
+            return texture;
+        }
+
+        std::unordered_map<std::string, std::shared_ptr<Processor>>& processors() {
+            static std::unordered_map<std::string, std::shared_ptr<Processor>> instance = {
+                {ResourceItem::TYPE_IMAGE, std::make_shared<ImageProcessor>()},
+                {ResourceItem::TYPE_JSON, std::make_shared<JsonProcessor>()},
+                {ResourceItem::TYPE_TEXT, std::make_shared<TextProcessor>()},
+                {ResourceItem::TYPE_BIN, std::make_shared<BinaryProcessor>()},
+                {ResourceItem::TYPE_SHEET, std::make_shared<SheetProcessor>()},
+            };
+            return instance;
+        }
+
+    } // namespace
+
+    // ========== ImageProcessor ==========
+
+    bool ImageProcessor::onLoadStart(const ResourceInfo& resource, const std::string& path,
+                                     std::any& result, std::string& error) {
+        // std::any要求可复制，像素由shared_ptr持有
+        auto image = std::make_shared<egret::ImageLoader::DecodedImage>();
+        if (!decodeImageFile(path, *image, error)) {
+            return false;
+        }
+        result = std::move(image);
+        return true;
+    }
+
+    std::any ImageProcessor::onLoadFinish(const ResourceInfo& resource, std::any&& decoded) {
+        auto image = std::any_cast<std::shared_ptr<egret::ImageLoader::DecodedImage>>(std::move(decoded));
+        return createTexture(std::move(*image));
+    }
+
+    void ImageProcessor::onRemoveStart(const ResourceInfo& resource, std::any& data) {
+        if (auto* texture = std::any_cast<std::shared_ptr<egret::Texture>>(&data)) {
+            if (*texture) {
+                (*texture)->dispose();
+            }
+        }
+    }
+
+    // ========== JsonProcessor ==========
+
+    bool JsonProcessor::onLoadStart(const ResourceInfo& resource, const std::string& path,
+                                    std::any& result, std::string& error) {
+        FileData file;
+        if (!openFile(path, file, &error)) {
+            return false;
+        }
+        auto value = std::make_shared<std::any>();
+        if (!json::parse(asText(file), *value, &error)) {
+            return false;
+        }
+        result = std::shared_ptr<const std::any>(std::move(value));
+        return true;
+    }
+
+    // ========== TextProcessor ==========
+
+    bool TextProcessor::onLoadStart(const ResourceInfo& resource, const std::string& path,
+                                    std::any& result, std::string& error) {
+        FileData file;
+        if (!openFile(path, file, &error)) {
+            return false;
+        }
+        result = std::string(asText(file));
+        return true;
+    }
+
+    // ========== BinaryProcessor ==========
+
+    bool BinaryProcessor::onLoadStart(const ResourceInfo& resource, const std::string& path,
+                                      std::any& result, std::string& error) {
+        FileData file;
+        if (!openFile(path, file, &error)) {
+            return false;
+        }
+        result = std::make_shared<const std::vector<uint8_t>>(file.data.begin(), file.data.end());
+        return true;
+    }
+
+    // ========== SheetProcessor ==========
+
+    bool SheetProcessor::onLoadStart(const ResourceInfo& resource, const std::string& path,
+                                     std::any& result, std::string& error) {
+        FileData configFile;
+        if (!openFile(path, configFile, &error)) {
+            return false;
+        }
+        auto decoded = std::make_shared<SheetDecoded>();
+        if (!json::parse(asText(configFile), decoded->config, &error)) {
+            return false;
+        }
+        if (decoded->config.type() != typeid(Dictionary)) {
+            error = "精灵表配置的根节点必须是对象";
+            return false;
+        }
+        std::string file = json::getString(std::any_cast<const Dictionary&>(decoded->config), "file");
+        if (file.empty()) {
+            error = "精灵表配置缺少file字段";
+            return false;
+        }
+        if (!decodeImageFile(getRelativePath(path, file), decoded->image, error)) {
+            return false;
+        }
+        result = std::move(decoded);
+        return true;
+    }
+
+    std::any SheetProcessor::onLoadFinish(const ResourceInfo& resource, std::any&& decoded) {
+        auto data = std::any_cast<std::shared_ptr<SheetDecoded>>(std::move(decoded));
+        auto spriteSheet = std::make_shared<egret::SpriteSheet>(createTexture(std::move(data->image)));
+
+        const Dictionary& config = std::any_cast<const Dictionary&>(data->config);
+        auto frames = config.find("frames");
+        if (frames != config.end() && frames->second.type() == typeid(Dictionary)) {
+            for (const auto& [name, value] : std::any_cast<const Dictionary&>(frames->second)) {
+                if (value.type() != typeid(Dictionary)) {
+                    continue;
+                }
+                const Dictionary& frame = std::any_cast<const Dictionary&>(value);
+                spriteSheet->createTexture(name,
+                                           static_cast<int>(json::getNumber(frame, "x")),
+                                           static_cast<int>(json::getNumber(frame, "y")),
+                                           static_cast<int>(json::getNumber(frame, "w")),
+                                           static_cast<int>(json::getNumber(frame, "h")),
+                                           static_cast<int>(json::getNumber(frame, "offX")),
+                                           static_cast<int>(json::getNumber(frame, "offY")),
+                                           static_cast<int>(json::getNumber(frame, "sourceW", -1)),
+                                           static_cast<int>(json::getNumber(frame, "sourceH", -1)));
+            }
+        }
+        return spriteSheet;
+    }
+
+    void SheetProcessor::onRemoveStart(const ResourceInfo& resource, std::any& data) {
+        if (auto* spriteSheet = std::any_cast<std::shared_ptr<egret::SpriteSheet>>(&data)) {
+            if (*spriteSheet) {
+                (*spriteSheet)->dispose();
+            }
+        }
+    }
+
+    std::any SheetProcessor::getData(const std::any& data, const std::string& subkey) {
+        if (subkey.empty()) {
+            return data;
+        }
+        const auto* spriteSheet = std::any_cast<std::shared_ptr<egret::SpriteSheet>>(&data);
+        if (!spriteSheet || !*spriteSheet) {
+            return std::any();
+        }
+        std::shared_ptr<egret::Texture> texture = (*spriteSheet)->getTexture(subkey);
+        return texture ? std::any(texture) : std::any();
+    }
+
+    // ========== 注册表 ==========
+
+    void registerProcessor(const std::string& type, std::shared_ptr<Processor> processor) {
+        if (processor) {
+            processors()[type] = std::move(processor);
+        } else {
+            processors().erase(type);
+        }
+    }
+
+    std::shared_ptr<Processor> getProcessor(const std::string& type) {
+        auto& map = processors();
+        auto it = map.find(type);
+        return it != map.end() ? it->second : nullptr;
+    }
+
+    // ========== 工具函数 ==========
+
+    bool openFile(const std::string& path, FileData& file, std::string* error) {
+        PackedFile packed;
+        std::string packError;
+        if (findPackedFile(path, packed, &packError)) {
+            file.data = packed.data;
+            file.owner = std::move(packed.pack);
+            return true;
+        }
+        if (!packError.empty()) {
+            if (error) {
+                *error = std::move(packError);
+            }
+            return false;
+        }
+        auto bytes = std::make_shared<std::vector<uint8_t>>();
+        if (!readDiskFile(path, *bytes, error)) {
+            return false;
+        }
+        file.data = ByteSpan(bytes->data(), bytes->size());
+        file.owner = std::move(bytes);
+        return true;
+    }
+
+    bool readFile(const std::string& path, std::vector<uint8_t>& data, std::string* error) {
+        FileData file;
+        if (!openFile(path, file, error)) {
+            return false;
+        }
+        data.assign(file.data.begin(), file.data.end());
+        return true;
+    }
+
+    std::string getRelativePath(const std::string& url, const std::string& file) {
+        if (path::isAbsolute(file)) {
+            return file;
+        }
+        std::string folder = path::dirname(url);
+        return folder.empty() ? file : folder + "/" + file;
+    }
+
+} // namespace processor
+
+} // namespace RES
@@ -0,0 +1,220 @@
+/**
+ * @file Processor.hpp
+ * @brief 资源处理器 - 按资源类型读取、解码与释放资源
+ *
+ * 翻译自：egret-core-5.4.1/src/extension/assetsmanager/src/processor/Processor.ts
+ * TypeScript版本的处理器在主线程上通过浏览器异步加载；C++版本把处理拆成两个阶段：
+ * onLoadStart在任务线程上读取文件并完成解码、解析等耗时工作，
+ * onLoadFinish回到主线程创建纹理等只能在主线程使用的对象。
+ */
+
+#pragma once
+
+#include "extension/assetsmanager/AssetPack.hpp"
+#include "extension/assetsmanager/ResourceItem.hpp"
+#include <any>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace RES {
+
+/**
+ * @brief processor命名空间 - 资源处理器与注册表
+ *
+ * 内置处理器：image、json、text、bin、sheet。
+ * 可以通过registerProcessor为自定义类型注册处理器或替换内置处理器，
+ * 注册只能在主线程进行。
+ *
+ * @version Egret 5.2
+ * @note 对应TypeScript的RES.processor命名空间
+ */
+namespace processor {
+
+    /**
+     * @brief 资源处理器接口
+     */
+    class Processor {
+    public:
+        virtual ~Processor() = default;
+
+        /**
+         * @brief 读取并解码资源（任务线程）
+         *
+         * 可能在多个任务线程上同时调用，实现不能修改共享状态，也不能访问显示列表与事件系统。
+         *
+         * @param resource 资源信息
+         * @param path 资源文件路径（已拼接资源根路径）
+         * @param result 输出中间结果，交给onLoadFinish
+         * @param error 失败时写入错误信息
+         * @return bool 成功返回true
+         */
+        virtual bool onLoadStart(const ResourceInfo& resource, const std::string& path,
+                                 std::any& result, std::string& error) = 0;
+
+        /**
+         * @brief 创建最终的资源对象（主线程）
+         *
+         * @param resource 资源信息
+         * @param decoded onLoadStart输出的中间结果
+         * @return std::any 资源对象，即getRes返回的值
+         */
+        virtual std::any onLoadFinish(const ResourceInfo& resource, std::any&& decoded) {
+            return std::move(decoded);
+        }
+
+        /**
+         * @brief 资源被销毁（主线程）
+         *
+         * @param resource 资源信息
+         * @param data onLoadFinish返回的资源对象
+         */
+        virtual void onRemoveStart(const ResourceInfo& resource, std::any& data) {}
+
+        /**
+         * @brief 获取资源或其子资源（主线程）
+         *
+         * @param data 资源对象
+         * @param subkey 子键，为空时返回资源本身
+         * @return std::any 子资源，不存在时为空
+         */
+        virtual std::any getData(const std::any& data, const std::string& subkey) {
+            return subkey.empty() ? data : std::any();
+        }
+    };
+
+    /**
+     * @brief 图片处理器
+     *
+     * 任务线程上解码出像素，主线程创建BitmapData与Texture。
+     * 资源对象类型：std::shared_ptr<egret::Texture>
+     */
+    class ImageProcessor : public Processor {
+    public:
+        bool onLoadStart(const ResourceInfo& resource, const std::string& path,
+                         std::any& result, std::string& error) override;
+        std::any onLoadFinish(const ResourceInfo& resource, std::any&& decoded) override;
+        void onRemoveStart(const ResourceInfo& resource, std::any& data) override;
+    };
+
+    /**
+     * @brief JSON处理器
+     *
+     * 任务线程上完成解析，解析结果共享而不复制。
+     * 资源对象类型：std::shared_ptr<const std::any>，值的表示见json::parse
+     */
+    class JsonProcessor : public Processor {
+    public:
+        bool onLoadStart(const ResourceInfo& resource, const std::string& path,
+                         std::any& result, std::string& error) override;
+    };
+
+    /**
+     * @brief 文本处理器
+     *
+     * 资源对象类型：std::string
+     */
+    class TextProcessor : public Processor {
+    public:
+        bool onLoadStart(const ResourceInfo& resource, const std::string& path,
+                         std::any& result, std::string& error) override;
+    };
+
+    /**
+     * @brief 二进制处理器
+     *
+     * 资源对象类型：std::shared_ptr<const std::vector<uint8_t>>
+     */
+    class BinaryProcessor : public Processor {
+    public:
+        bool onLoadStart(const ResourceInfo& resource, const std::string& path,
+                         std::any& result, std::string& error) override;
+    };
+
+    /**
+     * @brief 精灵表处理器
+     *
+     * 读取TexturePacker格式的JSON（file、frames），在同一个任务中解码其引用的图片，
+     * 主线程创建SpriteSheet和各帧纹理；getData按子键返回帧纹理。
+     * 资源对象类型：std::shared_ptr<egret::SpriteSheet>
+     */
+    class SheetProcessor : public Processor {
+    public:
+        bool onLoadStart(const ResourceInfo& resource, const std::string& path,
+                         std::any& result, std::string& error) override;
+        std::any onLoadFinish(const ResourceInfo& resource, std::any&& decoded) override;
+        void onRemoveStart(const ResourceInfo& resource, std::any& data) override;
+        std::any getData(const std::any& data, const std::string& subkey) override;
+    };
+
+    // ========== 注册表 ==========
+
+    /**
+     * @brief 注册资源类型的处理器
+     *
+     * @param type 资源类型，如ResourceItem::TYPE_IMAGE
+     * @param processor 处理器，传入nullptr表示移除
+     */
+    void registerProcessor(const std::string& type, std::shared_ptr<Processor> processor);
+
+    /**
+     * @brief 获取资源类型的处理器
+     *
+     * @param type 资源类型
+     * @return std::shared_ptr<Processor> 处理器，未注册时返回nullptr
+     */
+    std::shared_ptr<Processor> getProcessor(const std::string& type);
+
+    // ========== 工具函数 ==========
+
+    /**
+     * @brief 打开的文件内容
+     *
+     * 来自已挂载的资源包时data直接指向映射内存，owner持有资源包；
+     * 否则owner持有从磁盘读入的数据。data在FileData销毁前有效。
+     */
+    struct FileData {
+        ByteSpan data;
+        std::shared_ptr<const void> owner;
+    };
+
+    /**
+     * @brief 打开整个文件（线程安全）
+     *
+     * 先在已挂载的资源包中查找（见mountPack），找不到再读取磁盘文件。
+     * 处理器应优先使用该函数，资源包中的文件可以不经复制直接交给解码器。
+     *
+     * @param path 文件路径（已拼接资源根路径）
+     * @param file 输出文件内容
+     * @param error 失败时写入错误信息，可为nullptr
+     * @return bool 成功返回true
+     */
+    bool openFile(const std::string& path, FileData& file, std::string* error = nullptr);
+
+    /**
+     * @brief 读取整个文件（线程安全）
+     *
+     * 与openFile相同先查找已挂载的资源包，结果复制到data中。
+     *
+     * @param path 文件路径
+     * @param data 输出文件内容
+     * @param error 失败时写入错误信息，可为nullptr
+     * @return bool 成功返回true
+     */
+    bool readFile(const std::string& path, std::vector<uint8_t>& data, std::string* error = nullptr);
+
+    /**
+     * @brief 计算相对于某个文件的路径
+     *
+     * 例如："assets/ui.json"与"ui.png" => "assets/ui.png"
+     *
+     * @param url 参照文件的路径
+     * @param file 相对路径
+     * @return std::string 拼接后的路径
+     */
+    std::string getRelativePath(const std::string& url, const std::string& file);
+
+} // namespace processor
+
+} // namespace RES
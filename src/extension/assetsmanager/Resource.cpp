@@ -0,0 +1,447 @@
+/**
+ * @file Resource.cpp
+ * @brief RES资源管理器实现
+ *
+ * 翻译自：egret-core-5.4.1/src/extension/assetsmanager/src/Resource.ts
+ */
+
+#include "extension/assetsmanager/Resource.hpp"
+#include "extension/assetsmanager/JsonParser.hpp"
+#include "extension/assetsmanager/Processor.hpp"
+#include "extension/assetsmanager/ResourceEvent.hpp"
+#include "core/jobs/JobSystem.hpp"
+#include "events/ProgressEvent.hpp"
+#include "utils/CallLater.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+
+namespace RES {
+
+    Resource::Resource()
+        : EventDispatcher()
+        , m_loader([this](const ResourceInfo& resource, std::any data, const std::string& error) {
+              onResourceLoaded(resource, std::move(data), error);
+          })
+        , m_alive(std::make_shared<bool>(true)) {
+    }
+
+    Resource::~Resource() = default;
+
+    // ========== 配置 ==========
+
+    void Resource::loadConfig(const std::string& url, const std::string& resourceRoot) {
+        struct ConfigState {
+            std::any data;
+            std::string error;
+        };
+        auto state = std::make_shared<ConfigState>();
+
+        egret::sys::JobSystem& jobs = egret::sys::getJobSystem();
+        egret::sys::JobHandle job = jobs.schedule([state, url]() {
+            processor::FileData file;
+            if (processor::openFile(url, file, &state->error)) {
+                std::string_view text(reinterpret_cast<const char*>(file.data.data()), file.data.size());
+                json::parse(text, state->data, &state->error);
+            }
+        });
+
+        std::weak_ptr<bool> alive = m_alive;
+        jobs.runOnMainThread(job, [this, alive, state, url, resourceRoot]() {
+            if (alive.expired()) {
+                return;
+            }
+            if (state->error.empty()) {
+                m_config.parseConfig(state->data, resourceRoot, &state->error);
+            }
+            if (state->error.empty()) {
+                ResourceEvent::dispatchResourceEvent(this, ResourceEvent::CONFIG_COMPLETE);
+            } else {
+                EGRET_ERRORF("RES: 加载配置文件 {} 失败: {}", url, state->error);
+                ResourceEvent::dispatchResourceEvent(this, ResourceEvent::CONFIG_LOAD_ERROR);
+            }
+        });
+    }
+
+    // ========== 资源组 ==========
+
+    void Resource::loadGroup(const std::string& name, int priority) {
+        if (m_loadedGroups.count(name)) {
+            post([this, name]() {
+                ResourceEvent::dispatchResourceEvent(this, ResourceEvent::GROUP_COMPLETE, name);
+            });
+            return;
+        }
+
+        for (const auto& group : m_groupLoads) {
+            if (group->name == name) {
+                // 正在加载：按新的优先级提前排队中的资源
+                for (const ResourceInfo* resource : m_config.getGroupByName(name)) {
+                    if (group->waiting.count(resource->name)) {
+                        m_loader.load(*resource, priority);
+                    }
+                }
+                return;
+            }
+        }
+
+        if (!m_config.hasGroup(name)) {
+            EGRET_WARNF("RES: 资源组 {} 不存在", name);
+            post([this, name]() {
+                ResourceEvent::dispatchResourceEvent(this, ResourceEvent::GROUP_LOAD_ERROR, name);
+            });
+            return;
+        }
+
+        auto group = std::make_shared<GroupLoad>();
+        group->name = name;
+        std::vector<const ResourceInfo*> resources = m_config.getGroupByName(name);
+        group->total = static_cast<int>(resources.size());
+        m_groupLoads.push_back(group);
+
+        // 先登记全部待加载资源，再请求加载，避免加载器同步失败时资源组提前结束
+        std::vector<const ResourceInfo*> toLoad;
+        for (const ResourceInfo* resource : resources) {
+            auto cached = m_cache.find(resource->name);
+            if (cached != m_cache.end()) {
+                acquireForGroup(name, cached->second);
+                ++group->loaded;
+            } else {
+                group->waiting.insert(resource->name);
+                toLoad.push_back(resource);
+            }
+        }
+        for (const ResourceInfo* resource : toLoad) {
+            m_loader.load(*resource, priority);
+        }
+
+        if (group->waiting.empty()) {
+            post([this, group]() {
+                if (!group->cancelled) {
+                    finishGroup(group);
+                }
+            });
+        }
+    }
+
+    bool Resource::isGroupLoaded(const std::string& name) const {
+        return m_loadedGroups.count(name) > 0;
+    }
+
+    std::vector<ResourceItemData> Resource::getGroupByName(const std::string& name) const {
+        std::vector<ResourceItemData> result;
+        for (const ResourceInfo* resource : m_config.getGroupByName(name)) {
+            result.push_back(ResourceItem::convertToResItem(*resource));
+        }
+        return result;
+    }
+
+    bool Resource::createGroup(const std::string& name, const std::vector<std::string>& keys, bool override) {
+        return m_config.createGroup(name, keys, override);
+    }
+
+    // ========== 资源 ==========
+
+    bool Resource::hasRes(const std::string& key) const {
+        std::string subkey;
+        return m_config.getResourceWithSubkey(key, subkey) != nullptr;
+    }
+
+    std::any Resource::getRes(const std::string& key) {
+        std::string subkey;
+        const ResourceInfo* resource = m_config.getResourceWithSubkey(key, subkey);
+        auto it = m_cache.find(resource ? resource->name : key);
+        if (it == m_cache.end()) {
+            return std::any();
+        }
+        std::any value = getData(it->second, subkey);
+        if (value.has_value()) {
+            ++it->second.refCount;
+        }
+        return value;
+    }
+
+    void Resource::getResAsync(const std::string& key, GetResAsyncCallback callback, int priority) {
+        std::string subkey;
+        const ResourceInfo* resource = m_config.getResourceWithSubkey(key, subkey);
+        if (!resource) {
+            EGRET_WARNF("RES: getResAsync找不到资源 {}", key);
+            if (callback) {
+                callback(std::any(), key);
+            }
+            return;
+        }
+        if (m_cache.count(resource->name)) {
+            std::any value = getRes(key);
+            if (callback) {
+                callback(value, key);
+            }
+            return;
+        }
+        m_pendingRequests[resource->name].push_back({key, subkey, std::move(callback)});
+        m_loader.load(*resource, priority);
+    }
+
+    bool Resource::destroyRes(const std::string& name, bool force) {
+        bool isGroup = m_groupRefs.count(name) > 0
+            || std::any_of(m_groupLoads.begin(), m_groupLoads.end(),
+                           [&name](const std::shared_ptr<GroupLoad>& group) { return group->name == name; });
+        if (isGroup) {
+            cancelGroupLoad(name);
+            m_loadedGroups.erase(name);
+            auto refs = m_groupRefs.find(name);
+            if (refs != m_groupRefs.end()) {
+                std::unordered_set<std::string> names = std::move(refs->second);
+                m_groupRefs.erase(refs);
+                for (const auto& resourceName : names) {
+                    release(resourceName, force);
+                }
+            }
+            return true;
+        }
+
+        std::string subkey;
+        const ResourceInfo* resource = m_config.getResourceWithSubkey(name, subkey);
+        std::string resourceName = resource ? resource->name : name;
+        if (m_cache.find(resourceName) == m_cache.end()) {
+            return false;
+        }
+        release(resourceName, force);
+        return true;
+    }
+
+    int Resource::getRefCount(const std::string& key) const {
+        std::string subkey;
+        const ResourceInfo* resource = m_config.getResourceWithSubkey(key, subkey);
+        auto it = m_cache.find(resource ? resource->name : key);
+        return it != m_cache.end() ? it->second.refCount : 0;
+    }
+
+    void Resource::setMaxLoadingThread(size_t count) {
+        m_loader.setMaxThread(count);
+    }
+
+    size_t Resource::getMaxLoadingThread() const {
+        return m_loader.getMaxThread();
+    }
+
+    // ========== 加载完成 ==========
+
+    void Resource::onResourceLoaded(const ResourceInfo& resource, std::any data, const std::string& error) {
+        const std::string name = resource.name;
+        bool succeeded = error.empty();
+
+        // 先完成所有记账（引用计数、资源组进度），再派发事件与回调，回调中可以安全地调用destroyRes等接口
+        std::vector<PendingRequest> requests;
+        auto pending = m_pendingRequests.find(name);
+        if (pending != m_pendingRequests.end()) {
+            requests = std::move(pending->second);
+            m_pendingRequests.erase(pending);
+        }
+
+        std::vector<std::shared_ptr<GroupLoad>> groups;
+        for (const auto& group : m_groupLoads) {
+            if (group->waiting.erase(name)) {
+                ++group->loaded;
+                if (!succeeded) {
+                    ++group->errors;
+                }
+                groups.push_back(group);
+            }
+        }
+
+        if (succeeded) {
+            if (groups.empty() && requests.empty()) {
+                // 等待者都已取消：直接释放
+                if (auto processor = processor::getProcessor(resource.type)) {
+                    processor->onRemoveStart(resource, data);
+                }
+                return;
+            }
+            CacheEntry& entry = m_cache[name];
+            entry.resource = resource;
+            entry.data = std::move(data);
+            for (const auto& group : groups) {
+                acquireForGroup(group->name, entry);
+            }
+        } else {
+            ResourceEvent::dispatchResourceEvent(this, ResourceEvent::ITEM_LOAD_ERROR, "", &resource);
+        }
+
+        for (auto& request : requests) {
+            std::any value;
+            auto it = m_cache.find(name);
+            if (succeeded && it != m_cache.end()) {
+                value = getData(it->second, request.subkey);
+                if (value.has_value()) {
+                    ++it->second.refCount;
+                }
+            }
+            if (request.callback) {
+                request.callback(value, request.key);
+            }
+        }
+
+        for (const auto& group : groups) {
+            if (group->cancelled) {
+                continue;
+            }
+            ResourceEvent::dispatchResourceEvent(this, ResourceEvent::GROUP_PROGRESS, group->name, &resource,
+                                                 group->loaded, group->total);
+            egret::ProgressEvent::dispatchProgressEvent(this, egret::ProgressEvent::PROGRESS,
+                                                        group->loaded, group->total);
+            if (!group->cancelled && group->waiting.empty()) {
+                finishGroup(group);
+            }
+        }
+    }
+
+    void Resource::finishGroup(const std::shared_ptr<GroupLoad>& group) {
+        m_groupLoads.erase(std::remove(m_groupLoads.begin(), m_groupLoads.end(), group), m_groupLoads.end());
+        group->cancelled = true;
+        if (group->errors > 0) {
+            ResourceEvent::dispatchResourceEvent(this, ResourceEvent::GROUP_LOAD_ERROR, group->name);
+        } else {
+            m_loadedGroups.insert(group->name);
+            ResourceEvent::dispatchResourceEvent(this, ResourceEvent::GROUP_COMPLETE, group->name, nullptr,
+                                                 group->loaded, group->total);
+        }
+    }
+
+    void Resource::cancelGroupLoad(const std::string& name) {
+        auto it = std::find_if(m_groupLoads.begin(), m_groupLoads.end(),
+                               [&name](const std::shared_ptr<GroupLoad>& group) { return group->name == name; });
+        if (it == m_groupLoads.end()) {
+            return;
+        }
+        std::shared_ptr<GroupLoad> group = *it;
+        m_groupLoads.erase(it);
+        group->cancelled = true;
+        // 没有其他等待者的资源从队列中移除（已开始加载的完成后会被直接释放）
+        for (const auto& resourceName : group->waiting) {
+            if (!isWaitedFor(resourceName)) {
+                m_loader.cancel(resourceName);
+            }
+        }
+        group->waiting.clear();
+    }
+
+    // ========== 引用计数 ==========
+
+    void Resource::acquireForGroup(const std::string& group, CacheEntry& entry) {
+        if (m_groupRefs[group].insert(entry.resource.name).second) {
+            ++entry.refCount;
+        }
+    }
+
+    void Resource::release(const std::string& name, bool force) {
+        auto it = m_cache.find(name);
+        if (it == m_cache.end()) {
+            return;
+        }
+        if (!force && --it->second.refCount > 0) {
+            return;
+        }
+        removeEntry(name);
+    }
+
+    void Resource::removeEntry(const std::string& name) {
+        auto it = m_cache.find(name);
+        if (it == m_cache.end()) {
+            return;
+        }
+        CacheEntry entry = std::move(it->second);
+        m_cache.erase(it);
+
+        // 资源已不在缓存中，仍持有它的资源组不再算作已加载
+        for (auto& [group, names] : m_groupRefs) {
+            if (names.erase(name)) {
+                m_loadedGroups.erase(group);
+            }
+        }
+        if (auto processor = processor::getProcessor(entry.resource.type)) {
+            processor->onRemoveStart(entry.resource, entry.data);
+        }
+    }
+
+    std::any Resource::getData(const CacheEntry& entry, const std::string& subkey) const {
+        if (auto processor = processor::getProcessor(entry.resource.type)) {
+            return processor->getData(entry.data, subkey);
+        }
+        return subkey.empty() ? entry.data : std::any();
+    }
+
+    bool Resource::isWaitedFor(const std::string& name) const {
+        if (m_pendingRequests.count(name)) {
+            return true;
+        }
+        return std::any_of(m_groupLoads.begin(), m_groupLoads.end(),
+                           [&name](const std::shared_ptr<GroupLoad>& group) { return group->waiting.count(name) > 0; });
+    }
+
+    void Resource::post(std::function<void()> func) {
+        std::weak_ptr<bool> alive = m_alive;
+        egret::CallLaterSystem::callAsync([alive, func = std::move(func)]() {
+            if (!alive.expired()) {
+                func();
+            }
+        });
+    }
+
+    // ========== 全局接口 ==========
+
+    Resource& getInstance() {
+        static Resource instance;
+        return instance;
+    }
+
+    void loadConfig(const std::string& url, const std::string& resourceRoot) {
+        getInstance().loadConfig(url, resourceRoot);
+    }
+
+    void loadGroup(const std::string& name, int priority) {
+        getInstance().loadGroup(name, priority);
+    }
+
+    bool isGroupLoaded(const std::string& name) {
+        return getInstance().isGroupLoaded(name);
+    }
+
+    std::vector<ResourceItemData> getGroupByName(const std::string& name) {
+        return getInstance().getGroupByName(name);
+    }
+
+    bool createGroup(const std::string& name, const std::vector<std::string>& keys, bool override) {
+        return getInstance().createGroup(name, keys, override);
+    }
+
+    bool hasRes(const std::string& key) {
+        return getInstance().hasRes(key);
+    }
+
+    std::any getRes(const std::string& key) {
+        return getInstance().getRes(key);
+    }
+
+    void getResAsync(const std::string& key, GetResAsyncCallback callback, int priority) {
+        getInstance().getResAsync(key, std::move(callback), priority);
+    }
+
+    bool destroyRes(const std::string& name, bool force) {
+        return getInstance().destroyRes(name, force);
+    }
+
+    void setMaxLoadingThread(size_t count) {
+        getInstance().setMaxLoadingThread(count);
+    }
+
+    void addEventListener(const std::string& type, const egret::EventListener& listener, void* thisObject,
+                          bool useCapture, int priority) {
+        getInstance().addEventListener(type, listener, thisObject, useCapture, priority);
+    }
+
+    void removeEventListener(const std::string& type, const egret::EventListener& listener, void* thisObject,
+                             bool useCapture) {
+        getInstance().removeEventListener(type, listener, thisObject, useCapture);
+    }
+
+} // namespace RES
@@ -0,0 +1,261 @@
+/**
+ * @file Resource.hpp
+ * @brief RES资源管理器 - 配置加载、资源组加载、资源获取与释放
+ *
+ * 翻译自：egret-core-5.4.1/src/extension/assetsmanager/src/Resource.ts
+ * Resource是资源管理系统的入口，负责加载配置文件、按资源组加载资源、
+ * 获取已加载的资源并按引用计数释放。加载过程通过ResourceEvent与ProgressEvent通知。
+ * RES命名空间下的同名函数操作全局实例，与TypeScript的RES.loadGroup等接口对应。
+ */
+
+#pragma once
+
+#include "events/EventDispatcher.hpp"
+#include "extension/assetsmanager/ResourceConfig.hpp"
+#include "extension/assetsmanager/ResourceItem.hpp"
+#include "extension/assetsmanager/ResourceLoader.hpp"
+#include <any>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace RES {
+
+/**
+ * @brief getResAsync的完成回调
+ *
+ * @param value 资源对象，加载失败时为空
+ * @param key 请求时使用的键
+ */
+using GetResAsyncCallback = std::function<void(const std::any& value, const std::string& key)>;
+
+/**
+ * @brief Resource类 - 资源管理器
+ *
+ * 事件：
+ * - ResourceEvent::CONFIG_COMPLETE / CONFIG_LOAD_ERROR 配置文件加载完成或失败
+ * - ResourceEvent::GROUP_PROGRESS 资源组中一个资源加载结束（含失败），itemsLoaded/itemsTotal为进度
+ * - egret::ProgressEvent::PROGRESS 与GROUP_PROGRESS同时派发，bytesLoaded/bytesTotal为资源个数
+ * - ResourceEvent::GROUP_COMPLETE / GROUP_LOAD_ERROR 资源组加载完成或有资源加载失败
+ * - ResourceEvent::ITEM_LOAD_ERROR 单个资源加载失败
+ *
+ * 资源的读取与解码在任务线程上并行进行（同时进行的数量见setMaxLoadingThread），
+ * 待加载资源按优先级排队：getResAsync默认使用LoadPriority::IMMEDIATE，
+ * 会排在资源组预加载之前。所有事件与回调都在主线程派发。
+ *
+ * 引用计数：资源组加载完成后对组内每个资源持有一次引用，
+ * 每次成功的getRes/getResAsync也增加一次引用；destroyRes释放一次引用，
+ * 引用归零时调用处理器释放资源（如销毁纹理）。同一资源被多个资源组共用时，
+ * 销毁其中一个资源组不会影响其他资源组。
+ *
+ * @version Egret 5.2
+ * @note 对应TypeScript的RES.Resource类，只能在主线程使用
+ */
+class Resource : public egret::EventDispatcher {
+public:
+    Resource();
+    ~Resource() override;
+
+    Resource(const Resource&) = delete;
+    Resource& operator=(const Resource&) = delete;
+
+    // ========== 配置 ==========
+
+    /**
+     * @brief 加载配置文件并解析
+     *
+     * 文件读取与JSON解析在任务线程上进行，完成后派发CONFIG_COMPLETE或CONFIG_LOAD_ERROR。
+     *
+     * @param url 配置文件路径
+     * @param resourceRoot 资源根路径，配置中的资源URL相对于该路径
+     * @version Egret 5.2
+     */
+    void loadConfig(const std::string& url, const std::string& resourceRoot = "");
+
+    /**
+     * @brief 获取资源配置
+     */
+    ResourceConfig& getConfig() { return m_config; }
+
+    // ========== 资源组 ==========
+
+    /**
+     * @brief 加载资源组
+     *
+     * 已加载的资源直接计入进度，其余资源进入加载队列；
+     * 同一资源组正在加载时再次调用只会按新的优先级提前其中排队的资源。
+     *
+     * @param name 资源组名
+     * @param priority 加载优先级，数值越大越先加载，预加载可使用LoadPriority::PREFETCH
+     * @version Egret 5.2
+     */
+    void loadGroup(const std::string& name, int priority = LoadPriority::NORMAL);
+
+    /**
+     * @brief 资源组是否已加载完成
+     * @version Egret 5.2
+     */
+    bool isGroupLoaded(const std::string& name) const;
+
+    /**
+     * @brief 获取资源组包含的资源项
+     * @version Egret 5.2
+     */
+    std::vector<ResourceItemData> getGroupByName(const std::string& name) const;
+
+    /**
+     * @brief 创建自定义的资源组
+     *
+     * @param name 资源组名
+     * @param keys 资源名、子键或资源组名列表
+     * @param override 已存在同名资源组时是否覆盖
+     * @return bool 创建成功返回true
+     * @version Egret 5.2
+     */
+    bool createGroup(const std::string& name, const std::vector<std::string>& keys, bool override = false);
+
+    // ========== 资源 ==========
+
+    /**
+     * @brief 配置中是否有该资源
+     *
+     * @param key 资源名、URL或精灵表子键
+     * @version Egret 5.2
+     */
+    bool hasRes(const std::string& key) const;
+
+    /**
+     * @brief 同步获取已加载的资源
+     *
+     * 成功时增加一次引用计数，不再使用时应调用destroyRes。
+     *
+     * @param key 资源名、URL或精灵表子键（也可写作"资源名.子键"）
+     * @return std::any 资源对象，未加载时为空；各类型资源对象的类型见processor命名空间
+     * @version Egret 5.2
+     */
+    std::any getRes(const std::string& key);
+
+    /**
+     * @brief 异步获取资源，未加载时先加载
+     *
+     * 资源已加载时立即回调；成功时增加一次引用计数。
+     *
+     * @param key 资源名、URL或精灵表子键
+     * @param callback 完成回调，在主线程调用
+     * @param priority 加载优先级，默认为LoadPriority::IMMEDIATE
+     * @version Egret 5.2
+     */
+    void getResAsync(const std::string& key, GetResAsyncCallback callback,
+                     int priority = LoadPriority::IMMEDIATE);
+
+    /**
+     * @brief 释放资源或资源组
+     *
+     * 传入资源组名时释放资源组持有的引用（正在加载的资源组同时取消剩余的排队资源）；
+     * 传入资源名时释放一次引用。引用归零的资源被销毁。
+     *
+     * @param name 资源组名或资源名
+     * @param force 为true时不论引用计数立即销毁
+     * @return bool 找到并释放了资源或资源组时返回true
+     * @version Egret 5.2
+     */
+    bool destroyRes(const std::string& name, bool force = false);
+
+    /**
+     * @brief 资源当前的引用计数，未加载时为0
+     */
+    int getRefCount(const std::string& key) const;
+
+    /**
+     * @brief 设置最大同时加载数，默认4
+     * @version Egret 5.2
+     */
+    void setMaxLoadingThread(size_t count);
+    size_t getMaxLoadingThread() const;
+
+    /**
+     * @brief 获取加载队列
+     */
+    ResourceLoader& getLoader() { return m_loader; }
+
+private:
+    struct CacheEntry {
+        ResourceInfo resource;
+        std::any data;
+        int refCount = 0;
+    };
+
+    struct PendingRequest {
+        std::string key;
+        std::string subkey;
+        GetResAsyncCallback callback;
+    };
+
+    struct GroupLoad {
+        std::string name;
+        int total = 0;
+        int loaded = 0;
+        int errors = 0;
+        bool cancelled = false;
+        std::unordered_set<std::string> waiting;   // 尚未加载完的资源名
+    };
+
+    void onResourceLoaded(const ResourceInfo& resource, std::any data, const std::string& error);
+    void finishGroup(const std::shared_ptr<GroupLoad>& group);
+    void cancelGroupLoad(const std::string& name);
+
+    /**
+     * 资源组对资源持有一次引用（每个资源组对同一资源只持有一次）
+     */
+    void acquireForGroup(const std::string& group, CacheEntry& entry);
+
+    /**
+     * 释放一次引用，归零或force时销毁
+     */
+    void release(const std::string& name, bool force);
+    void removeEntry(const std::string& name);
+
+    std::any getData(const CacheEntry& entry, const std::string& subkey) const;
+    bool isWaitedFor(const std::string& name) const;
+
+    /**
+     * 在下一次SystemTicker::update时执行（资源组已全部就绪等情况，保证事件总是异步派发）
+     */
+    void post(std::function<void()> func);
+
+    ResourceConfig m_config;
+    ResourceLoader m_loader;
+    std::unordered_map<std::string, CacheEntry> m_cache;
+    std::unordered_map<std::string, std::vector<PendingRequest>> m_pendingRequests;
+    std::vector<std::shared_ptr<GroupLoad>> m_groupLoads;                        // 正在加载的资源组
+    std::unordered_map<std::string, std::unordered_set<std::string>> m_groupRefs; // 资源组 -> 持有引用的资源
+    std::unordered_set<std::string> m_loadedGroups;
+    std::shared_ptr<bool> m_alive;
+};
+
+/**
+ * @brief 获取全局资源管理器
+ */
+Resource& getInstance();
+
+// ========== 全局接口（操作全局资源管理器） ==========
+
+void loadConfig(const std::string& url, const std::string& resourceRoot = "");
+void loadGroup(const std::string& name, int priority = LoadPriority::NORMAL);
+bool isGroupLoaded(const std::string& name);
+std::vector<ResourceItemData> getGroupByName(const std::string& name);
+bool createGroup(const std::string& name, const std::vector<std::string>& keys, bool override = false);
+bool hasRes(const std::string& key);
+std::any getRes(const std::string& key);
+void getResAsync(const std::string& key, GetResAsyncCallback callback, int priority = LoadPriority::IMMEDIATE);
+bool destroyRes(const std::string& name, bool force = false);
+void setMaxLoadingThread(size_t count);
+void addEventListener(const std::string& type, const egret::EventListener& listener, void* thisObject = nullptr,
+                      bool useCapture = false, int priority = 0);
+void removeEventListener(const std::string& type, const egret::EventListener& listener, void* thisObject = nullptr,
+                         bool useCapture = false);
+
+} // namespace RES
@@ -0,0 +1,205 @@
+/**
+ * @file ResourceConfig.cpp
+ * @brief ResourceConfig实现 - 资源配置解析与查询
+ *
+ * 翻译自：egret-core-5.4.1/src/extension/assetsmanager/src/core/ResourceConfig.ts
+ */
+
+#include "extension/assetsmanager/ResourceConfig.hpp"
+#include "extension/assetsmanager/JsonParser.hpp"
+#include "extension/assetsmanager/Path.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+#include <unordered_set>
+
+namespace RES {
+
+    namespace {
+
+        /**
+         * 拆分逗号分隔的键列表，去掉首尾空白与空项
+         */
+        std::vector<std::string> splitKeys(const std::string& keys) {
+            std::vector<std::string> result;
+            size_t start = 0;
+            while (start <= keys.size()) {
+                size_t end = keys.find(',', start);
+                if (end == std::string::npos) {
+                    end = keys.size();
+                }
+                size_t first = keys.find_first_not_of(" \t\r\n", start);
+                if (first != std::string::npos && first < end) {
+                    size_t last = keys.find_last_not_of(" \t\r\n", end - 1);
+                    result.push_back(keys.substr(first, last - first + 1));
+                }
+                start = end + 1;
+            }
+            return result;
+        }
+
+        /**
+         * keys字段既可以是"a,b,c"字符串，也可以是字符串数组
+         */
+        std::vector<std::string> readKeys(const Dictionary& object, const std::string& field) {
+            auto it = object.find(field);
+            if (it == object.end()) {
+                return {};
+            }
+            if (it->second.type() == typeid(std::string)) {
+                return splitKeys(std::any_cast<const std::string&>(it->second));
+            }
+            std::vector<std::string> result;
+            if (it->second.type() == typeid(JsonArray)) {
+                for (const auto& item : std::any_cast<const JsonArray&>(it->second)) {
+                    if (item.type() == typeid(std::string)) {
+                        result.push_back(std::any_cast<const std::string&>(item));
+                    }
+                }
+            }
+            return result;
+        }
+
+    } // namespace
+
+    ResourceConfig::ResourceConfig() = default;
+
+    bool ResourceConfig::parseConfig(const std::any& data, const std::string& resourceRoot, std::string* error) {
+        if (data.type() != typeid(Dictionary)) {
+            if (error) {
+                *error = "配置文件的根节点必须是对象";
+            }
+            return false;
+        }
+        const Dictionary& root = std::any_cast<const Dictionary&>(data);
+
+        auto resources = root.find("resources");
+        if (resources != root.end() && resources->second.type() == typeid(JsonArray)) {
+            for (const auto& item : std::any_cast<const JsonArray&>(resources->second)) {
+                if (item.type() != typeid(Dictionary)) {
+                    continue;
+                }
+                const Dictionary& object = std::any_cast<const Dictionary&>(item);
+                ResourceInfo info(json::getString(object, "name"), json::getString(object, "url"),
+                                  json::getString(object, "type"), resourceRoot);
+                if (info.url.empty()) {
+                    EGRET_WARNF("RES: 资源 {} 缺少url，已忽略", info.name);
+                    continue;
+                }
+                addResourceData(info);
+                for (const auto& subkey : readKeys(object, "subkeys")) {
+                    m_subkeys[subkey] = info.name.empty() ? info.url : info.name;
+                }
+            }
+        }
+
+        auto groups = root.find("groups");
+        if (groups != root.end() && groups->second.type() == typeid(JsonArray)) {
+            for (const auto& item : std::any_cast<const JsonArray&>(groups->second)) {
+                if (item.type() != typeid(Dictionary)) {
+                    continue;
+                }
+                const Dictionary& object = std::any_cast<const Dictionary&>(item);
+                std::string name = json::getString(object, "name");
+                if (!name.empty()) {
+                    createGroup(name, readKeys(object, "keys"), true);
+                }
+            }
+        }
+        return true;
+    }
+
+    void ResourceConfig::addResourceData(const ResourceInfo& info) {
+        ResourceInfo entry = info;
+        if (entry.name.empty()) {
+            entry.name = entry.url;
+        }
+        std::string url = path::normalize(entry.url);
+        m_fileSystem.addFile(File(url, entry.type));
+        m_urlToName[url] = entry.name;
+        m_resources[entry.name] = std::move(entry);
+    }
+
+    const ResourceInfo* ResourceConfig::getResource(const std::string& nameOrUrl) const {
+        auto it = m_resources.find(nameOrUrl);
+        if (it != m_resources.end()) {
+            return &it->second;
+        }
+        auto url = m_urlToName.find(path::normalize(nameOrUrl));
+        if (url != m_urlToName.end()) {
+            it = m_resources.find(url->second);
+            if (it != m_resources.end()) {
+                return &it->second;
+            }
+        }
+        return nullptr;
+    }
+
+    const ResourceInfo* ResourceConfig::getResourceWithSubkey(const std::string& key, std::string& subkey) const {
+        subkey.clear();
+        if (const ResourceInfo* info = getResource(key)) {
+            return info;
+        }
+        auto it = m_subkeys.find(key);
+        if (it != m_subkeys.end()) {
+            subkey = key;
+            return getResource(it->second);
+        }
+        // "资源名.子键"
+        size_t dot = key.find('.');
+        if (dot != std::string::npos) {
+            if (const ResourceInfo* info = getResource(key.substr(0, dot))) {
+                subkey = key.substr(dot + 1);
+                return info;
+            }
+        }
+        return nullptr;
+    }
+
+    bool ResourceConfig::hasGroup(const std::string& name) const {
+        return m_groups.find(name) != m_groups.end();
+    }
+
+    std::vector<const ResourceInfo*> ResourceConfig::getGroupByName(const std::string& name) const {
+        std::vector<const ResourceInfo*> result;
+        std::unordered_set<const ResourceInfo*> added;
+        std::vector<std::string> visited;
+        collectGroup(name, result, added, visited);
+        return result;
+    }
+
+    void ResourceConfig::collectGroup(const std::string& name, std::vector<const ResourceInfo*>& result,
+                                      std::unordered_set<const ResourceInfo*>& added,
+                                      std::vector<std::string>& visited) const {
+        auto group = m_groups.find(name);
+        if (group == m_groups.end()
+            || std::find(visited.begin(), visited.end(), name) != visited.end()) {
+            return;
+        }
+        visited.push_back(name);
+        for (const auto& key : group->second) {
+            std::string subkey;
+            const ResourceInfo* info = getResourceWithSubkey(key, subkey);
+            if (info) {
+                if (added.insert(info).second) {
+                    result.push_back(info);
+                }
+            } else if (hasGroup(key)) {
+                collectGroup(key, result, added, visited);
+            } else {
+                EGRET_WARNF("RES: 资源组 {} 中的 {} 不存在", name, key);
+            }
+        }
+    }
+
+    bool ResourceConfig::createGroup(const std::string& name, const std::vector<std::string>& keys, bool override) {
+        if (!override && hasGroup(name)) {
+            return false;
+        }
+        if (keys.empty()) {
+            return false;
+        }
+        m_groups[name] = keys;
+        return true;
+    }
+
+} // namespace RES
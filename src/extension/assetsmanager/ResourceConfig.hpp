@@ -0,0 +1,126 @@
+/**
+ * @file ResourceConfig.hpp
+ * @brief ResourceConfig类 - 资源配置，解析resource.json中的资源与资源组
+ *
+ * 翻译自：egret-core-5.4.1/src/extension/assetsmanager/src/core/ResourceConfig.ts
+ * ResourceConfig保存资源名到资源信息的映射、资源组定义以及精灵表子键，
+ * 资源文件同时登记到FileSystem中，并支持按URL反查资源名。
+ */
+
+#pragma once
+
+#include "extension/assetsmanager/FileSystem.hpp"
+#include "extension/assetsmanager/ResourceItem.hpp"
+#include <any>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace RES {
+
+/**
+ * @brief ResourceConfig类 - 资源配置
+ *
+ * 配置文件格式与Egret的resource.json一致：
+ * @code
+ * {
+ *     "groups": [{ "name": "preload", "keys": "bg_jpg,ui_sheet" }],
+ *     "resources": [
+ *         { "name": "bg_jpg", "type": "image", "url": "assets/bg.jpg" },
+ *         { "name": "ui_sheet", "type": "sheet", "url": "assets/ui.json", "subkeys": "btn_ok,btn_cancel" }
+ *     ]
+ * }
+ * @endcode
+ * 资源组的keys可以是资源名、精灵表子键或其他资源组名。只在主线程使用。
+ *
+ * @version Egret 5.2
+ * @note 对应TypeScript的RES.ResourceConfig类
+ */
+class ResourceConfig {
+public:
+    ResourceConfig();
+
+    /**
+     * @brief 解析配置数据
+     *
+     * 合并到已有配置中，同名资源和资源组会被覆盖。
+     *
+     * @param data 已解析的JSON配置（Dictionary）
+     * @param resourceRoot 资源根路径，资源URL相对于该路径
+     * @param error 解析失败时写入错误描述，可为nullptr
+     * @return bool 解析成功返回true
+     * @version Egret 5.2
+     */
+    bool parseConfig(const std::any& data, const std::string& resourceRoot, std::string* error = nullptr);
+
+    /**
+     * @brief 添加单个资源
+     *
+     * @param info 资源信息，name为空时使用url作为名称
+     * @version Egret 5.2
+     */
+    void addResourceData(const ResourceInfo& info);
+
+    /**
+     * @brief 按资源名或URL获取资源信息
+     *
+     * @param nameOrUrl 资源名或URL
+     * @return const ResourceInfo* 资源信息，不存在时返回nullptr
+     */
+    const ResourceInfo* getResource(const std::string& nameOrUrl) const;
+
+    /**
+     * @brief 按资源名、URL或精灵表子键获取资源信息
+     *
+     * @param key 资源名、URL或子键，也支持"资源名.子键"的写法
+     * @param subkey 输出子键，key指向资源本身时为空
+     * @return const ResourceInfo* 资源信息，不存在时返回nullptr
+     */
+    const ResourceInfo* getResourceWithSubkey(const std::string& key, std::string& subkey) const;
+
+    /**
+     * @brief 资源组是否存在
+     */
+    bool hasGroup(const std::string& name) const;
+
+    /**
+     * @brief 获取资源组包含的资源
+     *
+     * 嵌套的资源组会被展开，重复的资源只保留一个。
+     *
+     * @param name 资源组名
+     * @return std::vector<const ResourceInfo*> 资源列表，资源组不存在时为空
+     * @version Egret 5.2
+     */
+    std::vector<const ResourceInfo*> getGroupByName(const std::string& name) const;
+
+    /**
+     * @brief 创建自定义的资源组
+     *
+     * @param name 资源组名
+     * @param keys 资源名、子键或资源组名列表
+     * @param override 已存在同名资源组时是否覆盖
+     * @return bool 创建成功返回true
+     * @version Egret 5.2
+     */
+    bool createGroup(const std::string& name, const std::vector<std::string>& keys, bool override = false);
+
+    /**
+     * @brief 获取资源文件系统
+     */
+    FileSystem& getFileSystem() { return m_fileSystem; }
+
+private:
+    void collectGroup(const std::string& name, std::vector<const ResourceInfo*>& result,
+                      std::unordered_set<const ResourceInfo*>& added,
+                      std::vector<std::string>& visited) const;
+
+    std::unordered_map<std::string, ResourceInfo> m_resources;          // 资源名 -> 资源信息
+    std::unordered_map<std::string, std::string> m_urlToName;           // 规范化URL -> 资源名
+    std::unordered_map<std::string, std::string> m_subkeys;             // 精灵表子键 -> 资源名
+    std::unordered_map<std::string, std::vector<std::string>> m_groups; // 资源组名 -> keys
+    NewFileSystem m_fileSystem;
+};
+
+} // namespace RES
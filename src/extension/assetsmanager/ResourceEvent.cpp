@@ -8,8 +8,6 @@
 
 #include "extension/assetsmanager/ResourceEvent.hpp"
 #include "events/IEventDispatcher.hpp"
-#include <vector>
-#include <mutex>
 
 namespace RES {
 
@@ -25,9 +23,10 @@ namespace RES {
     // ========== 对象池管理 ==========
 
     namespace {
-        // 简单的对象池实现
-        std::vector<std::unique_ptr<ResourceEvent>> eventPool;
-        std::mutex poolMutex;
+        egret::EventPool<ResourceEvent>& resourceEventPool() {
+            static egret::EventPool<ResourceEvent> pool("ResourceEvent");
+            return pool;
+        }
     }
 
     // ========== 构造函数和析构函数 ==========
@@ -56,7 +55,7 @@ namespace RES {
         }
 
         // 创建事件对象（使用对象池）
-        ResourceEvent* event = create(type);
+        std::shared_ptr<ResourceEvent> event = create(type);
         
         // 设置事件属性
         event->groupName = groupName;
@@ -81,52 +80,28 @@ namespace RES {
         return result;
     }
 
-    ResourceEvent* ResourceEvent::create(const std::string& type) {
-        std::lock_guard<std::mutex> lock(poolMutex);
-
-        ResourceEvent* event = nullptr;
-
-        // 尝试从对象池中获取
-        if (!eventPool.empty()) {
-            event = eventPool.back().release();
-            eventPool.pop_back();
-            
-            // 重置事件状态
-            event->setType(type);
-            event->resetInternal();
-        } else {
-            // 对象池为空，创建新对象
-            event = new ResourceEvent(type);
-        }
-
-        return event;
+    std::shared_ptr<ResourceEvent> ResourceEvent::create(const std::string& type, bool bubbles, bool cancelable) {
+        return resourceEventPool().acquire(type, bubbles, cancelable);
     }
 
-    void ResourceEvent::release(ResourceEvent* event) {
-        if (!event) {
-            return;
-        }
-
-        std::lock_guard<std::mutex> lock(poolMutex);
-
-        // 重置事件状态
-        event->resetInternal();
+    void ResourceEvent::release(std::shared_ptr<ResourceEvent> event) {
+        resourceEventPool().release(std::move(event));
+    }
 
-        // 返回对象池
-        eventPool.push_back(std::unique_ptr<ResourceEvent>(event));
+    const egret::EventPoolStats& ResourceEvent::getPoolStats() {
+        return resourceEventPool().getStats();
     }
 
     // ========== 受保护方法实现 ==========
 
-    void ResourceEvent::resetInternal() {
+    void ResourceEvent::clean() {
+        Event::clean();
+
         // 重置事件对象的状态，准备复用
         itemsLoaded = 0;
         itemsTotal = 0;
         groupName.clear();
         resItem = nullptr;
-        
-        // 调用父类的重置方法（如果有）
-        // Event::resetInternal();
     }
 
 } // namespace RES
\ No newline at end of file
@@ -181,31 +181,38 @@ public:
     /**
      * @brief 创建ResourceEvent对象（对象池模式）
      * 
-     * 从对象池中获取或创建新的ResourceEvent对象。
+     * 从对象池中取出或创建新的ResourceEvent对象。
      * 
      * @param type 事件类型
-     * @return ResourceEvent* 事件对象指针
+     * @param bubbles 确定Event对象是否参与事件流的冒泡阶段
+     * @param cancelable 确定是否可以取消Event对象
+     * @return std::shared_ptr<ResourceEvent> 事件对象
      * @version Egret 5.2
      */
-    static ResourceEvent* create(const std::string& type);
+    static std::shared_ptr<ResourceEvent> create(const std::string& type, bool bubbles = false, bool cancelable = false);
 
     /**
      * @brief 释放ResourceEvent对象（对象池模式）
      * 
-     * 将ResourceEvent对象返回到对象池中。
+     * 将ResourceEvent对象返回到对象池中，释放后不得再持有该实例。
      * 
-     * @param event 要释放的事件对象
+     * @param event 要释放的事件对象（必须是由ResourceEvent::create()创建的）
      * @version Egret 5.2
      */
-    static void release(ResourceEvent* event);
+    static void release(std::shared_ptr<ResourceEvent> event);
+
+    /**
+     * @brief 获取ResourceEvent对象池的统计信息
+     */
+    static const egret::EventPoolStats& getPoolStats();
 
 protected:
     /**
      * @brief 重置事件对象状态
      * 
-     * 在对象池复用时重置事件对象的状态。
+     * 在对象池复用时断开对资源项的引用并清空进度信息。
      */
-    void resetInternal();
+    void clean() override;
 
 private:
     // 禁用拷贝构造和赋值操作
@@ -18,6 +18,7 @@ namespace RES {
 
 // 前向声明
 struct ResourceInfo;
+struct ResourceItemData;
 class ResourceConfig;
 
 /**
@@ -131,7 +132,7 @@ namespace ResourceItem {
      * @return ResourceItem 转换后的资源项
      * @version Egret 5.2
      */
-    struct ResourceItemData convertToResItem(const ResourceInfo& r);
+    ResourceItemData convertToResItem(const ResourceInfo& r);
 
 } // namespace ResourceItem
 
@@ -256,7 +257,7 @@ struct ResourceItemData : public ResourceInfo {
         : ResourceInfo(info), size(0) {}
 };
 
-// 为了兼容性，提供类型别名
-using ResourceItem = ResourceItemData;
+// 注意：TypeScript中ResourceItem既是接口也是命名空间，C++中同名会冲突，
+// 资源项类型统一使用ResourceItemData，常量和工具函数位于RES::ResourceItem命名空间
 
 } // namespace RES
\ No newline at end of file
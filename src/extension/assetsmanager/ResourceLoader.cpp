@@ -0,0 +1,156 @@
+/**
+ * @file ResourceLoader.cpp
+ * @brief ResourceLoader实现 - 优先级队列与任务系统上的并行加载
+ *
+ * 翻译自：egret-core-5.4.1/src/extension/assetsmanager/src/core/ResourceLoader.ts
+ */
+
+#include "extension/assetsmanager/ResourceLoader.hpp"
+#include "extension/assetsmanager/Path.hpp"
+#include "core/jobs/JobSystem.hpp"
+#include "utils/CallLater.hpp"
+#include "utils/Logger.hpp"
+#include <exception>
+
+namespace RES {
+
+    /**
+     * 一次加载的状态，在任务线程与主线程之间传递
+     * 任务线程只写decoded/error，主线程在任务完成之后才读取
+     */
+    struct ResourceLoader::LoadState {
+        ResourceInfo resource;
+        std::string path;
+        std::shared_ptr<processor::Processor> processor;
+        std::any decoded;
+        std::string error;
+    };
+
+    ResourceLoader::ResourceLoader(CompleteCallback onComplete)
+        : m_onComplete(std::move(onComplete))
+        , m_maxThread(4)
+        , m_sequence(0)
+        , m_alive(std::make_shared<bool>(true)) {
+    }
+
+    ResourceLoader::~ResourceLoader() = default;
+
+    void ResourceLoader::load(const ResourceInfo& resource, int priority) {
+        if (m_active.find(resource.name) != m_active.end()) {
+            return;
+        }
+        auto it = m_queued.find(resource.name);
+        if (it != m_queued.end()) {
+            // 已在队列中：更高优先级的请求把它提前
+            if (-priority < it->second.key.first) {
+                m_queue.erase(it->second.key);
+                it->second.key.first = -priority;
+                m_queue.emplace(it->second.key, resource.name);
+            }
+            return;
+        }
+        QueueKey key(-priority, m_sequence++);
+        m_queue.emplace(key, resource.name);
+        m_queued.emplace(resource.name, Queued{resource, key});
+        next();
+    }
+
+    bool ResourceLoader::cancel(const std::string& name) {
+        auto it = m_queued.find(name);
+        if (it == m_queued.end()) {
+            return false;
+        }
+        m_queue.erase(it->second.key);
+        m_queued.erase(it);
+        return true;
+    }
+
+    bool ResourceLoader::isLoading(const std::string& name) const {
+        return m_queued.find(name) != m_queued.end() || m_active.find(name) != m_active.end();
+    }
+
+    void ResourceLoader::setMaxThread(size_t value) {
+        m_maxThread = value > 0 ? value : 1;
+        next();
+    }
+
+    std::string ResourceLoader::getResourcePath(const ResourceInfo& resource) {
+        if (resource.root.empty() || path::isAbsolute(resource.url)) {
+            return resource.url;
+        }
+        if (resource.root.back() == '/') {
+            return resource.root + resource.url;
+        }
+        return resource.root + "/" + resource.url;
+    }
+
+    void ResourceLoader::next() {
+        while (m_active.size() < m_maxThread && !m_queue.empty()) {
+            auto first = m_queue.begin();
+            auto it = m_queued.find(first->second);
+            ResourceInfo resource = std::move(it->second.resource);
+            m_queued.erase(it);
+            m_queue.erase(first);
+            start(std::move(resource));
+        }
+    }
+
+    void ResourceLoader::start(ResourceInfo resource) {
+        auto state = std::make_shared<LoadState>();
+        state->path = getResourcePath(resource);
+        state->processor = processor::getProcessor(resource.type);
+        state->resource = std::move(resource);
+        m_active.emplace(state->resource.name, state);
+
+        std::weak_ptr<bool> alive = m_alive;
+        auto complete = [this, alive, state]() {
+            if (!alive.expired()) {
+                onLoaded(state);
+            }
+        };
+
+        if (!state->processor) {
+            state->error = "没有处理器可以加载类型为 " + state->resource.type + " 的资源";
+            egret::CallLaterSystem::callAsync(std::move(complete));
+            return;
+        }
+
+        egret::sys::JobSystem& jobs = egret::sys::getJobSystem();
+        egret::sys::JobHandle job = jobs.schedule([state]() {
+            try {
+                if (!state->processor->onLoadStart(state->resource, state->path, state->decoded, state->error)
+                    && state->error.empty()) {
+                    state->error = "加载失败";
+                }
+            }
+            catch (const std::exception& e) {
+                state->error = e.what();
+            }
+        });
+        jobs.runOnMainThread(job, std::move(complete));
+    }
+
+    void ResourceLoader::onLoaded(const std::shared_ptr<LoadState>& state) {
+        m_active.erase(state->resource.name);
+
+        std::any data;
+        if (state->error.empty()) {
+            try {
+                data = state->processor->onLoadFinish(state->resource, std::move(state->decoded));
+            }
+            catch (const std::exception& e) {
+                state->error = e.what();
+            }
+        }
+        state->decoded.reset();
+        if (!state->error.empty()) {
+            EGRET_WARNF("RES: 加载资源 {} ({}) 失败: {}", state->resource.name, state->path, state->error);
+        }
+
+        if (m_onComplete) {
+            m_onComplete(state->resource, std::move(data), state->error);
+        }
+        next();
+    }
+
+} // namespace RES
@@ -0,0 +1,137 @@
+/**
+ * @file ResourceLoader.hpp
+ * @brief ResourceLoader类 - 带优先级的并行资源加载队列
+ *
+ * 翻译自：egret-core-5.4.1/src/extension/assetsmanager/src/core/ResourceLoader.ts
+ * TypeScript版本按优先级维护待加载列表，同时最多发起thread个请求；
+ * C++版本保持相同的调度规则，实际的读取与解码交给引擎共享的任务系统（egret::sys::JobSystem）执行，
+ * 完成后回到主线程创建资源对象并通知调用方。
+ */
+
+#pragma once
+
+#include "extension/assetsmanager/Processor.hpp"
+#include "extension/assetsmanager/ResourceItem.hpp"
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace RES {
+
+/**
+ * @brief 常用的加载优先级，数值越大越先加载
+ *
+ * 屏幕上马上要用到的资源（getResAsync）使用IMMEDIATE，
+ * 预加载后续场景的资源组可以使用PREFETCH，避免占用加载通道。
+ */
+namespace LoadPriority {
+    constexpr int PREFETCH = -100;
+    constexpr int NORMAL = 0;
+    constexpr int IMMEDIATE = 100;
+}
+
+/**
+ * @brief ResourceLoader类 - 资源加载队列
+ *
+ * 待加载资源按优先级从高到低（同优先级先请求先加载）排队，同时进行的加载数不超过maxThread；
+ * 已在队列中的资源再次以更高优先级请求时会提前，正在加载的同一资源不会重复加载。
+ * 任务线程上调用处理器的onLoadStart读取解码，完成后在主线程（SystemTicker::update开始时）
+ * 调用onLoadFinish并回调。所有方法只能在主线程调用。
+ *
+ * @version Egret 5.2
+ * @note 对应TypeScript的RES.ResourceLoader类
+ */
+class ResourceLoader {
+public:
+    /**
+     * @brief 加载完成回调（主线程）
+     *
+     * @param resource 资源信息
+     * @param data 资源对象，失败时为空
+     * @param error 失败时的错误信息，成功时为空
+     */
+    using CompleteCallback = std::function<void(const ResourceInfo& resource, std::any data, const std::string& error)>;
+
+    explicit ResourceLoader(CompleteCallback onComplete);
+    ~ResourceLoader();
+
+    ResourceLoader(const ResourceLoader&) = delete;
+    ResourceLoader& operator=(const ResourceLoader&) = delete;
+
+    /**
+     * @brief 请求加载资源
+     *
+     * 资源已在队列中时取两次请求中较高的优先级；正在加载时忽略。
+     *
+     * @param resource 资源信息
+     * @param priority 优先级，数值越大越先加载
+     */
+    void load(const ResourceInfo& resource, int priority = LoadPriority::NORMAL);
+
+    /**
+     * @brief 取消排队中的资源，已开始加载的不受影响
+     *
+     * @return bool 资源在队列中并被移除时返回true
+     */
+    bool cancel(const std::string& name);
+
+    /**
+     * @brief 资源是否在排队或正在加载
+     */
+    bool isLoading(const std::string& name) const;
+
+    /**
+     * @brief 最大同时加载数，默认4
+     */
+    void setMaxThread(size_t value);
+    size_t getMaxThread() const { return m_maxThread; }
+
+    /**
+     * @brief 排队中的资源数
+     */
+    size_t getQueuedCount() const { return m_queue.size(); }
+
+    /**
+     * @brief 正在加载的资源数
+     */
+    size_t getActiveCount() const { return m_active.size(); }
+
+    /**
+     * @brief 计算资源文件的路径（资源根路径 + url，url为绝对路径时直接使用）
+     */
+    static std::string getResourcePath(const ResourceInfo& resource);
+
+private:
+    // 排序键：优先级从高到低，同优先级按请求顺序
+    using QueueKey = std::pair<int, uint64_t>;
+
+    struct Queued {
+        ResourceInfo resource;
+        QueueKey key;
+    };
+
+    struct LoadState;
+
+    /**
+     * 在并发上限内从队首开始发起加载
+     */
+    void next();
+    void start(ResourceInfo resource);
+    void onLoaded(const std::shared_ptr<LoadState>& state);
+
+    CompleteCallback m_onComplete;
+    size_t m_maxThread;
+    uint64_t m_sequence;
+    std::map<QueueKey, std::string> m_queue;                 // 排序键 -> 资源名
+    std::unordered_map<std::string, Queued> m_queued;        // 资源名 -> 排队信息
+    std::unordered_map<std::string, std::shared_ptr<LoadState>> m_active;  // 正在加载
+    std::shared_ptr<bool> m_alive;                           // 析构后丢弃仍在途中的完成回调
+};
+
+} // namespace RES
@@ -0,0 +1,51 @@
+#pragma once
+
+namespace egret {
+
+    /**
+     * ColorTransform类用于调整显示对象或位图的颜色值
+     * 每个通道的结果为：clamp(原值 * multiplier + offset, 0, 255)
+     * 对应Flash: flash.geom.ColorTransform
+     */
+    class ColorTransform {
+    public:
+        /**
+         * 构造函数
+         * @param redMultiplier 红色通道乘数
+         * @param greenMultiplier 绿色通道乘数
+         * @param blueMultiplier 蓝色通道乘数
+         * @param alphaMultiplier Alpha通道乘数
+         * @param redOffset 红色通道偏移（-255 ~ 255）
+         * @param greenOffset 绿色通道偏移（-255 ~ 255）
+         * @param blueOffset 蓝色通道偏移（-255 ~ 255）
+         * @param alphaOffset Alpha通道偏移（-255 ~ 255）
+         */
+        ColorTransform(double redMultiplier = 1.0, double greenMultiplier = 1.0,
+                       double blueMultiplier = 1.0, double alphaMultiplier = 1.0,
+                       double redOffset = 0.0, double greenOffset = 0.0,
+                       double blueOffset = 0.0, double alphaOffset = 0.0)
+            : redMultiplier(redMultiplier), greenMultiplier(greenMultiplier)
+            , blueMultiplier(blueMultiplier), alphaMultiplier(alphaMultiplier)
+            , redOffset(redOffset), greenOffset(greenOffset)
+            , blueOffset(blueOffset), alphaOffset(alphaOffset) {}
+
+        /**
+         * 是否为恒等变换
+         */
+        bool isIdentity() const {
+            return redMultiplier == 1.0 && greenMultiplier == 1.0 && blueMultiplier == 1.0 && alphaMultiplier == 1.0 &&
+                   redOffset == 0.0 && greenOffset == 0.0 && blueOffset == 0.0 && alphaOffset == 0.0;
+        }
+
+        // ========== 直接属性访问（兼容性） ==========
+        double redMultiplier;
+        double greenMultiplier;
+        double blueMultiplier;
+        double alphaMultiplier;
+        double redOffset;
+        double greenOffset;
+        double blueOffset;
+        double alphaOffset;
+    };
+
+} // namespace egret
@@ -1,5 +1,7 @@
 #include "geom/Matrix.hpp"
+#include "geom/Rectangle.hpp"
 #include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
 #include <cmath>
 #include <vector>
 
@@ -223,6 +225,28 @@ namespace egret {
         );
     }
 
+    void Matrix::transformBounds(Rectangle& bounds) const {
+        double left = bounds.getX();
+        double top = bounds.getY();
+        double right = left + bounds.getWidth();
+        double bottom = top + bounds.getHeight();
+        
+        double x0 = a * left + c * top + tx;
+        double y0 = b * left + d * top + ty;
+        double x1 = a * right + c * top + tx;
+        double y1 = b * right + d * top + ty;
+        double x2 = a * right + c * bottom + tx;
+        double y2 = b * right + d * bottom + ty;
+        double x3 = a * left + c * bottom + tx;
+        double y3 = b * left + d * bottom + ty;
+        
+        double minX = std::min(std::min(x0, x1), std::min(x2, x3));
+        double maxX = std::max(std::max(x0, x1), std::max(x2, x3));
+        double minY = std::min(std::min(y0, y1), std::min(y2, y3));
+        double maxY = std::max(std::max(y0, y1), std::max(y2, y3));
+        bounds.setTo(minX, minY, maxX - minX, maxY - minY);
+    }
+
     double Matrix::getScaleX() const {
         return std::sqrt(a * a + b * b);
     }
@@ -6,6 +6,8 @@
 
 namespace egret {
 
+    class Rectangle;
+
     /**
      * Matrix类表示一个2D变换矩阵
      * 对应TypeScript: export class Matrix
@@ -153,6 +155,11 @@ namespace egret {
          */
         Point deltaTransformPoint(const Point& point) const;
         
+        /**
+         * 变换矩形，结果为变换后四个顶点的轴对齐包围盒（就地修改）
+         */
+        void transformBounds(Rectangle& bounds) const;
+        
         // ========== 属性提取 ==========
         
         /**
@@ -14,6 +14,7 @@
 #include "utils/Logger.hpp"
 #include <fstream>
 #include <vector>
+#include <climits>
 
 // stb_image图像加载支持 (单头文件库)
 #include <SDL3/SDL.h>
@@ -25,6 +26,7 @@ namespace egret {
     // ========== 静态成员初始化 ==========
 
     std::string ImageLoader::s_globalCrossOrigin = "";
+    bool ImageLoader::s_globalAutoPixelFormat = false;
 
     // ========== 构造函数和析构函数 ==========
 
@@ -33,7 +35,8 @@ namespace egret {
         , m_data(nullptr)
         , m_crossOrigin("")
         , m_currentUrl("")
-        , m_isLoading(false) {
+        , m_isLoading(false)
+        , m_autoPixelFormat(s_globalAutoPixelFormat) {
         // stb_image是单头文件库，无需特殊初始化
     }
 
@@ -60,6 +63,14 @@ namespace egret {
         m_crossOrigin = crossOrigin;
     }
 
+    bool ImageLoader::getAutoPixelFormat() const {
+        return m_autoPixelFormat;
+    }
+
+    void ImageLoader::setAutoPixelFormat(bool value) {
+        m_autoPixelFormat = value;
+    }
+
     void ImageLoader::load(const std::string& url) {
         // 如果正在加载，先取消当前操作
         if (m_isLoading) {
@@ -107,6 +118,14 @@ namespace egret {
         s_globalCrossOrigin = crossOrigin;
     }
 
+    bool ImageLoader::getGlobalAutoPixelFormat() {
+        return s_globalAutoPixelFormat;
+    }
+
+    void ImageLoader::setGlobalAutoPixelFormat(bool value) {
+        s_globalAutoPixelFormat = value;
+    }
+
     // ========== 受保护方法 ==========
 
     void ImageLoader::onLoadComplete(void* imageData) {
@@ -149,36 +168,14 @@ namespace egret {
                 return;
             }
 
-            // 创建BitmapData对象
-            // 在TypeScript版本中，BitmapData构造函数接受source参数，并从source获取width和height
-            // 这里我们创建一个空的BitmapData，然后通过友元访问设置其尺寸和像素数据
-            m_data = std::make_shared<BitmapData>(nullptr);
-            
-            // 通过友元访问设置width和height（对应TypeScript版本中从source获取）
-            m_data->m_width = width;
-            m_data->m_height = height;
-            
-            // 分配像素数据内存
-            m_data->m_pixelData = std::make_unique<uint32_t[]>(width * height);
-            
-            // 转换stb_image数据为BitmapData所需的uint32_t格式，并直接写入内部数组
-            for (int i = 0; i < width * height; ++i) {
-                // stb_image返回的是RGBA字节序列，转换为uint32_t (ARGB格式)
-                unsigned char r = imageData[i * 4 + 0];
-                unsigned char g = imageData[i * 4 + 1];
-                unsigned char b = imageData[i * 4 + 2];
-                unsigned char a = imageData[i * 4 + 3];
-                
-                // 直接写入BitmapData内部数组
-                m_data->m_pixelData[i] = (static_cast<uint32_t>(a) << 24) |
-                                        (static_cast<uint32_t>(r) << 16) |
-                                        (static_cast<uint32_t>(g) << 8) |
-                                        static_cast<uint32_t>(b);
-            }
+            DecodedImage image;
+            convertPixels(imageData, width, height, image);
             
             // 释放stb_image分配的内存
             stbi_image_free(imageData);
             
+            m_data = createBitmapData(std::move(image), m_autoPixelFormat);
+            
             // 设置状态并完成加载
             m_isLoading = false;
 
@@ -192,4 +189,70 @@ namespace egret {
         }
     }
 
+    // ========== 内存解码 ==========
+
+    bool ImageLoader::decodeImagePixels(const unsigned char* bytes, size_t length, DecodedImage& image,
+                                        std::string* error) {
+        if (!bytes || length == 0 || length > static_cast<size_t>(INT_MAX)) {
+            if (error) {
+                *error = "Invalid image data";
+            }
+            return false;
+        }
+        int width, height, channels;
+        unsigned char* imageData = stbi_load_from_memory(bytes, static_cast<int>(length),
+                                                         &width, &height, &channels, STBI_rgb_alpha);
+        if (!imageData) {
+            if (error) {
+                *error = std::string("Failed to decode image with stb_image: ") + stbi_failure_reason();
+            }
+            return false;
+        }
+        convertPixels(imageData, width, height, image);
+        stbi_image_free(imageData);
+        return true;
+    }
+
+    void ImageLoader::convertPixels(const unsigned char* rgba, int width, int height, DecodedImage& image) {
+        image.width = width;
+        image.height = height;
+        const size_t pixelCount = static_cast<size_t>(width) * height;
+        image.pixels = std::make_unique<uint32_t[]>(pixelCount);
+        for (size_t i = 0; i < pixelCount; ++i) {
+            // stb_image返回的是RGBA字节序列，转换为uint32_t (ARGB格式)
+            unsigned char r = rgba[i * 4 + 0];
+            unsigned char g = rgba[i * 4 + 1];
+            unsigned char b = rgba[i * 4 + 2];
+            unsigned char a = rgba[i * 4 + 3];
+            image.pixels[i] = (static_cast<uint32_t>(a) << 24) |
+                              (static_cast<uint32_t>(r) << 16) |
+                              (static_cast<uint32_t>(g) << 8) |
+                              static_cast<uint32_t>(b);
+        }
+    }
+
+    std::shared_ptr<BitmapData> ImageLoader::createBitmapData(DecodedImage&& image, bool autoPixelFormat) {
+        if (!image.pixels || image.width <= 0 || image.height <= 0) {
+            return nullptr;
+        }
+        // 在TypeScript版本中，BitmapData构造函数接受source参数，并从source获取width和height
+        // 这里创建一个空的BitmapData，通过友元访问设置尺寸并接管像素数据
+        auto bitmapData = std::make_shared<BitmapData>(nullptr);
+        bitmapData->m_width = image.width;
+        bitmapData->m_height = image.height;
+        bitmapData->m_pixelData = std::move(image.pixels);
+        bitmapData->m_compactPixels.reset();
+        bitmapData->m_pixelFormat = BitmapPixelFormat::ARGB8888;
+        bitmapData->updateStorageStats();
+        
+        // 按内容选择紧凑格式（不透明 -> RGB565，纯白遮罩 -> A8）
+        if (autoPixelFormat) {
+            BitmapPixelFormat format = bitmapData->suggestPixelFormat();
+            if (format != BitmapPixelFormat::ARGB8888) {
+                bitmapData->setPixelFormat(format);
+            }
+        }
+        return bitmapData;
+    }
+
 } // namespace egret
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "events/EventDispatcher.hpp"
+#include <cstdint>
 #include <string>
 #include <memory>
 
@@ -91,6 +92,25 @@ public:
      */
     void setCrossOrigin(const std::string& crossOrigin);
 
+    /**
+     * @brief 获取是否自动选择紧凑像素格式
+     * 
+     * 开启后，加载完成时按像素内容自动选择格式：完全不透明的图像使用RGB565，
+     * 颜色全为白色的图像（遮罩、字形图集）使用A8，其余保持ARGB8888。
+     * 紧凑格式的位图在被编辑时会自动还原为ARGB8888。
+     * 
+     * @return bool 是否自动选择紧凑格式
+     * @default 与getGlobalAutoPixelFormat()相同
+     */
+    bool getAutoPixelFormat() const;
+
+    /**
+     * @brief 设置是否自动选择紧凑像素格式
+     * 
+     * @param value 是否自动选择紧凑格式
+     */
+    void setAutoPixelFormat(bool value);
+
     /**
      * @brief 启动图像加载
      * 
@@ -145,6 +165,56 @@ public:
      */
     static void setGlobalCrossOrigin(const std::string& crossOrigin);
 
+    /**
+     * @brief 获取新建ImageLoader默认是否自动选择紧凑像素格式
+     * 
+     * @return bool 全局默认值
+     * @default false
+     */
+    static bool getGlobalAutoPixelFormat();
+
+    /**
+     * @brief 设置新建ImageLoader默认是否自动选择紧凑像素格式
+     * 
+     * @param value 全局默认值
+     */
+    static void setGlobalAutoPixelFormat(bool value);
+
+    /**
+     * @brief 解码后的图像像素，尚未创建BitmapData
+     */
+    struct DecodedImage {
+        int width = 0;
+        int height = 0;
+        std::unique_ptr<uint32_t[]> pixels;  // ARGB8888，width * height个像素
+    };
+
+    /**
+     * @brief 从内存中的图像文件数据解码出像素
+     * 
+     * 只做解码与像素格式转换，不创建BitmapData、不访问ImageLoader实例与事件系统，
+     * 可在工作线程中调用（资源管理器在任务线程上解码图片，回到主线程再调用createBitmapData）。
+     * 
+     * @param bytes 图像文件数据（PNG、JPG等）
+     * @param length 数据长度
+     * @param image 输出解码结果
+     * @param error 解码失败时写入错误信息，可为nullptr
+     * @return bool 成功返回true
+     */
+    static bool decodeImagePixels(const unsigned char* bytes, size_t length, DecodedImage& image,
+                                  std::string* error = nullptr);
+
+    /**
+     * @brief 用解码结果创建BitmapData（只能在主线程调用）
+     * 
+     * 直接接管像素内存，不复制。
+     * 
+     * @param image 解码结果，调用后像素被移走
+     * @param autoPixelFormat 是否按像素内容自动选择紧凑格式
+     * @return std::shared_ptr<BitmapData> 位图，image为空时返回nullptr
+     */
+    static std::shared_ptr<BitmapData> createBitmapData(DecodedImage&& image, bool autoPixelFormat);
+
 protected:
     /**
      * @brief 处理加载完成
@@ -202,6 +272,13 @@ private:
      */
     bool m_isLoading;
 
+    /**
+     * @brief 是否自动选择紧凑像素格式
+     * 
+     * 加载完成时根据像素内容选择RGB565/A8等格式以节省内存。
+     */
+    bool m_autoPixelFormat;
+
     /**
      * @brief 全局跨域资源共享设置
      * 
@@ -209,6 +286,11 @@ private:
      */
     static std::string s_globalCrossOrigin;
 
+    /**
+     * @brief 全局默认的自动紧凑格式设置
+     */
+    static bool s_globalAutoPixelFormat;
+
     /**
      * @brief 同步加载图像（内部实现）
      * 
@@ -220,6 +302,11 @@ private:
      */
     void loadImageSync(const std::string& url);
 
+    /**
+     * @brief 把stb_image输出的RGBA数据转换为ARGB像素（内部实现，不释放rgba）
+     */
+    static void convertPixels(const unsigned char* rgba, int width, int height, DecodedImage& image);
+
     // 禁用拷贝构造和赋值操作
     ImageLoader(const ImageLoader&) = delete;
     ImageLoader& operator=(const ImageLoader&) = delete;
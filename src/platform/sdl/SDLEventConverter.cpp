@@ -4,6 +4,7 @@
 #include "events/KeyboardEvent.hpp"
 #include "events/Keyboard.hpp"
 #include "sys/Screen.hpp"
+#include "sys/TouchHandler.hpp"
 #include <iostream>
 #include <cmath>
 #include "utils/Logger.hpp"
@@ -50,49 +51,40 @@ namespace platform {
     }
     
     bool SDLEventConverter::handleMouseEvent(const SDL_Event& sdlEvent) {
-        float x = static_cast<float>(sdlEvent.button.x);
-        float y = static_cast<float>(sdlEvent.button.y);
-        convertCoordinates(x, y);
-        
-        std::shared_ptr<TouchEvent> touchEvent;
-        
         switch (sdlEvent.type) {
             case SDL_EVENT_MOUSE_BUTTON_DOWN:
-                if (sdlEvent.button.button == SDL_BUTTON_LEFT) {
-                    touchEvent = createTouchEvent(TouchEvent::TOUCH_BEGIN, x, y);
-                    EGRET_DEBUGF("Mouse->TOUCH_BEGIN ({}, {})", x, y);
+            case SDL_EVENT_MOUSE_BUTTON_UP: {
+                if (sdlEvent.button.button != SDL_BUTTON_LEFT) {
+                    return false;
                 }
-                break;
-                
-            case SDL_EVENT_MOUSE_BUTTON_UP:
-                if (sdlEvent.button.button == SDL_BUTTON_LEFT) {
-                    touchEvent = createTouchEvent(TouchEvent::TOUCH_END, x, y);
+                float x = static_cast<float>(sdlEvent.button.x);
+                float y = static_cast<float>(sdlEvent.button.y);
+                convertCoordinates(x, y);
+                // 先派发缓存的移动，保证TOUCH_MOVE不会跑到TOUCH_BEGIN/TOUCH_END之后
+                flushPendingMoves();
+                if (sdlEvent.type == SDL_EVENT_MOUSE_BUTTON_DOWN) {
+                    EGRET_DEBUGF("Mouse->TOUCH_BEGIN ({}, {})", x, y);
+                    m_stage->getTouchHandler()->onTouchBegin(x, y, 0);
+                } else {
                     EGRET_DEBUGF("Mouse->TOUCH_END ({}, {})", x, y);
+                    m_stage->getTouchHandler()->onTouchEnd(x, y, 0);
                 }
-                break;
+                return true;
+            }
                 
             case SDL_EVENT_MOUSE_MOTION:
                 // 只有在按下鼠标左键时才转换为触摸移动
                 if (sdlEvent.motion.state & SDL_BUTTON_LMASK) {
-                    x = static_cast<float>(sdlEvent.motion.x);
-                    y = static_cast<float>(sdlEvent.motion.y);
+                    float x = static_cast<float>(sdlEvent.motion.x);
+                    float y = static_cast<float>(sdlEvent.motion.y);
                     convertCoordinates(x, y);
-                    touchEvent = createTouchEvent(TouchEvent::TOUCH_MOVE, x, y);
                     // 不打印移动事件，避免日志过多
+                    queueMove(x, y, 0);
+                    return true;
                 }
                 break;
         }
         
-        if (touchEvent) {
-            // 命中测试，优先派发给命中的显示对象；若未命中则派发到Stage
-            if (auto target = m_stage->hitTest(x, y)) {
-                target->dispatchEvent(*touchEvent);
-            } else {
-                m_stage->dispatchEvent(*touchEvent);
-            }
-            return true;
-        }
-        
         return false;
     }
     
@@ -105,34 +97,95 @@ namespace platform {
         x *= static_cast<float>(m_stage->getStageWidth());
         y *= static_cast<float>(m_stage->getStageHeight());
         
-        std::shared_ptr<TouchEvent> touchEvent;
-        
         switch (sdlEvent.type) {
             case SDL_EVENT_FINGER_DOWN:
-                touchEvent = createTouchEvent(TouchEvent::TOUCH_BEGIN, x, y, touchId);
+                flushPendingMoves();
                 EGRET_DEBUGF("Finger DOWN ({}, {}), id={}", x, y, touchId);
-                break;
+                m_stage->getTouchHandler()->onTouchBegin(x, y, touchId);
+                return true;
                 
             case SDL_EVENT_FINGER_UP:
-                touchEvent = createTouchEvent(TouchEvent::TOUCH_END, x, y, touchId);
+                flushPendingMoves();
                 EGRET_DEBUGF("Finger UP ({}, {}), id={}", x, y, touchId);
-                break;
+                m_stage->getTouchHandler()->onTouchEnd(x, y, touchId);
+                return true;
                 
             case SDL_EVENT_FINGER_MOTION:
-                touchEvent = createTouchEvent(TouchEvent::TOUCH_MOVE, x, y, touchId);
-                break;
+                queueMove(x, y, touchId);
+                return true;
         }
         
-        if (touchEvent) {
-            if (auto target = m_stage->hitTest(x, y)) {
-                target->dispatchEvent(*touchEvent);
-            } else {
-                m_stage->dispatchEvent(*touchEvent);
+        return false;
+    }
+
+    void SDLEventConverter::queueMove(float x, float y, int touchId) {
+        if (!m_coalesceMoves) {
+            m_stage->getTouchHandler()->onTouchMove(x, y, touchId);
+            return;
+        }
+
+        // 触摸点很少，线性查找：优先同一触摸点的活动条目，其次复用空闲条目
+        PendingMove* slot = nullptr;
+        PendingMove* freeSlot = nullptr;
+        for (auto& pending : m_pendingMoves) {
+            if (pending.active) {
+                if (pending.touchId == touchId) {
+                    slot = &pending;
+                    break;
+                }
+            } else if (!freeSlot) {
+                freeSlot = &pending;
             }
-            return true;
         }
-        
-        return false;
+        if (!slot) {
+            if (!freeSlot) {
+                m_pendingMoves.emplace_back();
+                freeSlot = &m_pendingMoves.back();
+            }
+            slot = freeSlot;
+        }
+        if (!slot->active) {
+            slot->active = true;
+            slot->touchId = touchId;
+            slot->count = 0;
+            slot->history.clear();
+            ++m_pendingMoveCount;
+        }
+        slot->x = x;
+        slot->y = y;
+        ++slot->count;
+        if (m_keepMoveHistory) {
+            slot->history.push_back({x, y});
+        }
+    }
+
+    int SDLEventConverter::flushPendingMoves() {
+        if (m_pendingMoveCount == 0 || !m_stage) {
+            return 0;
+        }
+        int dispatched = 0;
+        // 按下标遍历并在派发前清除active标记，侦听器中再次产生的移动会留到下一次flush
+        for (size_t i = 0; i < m_pendingMoves.size(); ++i) {
+            PendingMove& pending = m_pendingMoves[i];
+            if (!pending.active) {
+                continue;
+            }
+            pending.active = false;
+            --m_pendingMoveCount;
+            const std::vector<TouchEvent::MoveSample>* samples =
+                pending.history.empty() ? nullptr : &pending.history;
+            m_stage->getTouchHandler()->onTouchMove(pending.x, pending.y, pending.touchId,
+                                                    pending.count, samples);
+            ++dispatched;
+        }
+        return dispatched;
+    }
+
+    void SDLEventConverter::setCoalescePointerMoves(bool value) {
+        if (m_coalesceMoves && !value) {
+            flushPendingMoves();
+        }
+        m_coalesceMoves = value;
     }
     
     bool SDLEventConverter::handleKeyboardEvent(const SDL_Event& sdlEvent) {
@@ -160,6 +213,7 @@ namespace platform {
 
         // 派发事件到舞台（事件流）
         bool result = m_stage->dispatchEvent(*keyboardEvent);
+        KeyboardEvent::release(keyboardEvent);
         
         return result;
     }
@@ -179,33 +233,25 @@ namespace platform {
             }
                 
             case SDL_EVENT_WINDOW_FOCUS_GAINED:
-                event = std::make_shared<Event>(Event::ACTIVATE);
+                event = Event::create(Event::ACTIVATE);
                 EGRET_INFO("窗口获得焦点，派发ACTIVATE事件");
                 break;
                 
             case SDL_EVENT_WINDOW_FOCUS_LOST:
-                event = std::make_shared<Event>(Event::DEACTIVATE);
+                event = Event::create(Event::DEACTIVATE);
                 EGRET_INFO("窗口失去焦点，派发DEACTIVATE事件");
                 break;
         }
         
         if (event) {
             m_stage->dispatchEvent(*event);
+            Event::release(event);
             return true;
         }
         
         return false;
     }
     
-    std::shared_ptr<TouchEvent> SDLEventConverter::createTouchEvent(
-        const std::string& type, float x, float y, int touchId) {
-        // bubbles / cancelable 设为 true 以便更接近 Egret 行为
-        auto touchEvent = std::make_shared<TouchEvent>(type, true, true, x, y, touchId);
-        bool down = (type == TouchEvent::TOUCH_BEGIN || type == TouchEvent::TOUCH_MOVE);
-        touchEvent->setTouchDown(down);
-        return touchEvent;
-    }
-    
     void SDLEventConverter::convertCoordinates(float& x, float& y) const {
         if (!m_stage) return;
         auto screen = m_stage->getScreen();
@@ -6,6 +6,7 @@
 #include "events/KeyboardEvent.hpp"
 #include "display/Stage.hpp"
 #include <memory>
+#include <vector>
 
 namespace egret {
 namespace platform {
@@ -13,6 +14,7 @@ namespace platform {
     /**
      * SDL事件到Egret事件转换器
      * 负责将SDL3的原生事件转换为Egret引擎的事件系统
+     * 触摸/鼠标输入交给舞台的sys::TouchHandler，由它决定目标对象
      */
     class SDLEventConverter {
     public:
@@ -43,6 +45,30 @@ namespace platform {
          * 获取舞台对象
          */
         std::shared_ptr<Stage> getStage() const { return m_stage; }
+
+        // ========== 移动事件合并 ==========
+
+        /**
+         * 设置是否按帧合并指针移动（默认开启）
+         * 开启后每个触摸点在一帧内只保留最新位置，由flushPendingMoves统一派发一次TOUCH_MOVE；
+         * 按下/抬起等事件到达前会先派发已缓存的移动，保证事件顺序不变
+         */
+        void setCoalescePointerMoves(bool value);
+        bool isCoalescingPointerMoves() const { return m_coalesceMoves; }
+
+        /**
+         * 设置合并时是否记录每次移动的位置，可通过TouchEvent::getCoalescedSamples读取
+         */
+        void setKeepMoveHistory(bool value) { m_keepMoveHistory = value; }
+        bool isKeepingMoveHistory() const { return m_keepMoveHistory; }
+
+        /**
+         * 派发本帧缓存的TOUCH_MOVE，应在事件轮询结束后、渲染之前调用
+         * @return 派发的事件数
+         */
+        int flushPendingMoves();
+
+        bool hasPendingMoves() const { return m_pendingMoveCount > 0; }
         
     private:
         /**
@@ -65,17 +91,31 @@ namespace platform {
          */
         bool handleWindowEvent(const SDL_Event& sdlEvent);
         
-        /**
-         * 创建TouchEvent
-         */
-        std::shared_ptr<TouchEvent> createTouchEvent(const std::string& type, float x, float y, int touchId = 0);
-        
         /**
          * 将SDL坐标转换为舞台坐标
          */
         void convertCoordinates(float& x, float& y) const;
+
+        /**
+         * 缓存一次移动，或在未开启合并时立即派发
+         */
+        void queueMove(float x, float y, int touchId);
+
+        // 一个触摸点在当前帧内尚未派发的移动；条目不删除只复用，历史数组保留容量
+        struct PendingMove {
+            int touchId = 0;
+            bool active = false;
+            float x = 0.0f;
+            float y = 0.0f;
+            size_t count = 0;
+            std::vector<TouchEvent::MoveSample> history;
+        };
         
         std::shared_ptr<Stage> m_stage;  // 目标舞台
+        std::vector<PendingMove> m_pendingMoves;
+        size_t m_pendingMoveCount = 0;   // 处于active状态的条目数
+        bool m_coalesceMoves = true;
+        bool m_keepMoveHistory = false;
     };
 
 } // namespace platform
@@ -1,10 +1,9 @@
 #include "platform/sdl/SDLPlatform.hpp"
 #include "player/PlayerFactory.hpp"
 #include "player/SkiaRenderBuffer.hpp"
+#include "player/IdleScheduler.hpp"
 #include <iostream>
 #include "utils/Logger.hpp"
-#include <chrono>
-#include <thread>
 
 namespace egret {
 namespace platform {
@@ -108,7 +107,8 @@ namespace platform {
         m_running = true;
         EGRET_INFO("开始主循环...");
         
-        auto lastTime = std::chrono::high_resolution_clock::now();
+        sys::FramePacer& pacer = m_player->getFramePacer();
+        pacer.reset();
         
         while (m_running && !m_window->shouldClose()) {
             // 处理事件
@@ -120,15 +120,14 @@ namespace platform {
             // 渲染
             render();
             
-            // 控制帧率 (60fps = ~16.67ms per frame)
-            auto currentTime = std::chrono::high_resolution_clock::now();
-            auto deltaTime = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - lastTime);
+            // 用本帧截止前的剩余时间执行空闲任务
+            sys::getIdleScheduler().run(pacer.getTimeUntilDeadline());
             
-            if (deltaTime.count() < 16) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(16 - deltaTime.count()));
+            // 按ticker帧率等待到下一帧截止时刻
+            if (m_ticker) {
+                pacer.setTargetFrameRate(m_ticker->getFrameRate());
             }
-            
-            lastTime = std::chrono::high_resolution_clock::now();
+            pacer.waitForNextFrame();
         }
         
         EGRET_INFO("主循环结束");
@@ -155,6 +154,11 @@ namespace platform {
                 m_eventConverter->handleSDLEvent(sdlEvent);
             }
         }
+
+        // 合并后的移动事件在引擎更新和渲染之前派发
+        if (m_eventConverter) {
+            m_eventConverter->flushPendingMoves();
+        }
     }
     
     void SDLPlatform::updateEngine() {
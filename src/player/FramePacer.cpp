@@ -0,0 +1,117 @@
+#include "player/FramePacer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace egret {
+namespace sys {
+
+    FramePacer::FramePacer()
+        : m_spinThreshold(std::chrono::milliseconds(2)) {
+        reset();
+    }
+
+    void FramePacer::setTargetFrameRate(double fps) {
+        if (fps == m_targetFrameRate) {
+            return;
+        }
+        m_targetFrameRate = fps;
+        if (fps > 0.0) {
+            m_interval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / fps));
+        } else {
+            m_interval = Clock::duration::zero();
+        }
+        m_deadline = m_frameStart + m_interval;
+    }
+
+    void FramePacer::reset() {
+        m_frameStart = Clock::now();
+        m_deadline = m_frameStart + m_interval;
+        m_frameTimeCount = 0;
+        m_frameTimeNext = 0;
+        m_lastFrameTimeMs = 0.0;
+    }
+
+    void FramePacer::waitForNextFrame() {
+        Clock::time_point now = Clock::now();
+        if (!m_vsync && m_interval > Clock::duration::zero()) {
+            if (now < m_deadline) {
+                waitUntil(m_deadline);
+                now = Clock::now();
+                m_deadline += m_interval;
+            } else if (now - m_deadline < m_interval) {
+                // 稍有延迟：保持原有节奏，下一帧少等一些
+                m_deadline += m_interval;
+            } else {
+                // 落后超过一帧：从当前时刻重新对齐
+                m_deadline = now + m_interval;
+            }
+        }
+        record(std::chrono::duration<double, std::milli>(now - m_frameStart).count());
+        m_frameStart = now;
+    }
+
+    FramePacer::Clock::duration FramePacer::getTimeUntilDeadline() const {
+        if (m_interval <= Clock::duration::zero()) {
+            return Clock::duration::zero();
+        }
+        Clock::time_point deadline = m_vsync ? m_frameStart + m_interval : m_deadline;
+        return std::max(deadline - Clock::now(), Clock::duration::zero());
+    }
+
+    FrameTimeStats FramePacer::getStats() const {
+        FrameTimeStats stats;
+        stats.samples = m_frameTimeCount;
+        if (m_frameTimeCount == 0) {
+            return stats;
+        }
+        double missedThreshold = m_interval > Clock::duration::zero()
+            ? std::chrono::duration<double, std::milli>(m_interval).count() * 1.5
+            : 0.0;
+        double sum = 0.0;
+        for (size_t i = 0; i < m_frameTimeCount; ++i) {
+            double ms = m_frameTimes[i];
+            sum += ms;
+            stats.maxMs = std::max(stats.maxMs, ms);
+            if (missedThreshold > 0.0 && ms > missedThreshold) {
+                ++stats.missedFrames;
+            }
+        }
+        stats.meanMs = sum / static_cast<double>(m_frameTimeCount);
+        double variance = 0.0;
+        for (size_t i = 0; i < m_frameTimeCount; ++i) {
+            double d = m_frameTimes[i] - stats.meanMs;
+            variance += d * d;
+        }
+        stats.stdDevMs = std::sqrt(variance / static_cast<double>(m_frameTimeCount));
+        stats.fps = stats.meanMs > 0.0 ? 1000.0 / stats.meanMs : 0.0;
+        return stats;
+    }
+
+    void FramePacer::waitUntil(Clock::time_point deadline) const {
+        for (;;) {
+            Clock::duration remaining = deadline - Clock::now();
+            if (remaining <= Clock::duration::zero()) {
+                return;
+            }
+            if (remaining > m_spinThreshold) {
+                // sleep可能过睡，只睡到截止前spinThreshold，醒来后重新计算剩余时间
+                std::this_thread::sleep_for(remaining - m_spinThreshold);
+            } else {
+                while (Clock::now() < deadline) {
+                    std::this_thread::yield();
+                }
+                return;
+            }
+        }
+    }
+
+    void FramePacer::record(double frameTimeMs) {
+        m_lastFrameTimeMs = frameTimeMs;
+        m_frameTimes[m_frameTimeNext] = frameTimeMs;
+        m_frameTimeNext = (m_frameTimeNext + 1) % kWindowSize;
+        m_frameTimeCount = std::min(m_frameTimeCount + 1, kWindowSize);
+    }
+
+} // namespace sys
+} // namespace egret
@@ -0,0 +1,99 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+namespace egret {
+namespace sys {
+
+    /**
+     * 帧时间统计（最近若干帧的滑动窗口）
+     */
+    struct FrameTimeStats {
+        double fps = 0.0;          // 按平均帧时间换算的帧率
+        double meanMs = 0.0;       // 平均帧时间
+        double stdDevMs = 0.0;     // 帧时间标准差，反映抖动
+        double maxMs = 0.0;        // 最长帧时间
+        size_t missedFrames = 0;   // 超过目标帧间隔1.5倍的帧数
+        size_t samples = 0;        // 参与统计的帧数
+    };
+
+    /**
+     * 主循环帧节奏控制
+     * 以高精度时钟维护每帧的截止时刻：先sleep到截止前spinThreshold，再自旋到截止时刻，
+     * 避免毫秒级sleep的截断与过睡；截止时刻按固定间隔递推，偶尔晚到会在下一帧补回，
+     * 落后超过一帧则从当前时刻重新对齐，不追帧
+     * 开启垂直同步时由present等待刷新，这里只统计不等待
+     */
+    class FramePacer {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        FramePacer();
+
+        /**
+         * 设置目标帧率，不大于0表示不限制
+         */
+        void setTargetFrameRate(double fps);
+        double getTargetFrameRate() const { return m_targetFrameRate; }
+
+        /**
+         * 是否由垂直同步控制节奏
+         */
+        void setVSyncEnabled(bool value) { m_vsync = value; }
+        bool isVSyncEnabled() const { return m_vsync; }
+
+        /**
+         * 截止前多久改为自旋等待，默认2ms；系统定时器粒度越粗，需要的值越大
+         */
+        void setSpinThreshold(Clock::duration value) { m_spinThreshold = value; }
+        Clock::duration getSpinThreshold() const { return m_spinThreshold; }
+
+        /**
+         * 每帧呈现之后调用一次：等待到本帧截止时刻，并记录帧时间
+         */
+        void waitForNextFrame();
+
+        /**
+         * 距本帧截止时刻的剩余时间，即本帧可用于空闲任务的余量；不限帧率时为0
+         * 垂直同步模式下按上一帧开始时刻加一个帧间隔估算
+         */
+        Clock::duration getTimeUntilDeadline() const;
+        
+        /**
+         * 重置截止时刻与统计（例如暂停恢复后）
+         */
+        void reset();
+
+        /**
+         * 上一帧的帧时间（毫秒）
+         */
+        double getLastFrameTimeMs() const { return m_lastFrameTimeMs; }
+
+        /**
+         * 最近kWindowSize帧的统计
+         */
+        FrameTimeStats getStats() const;
+
+        static constexpr size_t kWindowSize = 120;
+
+    private:
+        void waitUntil(Clock::time_point deadline) const;
+        void record(double frameTimeMs);
+
+        double m_targetFrameRate = 0.0;
+        Clock::duration m_interval{0};
+        Clock::duration m_spinThreshold;
+        bool m_vsync = false;
+
+        Clock::time_point m_frameStart;
+        Clock::time_point m_deadline;
+
+        std::array<double, kWindowSize> m_frameTimes{};
+        size_t m_frameTimeCount = 0;
+        size_t m_frameTimeNext = 0;
+        double m_lastFrameTimeMs = 0.0;
+    };
+
+} // namespace sys
+} // namespace egret
@@ -0,0 +1,115 @@
+#include "player/IdleScheduler.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+#include <exception>
+#include <initializer_list>
+
+namespace egret {
+namespace sys {
+
+    IdleScheduler::IdleScheduler()
+        : m_nextHandle(1)
+        , m_runningHandle(0)
+        , m_runningCancelled(false)
+        , m_safetyMargin(std::chrono::milliseconds(1))
+        , m_minSlice(std::chrono::microseconds(250))
+        , m_totalUsedMs(0.0) {
+    }
+
+    IdleTaskHandle IdleScheduler::post(IdleTask task, int priority) {
+        if (!task) {
+            return 0;
+        }
+        IdleTaskHandle handle = m_nextHandle++;
+        if (m_nextHandle == 0) {
+            m_nextHandle = 1;
+        }
+        insert({handle, priority, std::move(task)}, false);
+        return handle;
+    }
+
+    bool IdleScheduler::cancel(IdleTaskHandle handle) {
+        if (handle == 0) {
+            return false;
+        }
+        if (handle == m_runningHandle) {
+            m_runningCancelled = true;
+            return true;
+        }
+        auto matches = [handle](const Entry& entry) { return entry.handle == handle; };
+        for (auto* list : {&m_tasks, &m_yielded}) {
+            auto it = std::find_if(list->begin(), list->end(), matches);
+            if (it != list->end()) {
+                list->erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void IdleScheduler::run(Clock::duration available) {
+        Clock::time_point start = Clock::now();
+        Clock::duration budget = available - m_safetyMargin;
+        m_lastFrame = IdleFrameStats();
+        m_lastFrame.budgetMs = std::max(0.0, std::chrono::duration<double, std::milli>(budget).count());
+        if (m_tasks.empty() || budget < m_minSlice) {
+            return;
+        }
+
+        // 每个任务每帧最多执行一个片段：让出的任务暂存，本帧结束后放回同优先级的最前，下一帧继续
+        IdleDeadline deadline(start + budget);
+        m_yielded.clear();
+        while (!m_tasks.empty()) {
+            // 剩余时间不足一个最小片段时留到下一帧
+            if (Clock::now() + m_minSlice > start + budget) {
+                break;
+            }
+
+            Entry entry = std::move(m_tasks.front());
+            m_tasks.erase(m_tasks.begin());
+            m_runningHandle = entry.handle;
+            m_runningCancelled = false;
+
+            bool done = true;
+            try {
+                done = entry.task(deadline);
+            }
+            catch (const std::exception& e) {
+                EGRET_ERRORF("空闲任务执行出错: {}", e.what());
+            }
+            ++m_lastFrame.tasksRun;
+            m_runningHandle = 0;
+
+            if (done || m_runningCancelled) {
+                ++m_lastFrame.tasksDone;
+            } else {
+                m_yielded.push_back(std::move(entry));
+            }
+        }
+        for (auto it = m_yielded.rbegin(); it != m_yielded.rend(); ++it) {
+            insert(std::move(*it), true);
+        }
+        m_yielded.clear();
+
+        double usedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        m_lastFrame.usedMs = usedMs;
+        m_totalUsedMs += usedMs;
+    }
+
+    void IdleScheduler::insert(Entry entry, bool front) {
+        int priority = entry.priority;
+        auto it = front
+            ? std::find_if(m_tasks.begin(), m_tasks.end(),
+                           [priority](const Entry& other) { return other.priority <= priority; })
+            : std::find_if(m_tasks.begin(), m_tasks.end(),
+                           [priority](const Entry& other) { return other.priority < priority; });
+        m_tasks.insert(it, std::move(entry));
+    }
+
+    IdleScheduler& getIdleScheduler() {
+        static IdleScheduler instance;
+        return instance;
+    }
+
+} // namespace sys
+} // namespace egret
@@ -0,0 +1,149 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace egret {
+namespace sys {
+
+    /**
+     * 空闲任务的截止时刻，任务据此决定何时让出
+     */
+    class IdleDeadline {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        explicit IdleDeadline(Clock::time_point deadline) : m_deadline(deadline) {}
+
+        /**
+         * 本帧剩余可用时间（毫秒），已超时为0
+         */
+        double timeRemaining() const {
+            double ms = std::chrono::duration<double, std::milli>(m_deadline - Clock::now()).count();
+            return ms > 0.0 ? ms : 0.0;
+        }
+
+        /**
+         * 是否应当让出（剩余时间已用完）
+         */
+        bool shouldYield() const { return Clock::now() >= m_deadline; }
+
+    private:
+        Clock::time_point m_deadline;
+    };
+
+    /**
+     * 空闲任务：执行一段工作后返回true表示全部完成，返回false表示还有剩余，下次空闲时继续
+     * 任务应经常检查deadline.shouldYield()，把耗时工作切成小段
+     */
+    using IdleTask = std::function<bool(const IdleDeadline& deadline)>;
+
+    /**
+     * 空闲任务句柄，0为无效句柄
+     */
+    using IdleTaskHandle = uint32_t;
+
+    /**
+     * 每帧的空闲时间统计
+     */
+    struct IdleFrameStats {
+        double budgetMs = 0.0;   // 本帧可用的空闲时间（已扣除安全余量）
+        double usedMs = 0.0;     // 实际消耗的空闲时间
+        size_t tasksRun = 0;     // 本帧执行的任务片段数
+        size_t tasksDone = 0;    // 本帧完成的任务数
+    };
+
+    /**
+     * 空闲时间调度器
+     * 主循环在渲染完成后、等待下一帧之前调用run，只使用本帧截止前剩余的时间：
+     * 按优先级从高到低（同优先级先提交先执行）每个任务执行一个片段，时间用完即停，未完成的任务下一帧继续
+     * 适合预热缓存、构建图集、清理等可以延后但不应造成卡顿的工作；只在主线程使用
+     */
+    class IdleScheduler {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        IdleScheduler();
+
+        IdleScheduler(const IdleScheduler&) = delete;
+        IdleScheduler& operator=(const IdleScheduler&) = delete;
+
+        /**
+         * 提交空闲任务
+         * @param task 任务函数
+         * @param priority 优先级，越大越先执行
+         * @return 任务句柄
+         */
+        IdleTaskHandle post(IdleTask task, int priority = 0);
+
+        /**
+         * 取消任务，可在任务自身中调用
+         * @return 任务存在时返回true
+         */
+        bool cancel(IdleTaskHandle handle);
+
+        /**
+         * 在给定的空闲时间内执行任务
+         * @param available 距下一帧截止时刻的剩余时间
+         */
+        void run(Clock::duration available);
+
+        /**
+         * 为呈现与唤醒抖动预留的时间，默认1ms；剩余时间扣除后不足minSlice时本帧不执行
+         */
+        void setSafetyMargin(Clock::duration value) { m_safetyMargin = value; }
+        Clock::duration getSafetyMargin() const { return m_safetyMargin; }
+
+        /**
+         * 执行一个任务片段所需的最少时间，默认0.25ms
+         */
+        void setMinSlice(Clock::duration value) { m_minSlice = value; }
+        Clock::duration getMinSlice() const { return m_minSlice; }
+
+        /**
+         * 等待执行的任务数量
+         */
+        size_t getPendingCount() const { return m_tasks.size() + m_yielded.size(); }
+
+        /**
+         * 上一帧的空闲时间统计
+         */
+        const IdleFrameStats& getLastFrameStats() const { return m_lastFrame; }
+
+        /**
+         * 累计消耗的空闲时间（毫秒）
+         */
+        double getTotalUsedMs() const { return m_totalUsedMs; }
+
+    private:
+        struct Entry {
+            IdleTaskHandle handle;
+            int priority;
+            IdleTask task;
+        };
+
+        /**
+         * 按优先级插入；front为true时排在同优先级的最前（继续执行被让出的任务）
+         */
+        void insert(Entry entry, bool front);
+
+        std::vector<Entry> m_tasks;                // 按优先级从高到低排列
+        std::vector<Entry> m_yielded;              // 本帧已执行过片段、等待放回的任务
+        IdleTaskHandle m_nextHandle;
+        IdleTaskHandle m_runningHandle;            // 正在执行的任务
+        bool m_runningCancelled;                   // 正在执行的任务是否在执行中被取消
+        Clock::duration m_safetyMargin;
+        Clock::duration m_minSlice;
+        IdleFrameStats m_lastFrame;
+        double m_totalUsedMs;
+    };
+
+    /**
+     * 获取全局空闲调度器
+     */
+    IdleScheduler& getIdleScheduler();
+
+} // namespace sys
+} // namespace egret
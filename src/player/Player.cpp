@@ -1,5 +1,6 @@
 #include "player/Player.hpp"
 #include "player/SystemTicker.hpp"
+#include "player/IdleScheduler.hpp"
 #include "player/SkiaRenderBuffer.hpp"
 #include "player/SystemRenderer.hpp"
 #include "display/Stage.hpp"
@@ -9,7 +10,7 @@
 #include "sys/Screen.hpp"
 #include <iostream>
 #include <chrono>
-#include <thread>
+#include <cmath>
 #include <vector>
 
 namespace egret {
@@ -22,6 +23,7 @@ namespace sys {
         , m_showFPS(false)
         , m_showLog(false)
         , m_lastDrawCalls(0)
+        , m_lastBoundsRecomputes(0)
         , m_lastRenderTime(0)
         , m_ownWindow(true) {
         
@@ -147,6 +149,7 @@ namespace sys {
         , m_showFPS(false)
         , m_showLog(false)
         , m_lastDrawCalls(0)
+        , m_lastBoundsRecomputes(0)
         , m_lastRenderTime(0)
         , m_ownWindow(false) {  // 不拥有窗口
         
@@ -291,11 +294,14 @@ namespace sys {
         
         // 更新FPS显示
         if (triggerByFrame && m_showFPS && m_fpsDisplay) {
-            m_fpsDisplay->update(60, drawCalls, static_cast<int>(costRender), costTicker); // TODO: 计算实际FPS
+            FrameTimeStats stats = m_framePacer.getStats();
+            m_fpsDisplay->update(static_cast<int>(std::round(stats.fps)), drawCalls, static_cast<int>(costRender), costTicker);
+            m_fpsDisplay->updateFrameTiming(stats);
         }
         
         m_lastDrawCalls = drawCalls;
         m_lastRenderTime = costRender;
+        m_lastBoundsRecomputes = static_cast<int>(m_stage->takeBoundsRecomputeCount());
     }
     
     void Player::updateStageSize(int stageWidth, int stageHeight) {
@@ -322,11 +328,29 @@ namespace sys {
         EGRET_INFOF("Stage size updated to: {}x{}", stageWidth, stageHeight);
     }
     
+    bool Player::setVSyncEnabled(bool enabled) {
+        bool applied = false;
+        if (m_sdlWindow && m_sdlWindow->getRenderer()) {
+            applied = SDL_SetRenderVSync(m_sdlWindow->getRenderer(), enabled ? 1 : SDL_RENDERER_VSYNC_DISABLED);
+            if (!applied) {
+                EGRET_WARNF("设置垂直同步失败: {}", SDL_GetError());
+            }
+        }
+        m_framePacer.setVSyncEnabled(enabled && applied);
+        return m_framePacer.isVSyncEnabled();
+    }
+    
     void Player::handleSDLEvent(const SDL_Event& sdlEvent) {
         if (m_eventConverter) {
             m_eventConverter->handleSDLEvent(sdlEvent);
         }
     }
+
+    void Player::flushInputEvents() {
+        if (m_eventConverter) {
+            m_eventConverter->flushPendingMoves();
+        }
+    }
     
     int Player::runMainLoop() {
         if (!m_sdlWindow || !m_ownWindow) {
@@ -340,7 +364,7 @@ namespace sys {
         EGRET_INFO("Starting Player main loop...");
         
         auto& ticker = getTicker();
-        auto lastTime = std::chrono::high_resolution_clock::now();
+        m_framePacer.reset();
         
         while (!m_sdlWindow->shouldClose()) {
             // 处理SDL事件
@@ -356,6 +380,9 @@ namespace sys {
                 // 处理其他事件
                 handleSDLEvent(sdlEvent);
             }
+
+            // 合并后的移动事件在帧逻辑和渲染之前派发
+            flushInputEvents();
             
             // 更新SystemTicker
             ticker.update();
@@ -432,17 +459,14 @@ namespace sys {
                 }
             }
 
-            m_sdlWindow->present();
+            // 用本帧截止前的剩余时间执行空闲任务；放在present之前，开启垂直同步时present会等到刷新
+            getIdleScheduler().run(m_framePacer.getTimeUntilDeadline());
             
-            // 控制帧率 (60fps = ~16.67ms per frame)
-            auto currentTime = std::chrono::high_resolution_clock::now();
-            auto deltaTime = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - lastTime);
-            
-            if (deltaTime.count() < 16) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(16 - deltaTime.count()));
-            }
+            m_sdlWindow->present();
             
-            lastTime = std::chrono::high_resolution_clock::now();
+            // 按ticker帧率等待到下一帧截止时刻（开启垂直同步时由present等待）
+            m_framePacer.setTargetFrameRate(ticker.getFrameRate());
+            m_framePacer.waitForNextFrame();
         }
         
         // 停止播放器
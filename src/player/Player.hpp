@@ -5,6 +5,7 @@
 #include "display/DisplayObject.hpp"
 #include "player/RenderBuffer.hpp"
 #include "player/PlayerOption.hpp"
+#include "player/FramePacer.hpp"
 #include "platform/sdl/SDLWindow.hpp"
 #include "platform/sdl/SDLEventConverter.hpp"
 #include "sys/Screen.hpp"
@@ -32,6 +33,11 @@ namespace sys {
          */
         virtual void update(int fps, int drawCalls, int costRender, int costTicker) = 0;
         
+        /**
+         * 更新帧时间统计（平均值、标准差、最长帧等），默认忽略
+         */
+        virtual void updateFrameTiming(const FrameTimeStats&) {}
+        
         /**
          * 更新信息日志
          */
@@ -124,6 +130,24 @@ namespace sys {
          */
         std::shared_ptr<DisplayObject> getRoot() const { return m_root; }
         
+        /**
+         * 获取上一帧中重新计算子树边界的次数（用于观察边界缓存命中情况）
+         */
+        int getLastBoundsRecomputes() const { return m_lastBoundsRecomputes; }
+        
+        /**
+         * 设置是否开启垂直同步（仅拥有SDL窗口时有效）
+         * 开启后由呈现等待显示器刷新，主循环不再额外等待；设置失败时保持由帧率控制节奏
+         * @return 垂直同步是否已生效
+         */
+        bool setVSyncEnabled(bool enabled);
+        bool isVSyncEnabled() const { return m_framePacer.isVSyncEnabled(); }
+        
+        /**
+         * 主循环帧节奏控制器，可读取帧时间统计或调整自旋阈值
+         */
+        FramePacer& getFramePacer() { return m_framePacer; }
+        
         /**
          * 是否正在播放
          */
@@ -146,6 +170,12 @@ namespace sys {
          * @param sdlEvent SDL原生事件
          */
         void handleSDLEvent(const SDL_Event& sdlEvent);
+
+        /**
+         * 派发本帧合并的触摸移动事件
+         * 自行驱动事件循环时，应在轮询完SDL事件之后、SystemTicker更新之前调用
+         */
+        void flushInputEvents();
         
         /**
          * 运行主循环（当Player拥有SDL窗口时）
@@ -187,7 +217,9 @@ namespace sys {
         
         // 性能统计
         int m_lastDrawCalls;                                  // 上次绘制调用次数
+        int m_lastBoundsRecomputes;                           // 上一帧子树边界重算次数
         long long m_lastRenderTime;                           // 上次渲染时间
+        FramePacer m_framePacer;                              // 主循环帧节奏与帧时间统计
         
         // SDL集成相关
         std::shared_ptr<platform::SDLWindow> m_sdlWindow;     // SDL窗口管理器
@@ -1,5 +1,6 @@
 #include "player/PlayerFactory.hpp"
 #include "display/Stage.hpp"
+#include "core/jobs/JobSystem.hpp"
 #include <iostream>
 #include "utils/Logger.hpp"
 
@@ -62,6 +63,13 @@ namespace sys {
             player->displayFPS(option.showFPS, option.showLog, option.logFilter);
         }
         
+        if (option.vsync) {
+            player->setVSyncEnabled(true);
+        }
+        
+        // 引擎共享的任务系统：只有第一个播放器的线程数生效，之后的调用不会重启线程池
+        sys::getJobSystem().initialize(option.jobThreads);
+        
         // 更新舞台配置（语义对齐Egret）
         if (auto stage = player->getStage()) {
             // 设置缩放与方向（会触发Screen.updateScreenSize）
@@ -64,6 +64,17 @@ namespace egret {
          */
         double textureScaleFactor = 1.0;
         
+        /**
+         * 开启垂直同步（仅拥有SDL窗口的播放器有效）
+         */
+        bool vsync = false;
+        
+        /**
+         * 任务系统工作线程数：小于0按CPU核心数自动选择，0表示不使用工作线程
+         * 任务系统由所有播放器共享，以第一个创建的播放器为准
+         */
+        int jobThreads = -1;
+        
         /**
          * 默认构造函数
          */
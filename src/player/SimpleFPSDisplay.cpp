@@ -43,7 +43,7 @@ namespace sys {
         // 每秒更新一次显示
         if (m_totalTime >= 1000) {
             // 计算平均值
-            int avgFPS = std::min(static_cast<int>(m_totalTick * 1000 / m_totalTime), 60); // 假设最大帧率60
+            int avgFPS = static_cast<int>(m_totalTick * 1000 / m_totalTime);
             int avgDrawCalls = m_totalTick > 0 ? m_drawCalls / m_totalTick : 0;
             int avgCostRender = m_totalTick > 0 ? m_costRender / m_totalTick : 0;
             int avgCostTicker = m_totalTick > 0 ? m_costTicker / m_totalTick : 0;
@@ -140,6 +140,11 @@ namespace sys {
         // 在控制台输出FPS信息
         EGRET_INFOF("[FPS] fps={} drawCalls={} render={}ms ticker={}ms",
                      m_currentFPS, m_currentDrawCalls, m_currentCostRender, m_currentCostTicker);
+        if (m_frameTiming.samples > 0) {
+            EGRET_INFOF("[FPS] frame={}ms stddev={}ms max={}ms missed={}/{}",
+                        m_frameTiming.meanMs, m_frameTiming.stdDevMs, m_frameTiming.maxMs,
+                        m_frameTiming.missedFrames, m_frameTiming.samples);
+        }
     }
 
 } // namespace sys
@@ -35,6 +35,11 @@ namespace sys {
          */
         void update(int fps, int drawCalls, int costRender, int costTicker) override;
         
+        /**
+         * 更新帧时间统计
+         */
+        void updateFrameTiming(const FrameTimeStats& stats) override { m_frameTiming = stats; }
+        
         /**
          * 更新信息日志
          */
@@ -82,6 +87,7 @@ namespace sys {
         int m_currentDrawCalls;
         int m_currentCostRender;
         int m_currentCostTicker;
+        FrameTimeStats m_frameTiming;             // 最近的帧时间统计
     };
 
 } // namespace sys
@@ -101,6 +101,19 @@ namespace sys {
         return nullptr;
     }
     
+    bool SkiaRenderBuffer::readPixels(int x, int y, int width, int height, uint32_t* dst, size_t dstRowBytes) const {
+        if (!isValid() || !dst || width <= 0 || height <= 0) {
+            return false;
+        }
+        if (x < 0 || y < 0 || x + width > m_skSurface->width() || y + height > m_skSurface->height()) {
+            return false;
+        }
+        
+        // 由Skia一次完成区域拷贝与反预乘
+        SkImageInfo info = SkImageInfo::Make(width, height, kBGRA_8888_SkColorType, kUnpremul_SkAlphaType);
+        return m_skSurface->readPixels(info, dst, dstRowBytes, x, y);
+    }
+    
     void SkiaRenderBuffer::destroy() {
         releaseSkiaResources();
         m_width = 0.0;
@@ -157,6 +170,15 @@ namespace sys {
         return buffer;
     }
     
+    std::shared_ptr<SkiaRenderBuffer> SkiaRenderBuffer::createFromPixels(void* pixels, int width, int height, size_t rowBytes) {
+        if (!pixels || width <= 0 || height <= 0) {
+            return nullptr;
+        }
+        
+        SkImageInfo info = SkImageInfo::Make(width, height, kBGRA_8888_SkColorType, kPremul_SkAlphaType);
+        return createFromSurface(SkSurfaces::WrapPixels(info, pixels, rowBytes));
+    }
+    
     // ========== 私有方法实现 ==========
     
     void SkiaRenderBuffer::createSkiaSurface(int width, int height) {
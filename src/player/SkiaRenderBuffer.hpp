@@ -66,6 +66,18 @@ namespace sys {
          */
         SkSurface* getSkSurface() const { return m_skSurface.get(); }
         
+        /**
+         * 批量读取像素到调用方提供的内存
+         * 输出为非预乘32位ARGB（与BitmapData相同格式），区域超出缓冲区时返回false
+         * @param x 区域X坐标
+         * @param y 区域Y坐标
+         * @param width 区域宽度
+         * @param height 区域高度
+         * @param dst 输出内存，至少 height * dstRowBytes 字节
+         * @param dstRowBytes 输出每行字节数
+         */
+        bool readPixels(int x, int y, int width, int height, uint32_t* dst, size_t dstRowBytes) const;
+        
         /**
          * 保存画布内容到PNG文件（调试用）
          */
@@ -76,6 +88,16 @@ namespace sys {
          */
         static std::shared_ptr<SkiaRenderBuffer> createFromSurface(sk_sp<SkSurface> surface);
         
+        /**
+         * 包装外部像素内存创建RenderBuffer（不复制，绘制结果直接写入该内存）
+         * 像素格式为32位预乘ARGB（小端内存顺序 B、G、R、A），调用方需保证内存在缓冲区生命周期内有效
+         * @param pixels 像素内存首地址
+         * @param width 宽度
+         * @param height 高度
+         * @param rowBytes 每行字节数
+         */
+        static std::shared_ptr<SkiaRenderBuffer> createFromPixels(void* pixels, int width, int height, size_t rowBytes);
+        
         /**
          * 检查是否已初始化
          */
@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 
 namespace egret {
 namespace sys {
@@ -196,8 +197,8 @@ namespace sys {
         RenderNode* node = nullptr;
 
         // 在渲染当前对象之前，如果是Bitmap，准备其渲染节点数据
-        if (auto bmpSelf = dynamic_cast<Bitmap*>(displayObject)) {
-            bmpSelf->prepareRenderNode();
+        if (displayObject->getDisplayObjectType() == DisplayObjectType::BITMAP) {
+            static_cast<Bitmap*>(displayObject)->prepareRenderNode();
         }
         
         // 获取显示列表或渲染节点
@@ -245,14 +246,15 @@ namespace sys {
                 if (n) {
                     calls += renderNode(n, canvas, false);
                 }
-                if (auto ctn = dynamic_cast<DisplayObjectContainer*>(obj)) {
+                if (obj->isContainer()) {
+                    auto ctn = static_cast<DisplayObjectContainer*>(obj);
                     int nchild = ctn->getNumChildren();
                     for (int i = 0; i < nchild; ++i) {
                         auto ch = ctn->getChildAt(i);
                         if (!ch || !ch->getVisible()) continue;
                         canvas->save();
-                        if (ch->shouldUseTransform()) {
-                            Matrix m2 = ch->getMatrix();
+                        if (ch->shouldUseRenderTransform()) {
+                            Matrix m2 = ch->getRenderMatrix();
                             SkMatrix sm;
                             sm.setAll(
                                 SkDoubleToScalar(m2.getA()), SkDoubleToScalar(m2.getC()), SkDoubleToScalar(m2.getTx()),
@@ -334,8 +336,8 @@ namespace sys {
         }
         
         // 关键：递归渲染所有子对象
-        auto container = dynamic_cast<DisplayObjectContainer*>(displayObject);
-        if (container) {
+        if (displayObject->isContainer()) {
+            auto container = static_cast<DisplayObjectContainer*>(displayObject);
             int numChildren = container->getNumChildren();
             EGRET_DEBUGF("Children: {}", numChildren);
             
@@ -358,10 +360,10 @@ namespace sys {
                 canvas->save();
                 
                 double childOffsetX, childOffsetY;
-                if (child->shouldUseTransform()) {
+                if (child->shouldUseRenderTransform()) {
                     EGRET_DEBUGF("Child {} uses transform matrix", i);
                     // 使用完整变换矩阵
-                    Matrix matrix = child->getMatrix();
+                    Matrix matrix = child->getRenderMatrix();
                     SkMatrix childMatrix;
                     childMatrix.setAll(
                         SkDoubleToScalar(matrix.getA()), SkDoubleToScalar(matrix.getC()), SkDoubleToScalar(matrix.getTx()),
@@ -474,6 +476,11 @@ namespace sys {
             return 0;
         }
 
+        // A8位图的颜色视为白色，由画笔提供
+        if (image->isAlphaOnly()) {
+            paint.setColor(SkColorSetA(SK_ColorWHITE, paint.getAlpha()));
+        }
+
         // 平滑采样设置（BitmapNode 公有字段 smoothing）
         SkSamplingOptions sampling(node->smoothing ? SkFilterMode::kLinear : SkFilterMode::kNearest);
 
@@ -524,6 +531,11 @@ namespace sys {
             return 0;
         }
 
+        // A8位图的颜色视为白色，由画笔提供
+        if (image->isAlphaOnly()) {
+            paint.setColor(SkColorSetA(SK_ColorWHITE, paint.getAlpha()));
+        }
+
         // 平滑采样设置（NormalBitmapNode 提供 isSmooth()）
         SkSamplingOptions sampling(node->isSmooth() ? SkFilterMode::kLinear : SkFilterMode::kNearest);
 
@@ -534,47 +546,143 @@ namespace sys {
     }
 
     // ========== 辅助：获取或构建SkImage缓存 ==========
+    
+    // 分配计入纹理内存统计的预乘像素副本；SkImage可能在缓存条目替换后仍持有该副本，
+    // 因此在SkData的释放回调中注销统计
+    static sk_sp<SkData> makeTrackedPixelData(size_t size) {
+        void* pixels = ::operator new(size);
+        BitmapData::addRendererCopyStats(size);
+        return SkData::MakeWithProc(pixels, size,
+            [](const void* ptr, void* context) {
+                BitmapData::removeRendererCopyStats(reinterpret_cast<uintptr_t>(context));
+                ::operator delete(const_cast<void*>(ptr));
+            },
+            reinterpret_cast<void*>(static_cast<uintptr_t>(size)));
+    }
+    
     sk_sp<SkImage> SkiaRenderer::getOrCreateSkImage(BitmapData* bmp) {
         if (!bmp) return nullptr;
-        const void* key = static_cast<const void*>(bmp);
-        auto it = m_imageCache.find(key);
-        if (it != m_imageCache.end() && it->second) {
-            return it->second;
+
+        // RenderTexture：直接使用表面快照。Skia会缓存快照，表面再次被绘制时才写时复制
+        if (RenderBuffer* source = bmp->getRenderBufferSource()) {
+            SkSurface* surface = static_cast<SkSurface*>(source->getContext());
+            return surface ? surface->makeImageSnapshot() : nullptr;
         }
 
         int texW = bmp->getWidth();
         int texH = bmp->getHeight();
-        if (texW <= 0 || texH <= 0) {
+        if (texW <= 0 || texH <= 0 || (!bmp->m_pixelData && !bmp->m_compactPixels)) {
             return nullptr;
         }
 
-        auto argb = bmp->getPixels(0, 0, texW, texH);
-        if (static_cast<int>(argb.size()) != texW * texH) {
-            return nullptr;
+        const void* key = static_cast<const void*>(bmp);
+        CachedBitmapImage& entry = m_imageCache[key];
+        if (entry.image && entry.version == bmp->getVersion()) {
+            return entry.image;
         }
 
-        std::vector<uint8_t> rgba(static_cast<size_t>(texW) * static_cast<size_t>(texH) * 4);
-        for (int i = 0; i < texW * texH; ++i) {
-            uint32_t p = argb[static_cast<size_t>(i)];
-            uint8_t a = (p >> 24) & 0xFF;
-            uint8_t r = (p >> 16) & 0xFF;
-            uint8_t g = (p >> 8) & 0xFF;
-            uint8_t b = p & 0xFF;
-            // 预乘Alpha
-            rgba[static_cast<size_t>(i) * 4 + 0] = static_cast<uint8_t>((r * a + 127) / 255);
-            rgba[static_cast<size_t>(i) * 4 + 1] = static_cast<uint8_t>((g * a + 127) / 255);
-            rgba[static_cast<size_t>(i) * 4 + 2] = static_cast<uint8_t>((b * a + 127) / 255);
-            rgba[static_cast<size_t>(i) * 4 + 3] = a;
+        if (bmp->getPixelFormat() != BitmapPixelFormat::ARGB8888) {
+            return createCompactImage(bmp, entry);
         }
 
-        SkImageInfo info = SkImageInfo::Make(texW, texH, kRGBA_8888_SkColorType, kPremul_SkAlphaType);
+        bool canPatch = entry.pixels && entry.width == texW && entry.height == texH;
         size_t rowBytes = static_cast<size_t>(texW) * 4;
-        sk_sp<SkData> data = SkData::MakeWithCopy(rgba.data(), rowBytes * static_cast<size_t>(texH));
-        sk_sp<SkImage> image = SkImages::RasterFromData(info, data, rowBytes);
-        if (image) {
-            m_imageCache[key] = image;
+
+        // 先释放旧SkImage；若像素仍被外部持有的SkImage引用，则写时复制
+        entry.image.reset();
+        if (!canPatch) {
+            entry.pixels = makeTrackedPixelData(rowBytes * static_cast<size_t>(texH));
+            entry.width = texW;
+            entry.height = texH;
+        } else if (!entry.pixels->unique()) {
+            sk_sp<SkData> copy = makeTrackedPixelData(entry.pixels->size());
+            std::memcpy(copy->writable_data(), entry.pixels->data(), entry.pixels->size());
+            entry.pixels = std::move(copy);
+        }
+
+        // 副本恰好停在脏区域起点时只同步脏区域，否则整图转换
+        const PixelRegion& dirty = bmp->getDirtyRegion();
+        if (canPatch && entry.version == bmp->getDirtyBaseVersion() && !dirty.isEmpty()) {
+            convertBitmapRegion(bmp, entry, dirty.left, dirty.top, dirty.right, dirty.bottom);
+        } else {
+            convertBitmapRegion(bmp, entry, 0, 0, texW, texH);
+        }
+        entry.version = bmp->getVersion();
+        bmp->clearDirtyRegion();
+
+        // 每次同步生成新的SkImage（新的generation ID），像素本身不拷贝
+        SkImageInfo info = SkImageInfo::Make(texW, texH, kRGBA_8888_SkColorType, kPremul_SkAlphaType);
+        entry.image = SkImages::RasterFromData(info, entry.pixels, rowBytes);
+        if (!entry.image) {
+            m_imageCache.erase(key);
+            return nullptr;
+        }
+        return entry.image;
+    }
+
+    sk_sp<SkImage> SkiaRenderer::createCompactImage(BitmapData* bmp, CachedBitmapImage& entry) {
+        SkColorType colorType;
+        SkAlphaType alphaType = kPremul_SkAlphaType;
+        switch (bmp->getPixelFormat()) {
+            case BitmapPixelFormat::RGB565:
+                colorType = kRGB_565_SkColorType;
+                alphaType = kOpaque_SkAlphaType;
+                break;
+            case BitmapPixelFormat::ARGB4444:
+                colorType = kARGB_4444_SkColorType;
+                break;
+            case BitmapPixelFormat::A8:
+                colorType = kAlpha_8_SkColorType;
+                break;
+            default:
+                return nullptr;
+        }
+
+        // 紧凑像素的内存布局与Skia一致，SkData直接引用BitmapData的缓冲区，
+        // 由release回调持有一份shared_ptr，位图被编辑或销毁后旧SkImage仍然有效
+        using CompactPixels = std::shared_ptr<std::vector<uint8_t>>;
+        auto* holder = new CompactPixels(bmp->m_compactPixels);
+        sk_sp<SkData> data = SkData::MakeWithProc((*holder)->data(), (*holder)->size(),
+            [](const void*, void* context) { delete static_cast<CompactPixels*>(context); }, holder);
+
+        const int width = bmp->getWidth();
+        const int height = bmp->getHeight();
+        SkImageInfo info = SkImageInfo::Make(width, height, colorType, alphaType);
+        entry.pixels.reset();
+        entry.width = width;
+        entry.height = height;
+        entry.version = bmp->getVersion();
+        entry.image = SkImages::RasterFromData(info, std::move(data),
+                                               static_cast<size_t>(width) * BitmapData::getBytesPerPixel(bmp->getPixelFormat()));
+        bmp->clearDirtyRegion();
+        if (!entry.image) {
+            m_imageCache.erase(static_cast<const void*>(bmp));
+            return nullptr;
+        }
+        return entry.image;
+    }
+
+    void SkiaRenderer::convertBitmapRegion(const BitmapData* bmp, CachedBitmapImage& entry,
+                                           int left, int top, int right, int bottom) {
+        const uint32_t* src = bmp->m_pixelData.get();
+        const int width = entry.width;
+        for (int y = top; y < bottom; ++y) {
+            const uint32_t* srcRow = src + static_cast<size_t>(y) * width;
+            uint8_t* dstRow = static_cast<uint8_t*>(entry.pixels->writable_data()) + static_cast<size_t>(y) * width * 4;
+            for (int x = left; x < right; ++x) {
+                uint32_t p = srcRow[x];
+                uint32_t a = (p >> 24) & 0xFF;
+                uint32_t r = (p >> 16) & 0xFF;
+                uint32_t g = (p >> 8) & 0xFF;
+                uint32_t b = p & 0xFF;
+                // 预乘Alpha
+                uint8_t* d = dstRow + static_cast<size_t>(x) * 4;
+                d[0] = static_cast<uint8_t>((r * a + 127) / 255);
+                d[1] = static_cast<uint8_t>((g * a + 127) / 255);
+                d[2] = static_cast<uint8_t>((b * a + 127) / 255);
+                d[3] = static_cast<uint8_t>(a);
+            }
         }
-        return image;
     }
     
     void SkiaRenderer::renderText(TextNode* node, SkCanvas* canvas) {
@@ -11,6 +11,7 @@ class SkPaint;
 class SkPath;
 #include <include/core/SkRefCnt.h>
 #include <include/core/SkImage.h>
+#include <include/core/SkData.h>
 
 namespace egret {
 namespace sys {
@@ -189,11 +190,30 @@ namespace sys {
         std::unique_ptr<SkPaint> m_defaultPaint;       // 默认画笔
         std::unique_ptr<SkPath> m_tempPath;            // 临时路径对象
 
-        // BitmapData -> SkImage 简易缓存（当前未做脏标记失效，后续可接入BitmapData::invalidate）
-        std::unordered_map<const void*, sk_sp<SkImage>> m_imageCache;
+        /**
+         * BitmapData在Skia侧的像素副本（预乘RGBA）
+         * SkImage直接共享pixels，BitmapData有脏区域时只重新转换受影响的行
+         */
+        struct CachedBitmapImage {
+            sk_sp<SkData> pixels;                      // 预乘RGBA像素，与image共享
+            int width = 0;
+            int height = 0;
+            uint32_t version = 0;                      // 已同步到的BitmapData版本号
+            sk_sp<SkImage> image;                      // 共享pixels的SkImage
+        };
+
+        // BitmapData -> SkImage 缓存，按BitmapData版本号增量同步
+        std::unordered_map<const void*, CachedBitmapImage> m_imageCache;
 
         // 从BitmapData构建或获取缓存的SkImage
         sk_sp<SkImage> getOrCreateSkImage(class BitmapData* bmp);
+
+        // 以紧凑格式像素（RGB565/ARGB4444/A8）直接构建SkImage，不做格式转换
+        sk_sp<SkImage> createCompactImage(BitmapData* bmp, CachedBitmapImage& entry);
+
+        // 将BitmapData指定区域转换到缓存副本
+        static void convertBitmapRegion(const BitmapData* bmp, CachedBitmapImage& entry,
+                                        int left, int top, int right, int bottom);
         
         // 常量定义
         static constexpr int MAX_BUFFER_POOL_SIZE = 6; // 最大缓冲区池大小
@@ -24,6 +24,10 @@ namespace sys {
         return createSkiaRenderBuffer(width, height);
     }
     
+    std::shared_ptr<RenderBuffer> createRenderBufferForPixels(void* pixels, int width, int height, size_t rowBytes) {
+        return SkiaRenderBuffer::createFromPixels(pixels, width, height, rowBytes);
+    }
+    
     void cleanupRenderers() {
         systemRenderer.reset();
         canvasRenderer.reset();
@@ -76,6 +76,11 @@ namespace sys {
      */
     std::shared_ptr<RenderBuffer> createRenderBuffer(double width = 0, double height = 0);
     
+    /**
+     * 创建直接写入外部像素内存的渲染缓冲区（32位预乘ARGB，不复制像素）
+     */
+    std::shared_ptr<RenderBuffer> createRenderBufferForPixels(void* pixels, int width, int height, size_t rowBytes);
+    
     /**
      * 清理全局渲染器
      */
@@ -14,20 +14,38 @@ namespace egret {
 namespace sys {
 
     SystemTicker::SystemTicker() 
-        : m_frameRate(30)
-        , m_frameInterval(0)
+        : m_nextTickHandle(1)
+        , m_tickHoles(0)
+        , m_tickRunning(0)
+        , m_lastWheelTimeStamp(0)
+        , m_frameRate(30)
         , m_frameDeltaTime(0)
+        , m_frameDuration(0)
         , m_lastTimeStamp(0)
-        , m_lastCount(0)
         , m_costEnterFrame(0)
-        , m_isPaused(false) {
+        , m_isPaused(false)
+        , m_fixedTimestep(false)
+        , m_logicFrameRate(60)
+        , m_maxCatchUpSteps(5)
+        , m_stepDuration(0)
+        , m_accumulator(0)
+        , m_logicTime(0)
+        , m_interpolationAlpha(0)
+        , m_lastStepCount(0)
+        , m_droppedStepCount(0) {
         
         // 初始化时间
         START_TIME = getTimer();
+        m_lastWheelTimeStamp = getTimer();
         
         // 计算帧相关参数
         m_frameDeltaTime = 1000.0 / m_frameRate;
-        m_lastCount = m_frameInterval = static_cast<int>(std::round(60000.0 / m_frameRate));
+        m_frameDuration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double, std::milli>(m_frameDeltaTime));
+        m_nextFrameTime = std::chrono::steady_clock::now();
+        m_stepDuration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(1.0 / m_logicFrameRate));
+        m_lastUpdateTime = m_nextFrameTime;
         
         EGRET_INFOF("SystemTicker初始化: frameRate={}", m_frameRate);
     }
@@ -61,44 +79,68 @@ namespace sys {
         }
     }
     
-    void SystemTicker::startTick(std::function<bool(long long)> callback) {
+    TickHandle SystemTicker::startTick(std::function<bool(long long)> callback) {
         if (!callback) {
-            return;
+            return 0;
         }
         
-        // 检查是否已存在（简化版本，实际应该更精确）
-        int index = getTickIndex(callback);
-        if (index != -1) {
-            return;
+        TickHandle handle = m_nextTickHandle++;
+        if (m_nextTickHandle == 0) {
+            m_nextTickHandle = 1;
         }
+        // 执行中新增的回调从下一次开始执行
+        m_callBackList.push_back({handle, std::move(callback)});
         
-        // 添加回调
-        TickCallback tickCallback;
-        tickCallback.callback = callback;
-        m_callBackList.push_back(tickCallback);
-        
-        EGRET_DEBUGF("启动tick回调，数量={}", m_callBackList.size());
+        EGRET_DEBUGF("启动tick回调，数量={}", getTickCount());
+        return handle;
     }
     
-    void SystemTicker::stopTick(std::function<bool(long long)> callback) {
-        if (!callback) {
+    void SystemTicker::stopTick(TickHandle handle) {
+        if (handle == 0) {
             return;
         }
         
-        int index = getTickIndex(callback);
-        if (index == -1) {
-            return;
+        for (auto& tickCallback : m_callBackList) {
+            if (tickCallback.handle == handle) {
+                // 只置空槽位，执行期间停止不影响遍历
+                tickCallback.handle = 0;
+                tickCallback.callback = nullptr;
+                ++m_tickHoles;
+                if (m_tickRunning == 0) {
+                    compactTickCallbacks();
+                }
+                EGRET_DEBUGF("停止tick回调，剩余数量={}", getTickCount());
+                return;
+            }
         }
-        
-        m_callBackList.erase(m_callBackList.begin() + index);
-        
-        EGRET_DEBUGF("停止tick回调，剩余数量={}", m_callBackList.size());
     }
     
-    int SystemTicker::getTickIndex(const std::function<bool(long long)>& callback) const {
-        // 简化版本：在实际实现中，可能需要更复杂的比较逻辑
-        // 因为std::function的比较比较复杂
-        return -1; // 暂时返回-1，表示未找到
+    bool SystemTicker::runTickCallbacks(long long timeStamp) {
+        bool requestRendering = false;
+        size_t length = m_callBackList.size();
+        ++m_tickRunning;
+        for (size_t i = 0; i < length; ++i) {
+            // 回调中可能startTick导致扩容，每次按下标取
+            if (m_callBackList[i].handle == 0) {
+                continue;
+            }
+            auto callback = m_callBackList[i].callback;
+            if (callback(timeStamp)) {
+                requestRendering = true;
+            }
+        }
+        --m_tickRunning;
+        if (m_tickRunning == 0 && m_tickHoles > 0) {
+            compactTickCallbacks();
+        }
+        return requestRendering;
+    }
+    
+    void SystemTicker::compactTickCallbacks() {
+        m_callBackList.erase(std::remove_if(m_callBackList.begin(), m_callBackList.end(),
+                                            [](const TickCallback& tickCallback) { return tickCallback.handle == 0; }),
+                             m_callBackList.end());
+        m_tickHoles = 0;
     }
     
     bool SystemTicker::setFrameRate(int value) {
@@ -112,16 +154,42 @@ namespace sys {
         
         m_frameRate = value;
         
-        // 限制最大帧率为60
-        if (value > 60) {
-            value = 60;
-        }
-        
+        // 不再限制为60，高刷新率显示器上可以设置120/144等
         m_frameDeltaTime = 1000.0 / value;
-        // 使用60*1000来避免浮点数计算不准确的问题
-        m_lastCount = m_frameInterval = static_cast<int>(std::round(60000.0 / value));
+        m_frameDuration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double, std::milli>(m_frameDeltaTime));
+        m_nextFrameTime = std::chrono::steady_clock::now();
+        
+        EGRET_INFOF("设置帧率={}", m_frameRate);
+        return true;
+    }
+    
+    void SystemTicker::setFixedTimestep(bool enabled) {
+        if (m_fixedTimestep == enabled) {
+            return;
+        }
+        m_fixedTimestep = enabled;
+        // 从当前时刻开始积压，逻辑时钟与getTimer()对齐
+        m_accumulator = std::chrono::steady_clock::duration::zero();
+        m_lastUpdateTime = std::chrono::steady_clock::now();
+        m_logicTime = static_cast<double>(getTimer());
+        m_interpolationAlpha = 0;
+        m_lastStepCount = 0;
+        DisplayObject::captureInterpolationStates();
+        
+        EGRET_INFOF("固定步长模式={} logicFrameRate={}", enabled, m_logicFrameRate);
+    }
+    
+    bool SystemTicker::setLogicFrameRate(int value) {
+        if (value <= 0 || m_logicFrameRate == value) {
+            return false;
+        }
+        m_logicFrameRate = value;
+        m_stepDuration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(1.0 / value));
+        m_accumulator = std::chrono::steady_clock::duration::zero();
         
-        EGRET_INFOF("设置帧率={} (限制为{})", m_frameRate, value);
+        EGRET_INFOF("设置逻辑帧率={}", m_logicFrameRate);
         return true;
     }
     
@@ -151,8 +219,20 @@ namespace sys {
         }
         
         // 如果暂停，只更新时间戳
+        long long wheelElapsed = timeStamp - m_lastWheelTimeStamp;
+        m_lastWheelTimeStamp = timeStamp;
         if (m_isPaused) {
             m_lastTimeStamp = timeStamp;
+            m_lastUpdateTime = std::chrono::steady_clock::now();
+            return;
+        }
+        
+        // 推进时间轮，触发到期的Timer/setTimeout/setInterval；按未暂停的流逝时间推进，暂停期间定时器不走
+        auto& timerWheel = getTimerWheel();
+        timerWheel.advance(timerWheel.getCurrentTime() + wheelElapsed);
+        
+        if (m_fixedTimestep) {
+            updateFixedTimestep(t1);
             return;
         }
         
@@ -160,28 +240,26 @@ namespace sys {
         CallLaterSystem::executeAsyncs();
         
         // 执行tick回调
-        for (auto& tickCallback : m_callBackList) {
-            if (tickCallback.callback && tickCallback.callback(timeStamp)) {
-                requestRenderingFlag = true;
-            }
+        if (runTickCallbacks(timeStamp)) {
+            requestRenderingFlag = true;
         }
         
         long long t2 = getTimer();
-        long long deltaTime = timeStamp - m_lastTimeStamp;
         m_lastTimeStamp = timeStamp;
         
-        // 帧率控制逻辑
-        if (deltaTime >= m_frameDeltaTime || forceUpdate) {
-            m_lastCount = m_frameInterval;
-        } else {
-            m_lastCount -= 1000;
-            if (m_lastCount > 0) {
-                if (requestRenderingFlag) {
-                    render(false, m_costEnterFrame + t2 - t1);
-                }
-                return;
+        // 帧率控制：按高精度时刻判断是否到达下一帧
+        // 提前不足1/4帧也视为到达，容忍主循环唤醒的抖动，避免在帧边界附近漏帧
+        auto now = std::chrono::steady_clock::now();
+        if (!forceUpdate && now < m_nextFrameTime - m_frameDuration / 4) {
+            if (requestRenderingFlag) {
+                render(false, m_costEnterFrame + t2 - t1);
             }
-            m_lastCount += m_frameInterval;
+            return;
+        }
+        m_nextFrameTime += m_frameDuration;
+        if (m_nextFrameTime <= now) {
+            // 落后超过一帧：从当前时刻重新对齐，不追帧
+            m_nextFrameTime = now + m_frameDuration;
         }
         
         // 执行渲染
@@ -194,6 +272,44 @@ namespace sys {
         m_costEnterFrame = t4 - t3;
     }
     
+    void SystemTicker::updateFixedTimestep(long long t1) {
+        auto now = std::chrono::steady_clock::now();
+        m_accumulator += now - m_lastUpdateTime;
+        m_lastUpdateTime = now;
+        
+        // 执行异步调用
+        CallLaterSystem::executeAsyncs();
+        
+        // 按固定步长消耗积压时间，每步先记录上一逻辑帧状态供渲染插值
+        double stepMs = 1000.0 / m_logicFrameRate;
+        int steps = 0;
+        while (m_accumulator >= m_stepDuration && steps < m_maxCatchUpSteps) {
+            DisplayObject::captureInterpolationStates();
+            m_logicTime += stepMs;
+            runLogicStep(std::llround(m_logicTime));
+            m_accumulator -= m_stepDuration;
+            ++steps;
+        }
+        if (m_accumulator >= m_stepDuration) {
+            // 超出追赶上限：丢弃整步的积压，保留不足一步的部分用于插值
+            m_droppedStepCount += m_accumulator / m_stepDuration;
+            m_accumulator %= m_stepDuration;
+        }
+        m_lastStepCount = steps;
+        m_interpolationAlpha = std::chrono::duration<double>(m_accumulator) /
+            std::chrono::duration<double>(m_stepDuration);
+        m_lastTimeStamp = std::llround(m_logicTime);
+        
+        // 每个显示帧渲染一次
+        render(true, getTimer() - t1);
+    }
+    
+    void SystemTicker::runLogicStep(long long timeStamp) {
+        // 每个显示帧都会渲染，tick回调的返回值在此模式下不需要
+        runTickCallbacks(timeStamp);
+        broadcastEnterFrame();
+    }
+    
     void SystemTicker::render(bool triggerByFrame, long long costTicker) {
         if (m_playerList.empty()) {
             return;
@@ -208,58 +324,29 @@ namespace sys {
             invalidateRenderFlag = false;
         }
         
-        // 渲染所有播放器
+        // 渲染所有播放器；固定步长模式下渲染矩阵取插值结果
+        if (m_fixedTimestep) {
+            DisplayObject::beginRenderInterpolation(m_interpolationAlpha);
+        }
         for (auto& player : m_playerList) {
             if (player) {
                 player->render(triggerByFrame, static_cast<int>(costTicker));
             }
         }
+        if (m_fixedTimestep) {
+            DisplayObject::endRenderInterpolation();
+        }
         
         requestRenderingFlag = false;
     }
     
     void SystemTicker::broadcastEnterFrame() {
-        if (m_playerList.empty()) {
-            return;
-        }
-
-        // 深度优先遍历显示树，向每个显示对象派发 ENTER_FRAME
-        auto dispatchTree = [](egret::DisplayObject* obj, egret::Event& evt, auto&& dispatchTreeRef) -> void {
-            if (!obj) return;
-            obj->dispatchEvent(evt);
-            if (auto container = dynamic_cast<egret::DisplayObjectContainer*>(obj)) {
-                int n = container->getNumChildren();
-                for (int i = 0; i < n; ++i) {
-                    dispatchTreeRef(container->getChildAt(i), evt, dispatchTreeRef);
-                }
-            }
-        };
-
-        egret::Event enter(Event::ENTER_FRAME);
-        for (auto& player : m_playerList) {
-            if (!player) continue;
-            auto stage = player->getStage();
-            if (!stage) continue;
-            dispatchTree(stage.get(), enter, dispatchTree);
-        }
+        // 只向注册了ENTER_FRAME侦听器的对象派发，开销与侦听器数量成正比
+        DisplayObject::broadcastEnterFrame();
     }
     
     void SystemTicker::broadcastRender() {
-        // TODO: 实现Render事件广播  
-        // 这需要DisplayObject的静态回调列表支持
-        // 暂时留空，等DisplayObject系统完善后实现
-        
-        /* 原TypeScript代码：
-        let list = DisplayObject.$renderCallBackList;
-        let length = list.length;
-        if (length == 0) {
-            return;
-        }
-        list = list.concat();
-        for (let i = 0; i < length; i++) {
-            list[i].dispatchEventWith(Event.RENDER);
-        }
-        */
+        DisplayObject::broadcastRender();
     }
     
     // 全局ticker实例
@@ -2,10 +2,13 @@
 
 #include "player/Player.hpp"
 #include "utils/Timer.hpp"
+#include "utils/TimerWheel.hpp"
 #include "utils/CallLater.hpp"
 #include "utils/Lifecycle.hpp"
 #include "display/DisplayObject.hpp"
 #include "events/Event.hpp"
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <vector>
 #include <memory>
@@ -16,6 +19,11 @@ namespace sys {
     // 前向声明
     class Player;
 
+    /**
+     * tick回调句柄，0为无效句柄
+     */
+    using TickHandle = uint32_t;
+    
     /**
      * Egret心跳计时器
      * 对应 TypeScript 的 egret.sys.SystemTicker
@@ -52,15 +60,21 @@ namespace sys {
         
         /**
          * 开始tick回调
-         * @param callback tick回调函数，返回true表示需要渲染
+         * @param callback tick回调函数，参数为时间戳，返回true表示需要渲染
+         * @return 回调句柄，传给stopTick停止；0表示callback为空
+         */
+        TickHandle startTick(std::function<bool(long long)> callback);
+        
+        /**
+         * 停止tick回调，可在tick回调中调用
+         * @param handle startTick返回的句柄
          */
-        void startTick(std::function<bool(long long)> callback);
+        void stopTick(TickHandle handle);
         
         /**
-         * 停止tick回调
-         * @param callback tick回调函数
+         * 当前注册的tick回调数量
          */
-        void stopTick(std::function<bool(long long)> callback);
+        size_t getTickCount() const { return m_callBackList.size() - m_tickHoles; }
         
         /**
          * 设置全局帧率
@@ -74,6 +88,50 @@ namespace sys {
          */
         int getFrameRate() const { return m_frameRate; }
         
+        /**
+         * 获取帧时间间隔（毫秒）
+         */
+        double getFrameDeltaTime() const { return m_frameDeltaTime; }
+        
+        // ========== 固定步长模式 ==========
+        
+        /**
+         * 开启/关闭固定步长模式
+         * 开启后tick回调与ENTER_FRAME按逻辑帧率以固定步长执行，一个显示帧内可能执行0次或多次，
+         * 渲染则每个显示帧执行一次；帧率（setFrameRate）仍决定显示帧的节奏
+         */
+        void setFixedTimestep(bool enabled);
+        bool isFixedTimestep() const { return m_fixedTimestep; }
+        
+        /**
+         * 设置逻辑帧率（固定步长模式下每秒的逻辑步数），默认60
+         * @return 是否设置成功
+         */
+        bool setLogicFrameRate(int value);
+        int getLogicFrameRate() const { return m_logicFrameRate; }
+        
+        /**
+         * 每个显示帧最多追赶的逻辑步数，默认5；超出的积压时间直接丢弃，游戏时间变慢但不会越追越慢
+         */
+        void setMaxCatchUpSteps(int value) { m_maxCatchUpSteps = value > 0 ? value : 1; }
+        int getMaxCatchUpSteps() const { return m_maxCatchUpSteps; }
+        
+        /**
+         * 渲染插值系数：积压时间占一个逻辑步长的比例，范围[0, 1)
+         * 开启了DisplayObject::setTransformInterpolation的对象在渲染时按此系数混合最近两个逻辑帧
+         */
+        double getInterpolationAlpha() const { return m_interpolationAlpha; }
+        
+        /**
+         * 上一个显示帧执行的逻辑步数
+         */
+        int getLastStepCount() const { return m_lastStepCount; }
+        
+        /**
+         * 因超出追赶上限而丢弃的逻辑步总数
+         */
+        long long getDroppedStepCount() const { return m_droppedStepCount; }
+        
         /**
          * 暂停心跳
          */
@@ -107,21 +165,32 @@ namespace sys {
         
     private:
         /**
-         * Tick回调信息结构
+         * Tick回调信息结构；handle为0表示已停止、等待压缩的槽位
          */
         struct TickCallback {
+            TickHandle handle;
             std::function<bool(long long)> callback;
-            
-            bool operator==(const TickCallback& other) const {
-                // 函数指针比较比较复杂，这里简化处理
-                return false; // TODO: 更好的比较方式
-            }
         };
         
         /**
-         * 获取tick回调的索引
+         * 依次执行tick回调，返回是否有回调请求渲染
          */
-        int getTickIndex(const std::function<bool(long long)>& callback) const;
+        bool runTickCallbacks(long long timeStamp);
+        
+        /**
+         * 压缩已停止的tick回调槽位
+         */
+        void compactTickCallbacks();
+        
+        /**
+         * 固定步长模式下的一次更新
+         */
+        void updateFixedTimestep(long long t1);
+        
+        /**
+         * 执行一个逻辑步：tick回调与ENTER_FRAME
+         */
+        void runLogicStep(long long timeStamp);
         
         /**
          * 执行一次屏幕渲染
@@ -142,15 +211,31 @@ namespace sys {
         
         std::vector<std::shared_ptr<Player>> m_playerList;    // 播放器列表
         std::vector<TickCallback> m_callBackList;             // tick回调列表
+        TickHandle m_nextTickHandle;                           // 下一个分配的tick句柄
+        size_t m_tickHoles;                                    // 已停止、等待压缩的tick回调数量
+        int m_tickRunning;                                     // 正在执行tick回调的嵌套层数
+        long long m_lastWheelTimeStamp;                        // 上次推进时间轮的时间戳
         
         int m_frameRate;                                       // 全局帧率
-        int m_frameInterval;                                   // 帧间隔（以60fps为基准的计数）
         double m_frameDeltaTime;                               // 帧时间间隔（毫秒）
+        std::chrono::steady_clock::duration m_frameDuration;   // 帧时间间隔（高精度）
+        std::chrono::steady_clock::time_point m_nextFrameTime; // 下一帧的到达时刻
         long long m_lastTimeStamp;                             // 上次时间戳
-        int m_lastCount;                                       // 剩余计数
         long long m_costEnterFrame;                            // EnterFrame事件消耗时间
         bool m_isPaused;                                       // 是否暂停
         
+        // 固定步长模式
+        bool m_fixedTimestep;                                  // 是否开启固定步长
+        int m_logicFrameRate;                                  // 逻辑帧率
+        int m_maxCatchUpSteps;                                 // 每个显示帧最多追赶的逻辑步数
+        std::chrono::steady_clock::duration m_stepDuration;    // 逻辑步长
+        std::chrono::steady_clock::duration m_accumulator;     // 尚未消耗的积压时间
+        std::chrono::steady_clock::time_point m_lastUpdateTime; // 上次更新的时刻
+        double m_logicTime;                                    // 逻辑时钟（毫秒），传给tick回调
+        double m_interpolationAlpha;                           // 渲染插值系数
+        int m_lastStepCount;                                   // 上一显示帧执行的逻辑步数
+        long long m_droppedStepCount;                          // 丢弃的逻辑步总数
+        
         // 单例相关
         friend SystemTicker& getTicker();
     };
@@ -0,0 +1,408 @@
+#include "sys/PixelOps.hpp"
+#include "geom/ColorTransform.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// 可通过预定义EGRET_PIXELOPS_SSE2=0强制使用标量实现
+#ifndef EGRET_PIXELOPS_SSE2
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define EGRET_PIXELOPS_SSE2 1
+#else
+#define EGRET_PIXELOPS_SSE2 0
+#endif
+#endif
+
+#if EGRET_PIXELOPS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace egret {
+namespace sys {
+namespace PixelOps {
+
+    namespace {
+
+        inline uint32_t clampChannel(int value) {
+            return static_cast<uint32_t>(std::clamp(value, 0, 255));
+        }
+
+        // 标量source-over（非预乘）
+        inline uint32_t blendPixel(uint32_t d, uint32_t s) {
+            uint32_t sa = s >> 24;
+            if (sa == 255) return s;
+            if (sa == 0) return d;
+            uint32_t da = d >> 24;
+            if (da == 0) return s;
+
+            // 以 255*255 为单位计算权重，避免浮点
+            uint32_t ws = sa * 255;
+            uint32_t wd = da * (255 - sa);
+            uint32_t wo = ws + wd;
+            uint32_t r = (((s >> 16) & 0xFF) * ws + ((d >> 16) & 0xFF) * wd + wo / 2) / wo;
+            uint32_t g = (((s >> 8) & 0xFF) * ws + ((d >> 8) & 0xFF) * wd + wo / 2) / wo;
+            uint32_t b = ((s & 0xFF) * ws + (d & 0xFF) * wd + wo / 2) / wo;
+            uint32_t a = (wo + 127) / 255;
+            return (a << 24) | (r << 16) | (g << 8) | b;
+        }
+
+        inline bool compareThreshold(uint32_t value, uint32_t threshold, ThresholdOp op) {
+            switch (op) {
+                case ThresholdOp::LESS:          return value < threshold;
+                case ThresholdOp::LESS_EQUAL:    return value <= threshold;
+                case ThresholdOp::GREATER:       return value > threshold;
+                case ThresholdOp::GREATER_EQUAL: return value >= threshold;
+                case ThresholdOp::EQUAL:         return value == threshold;
+                case ThresholdOp::NOT_EQUAL:     return value != threshold;
+            }
+            return false;
+        }
+
+        inline uint32_t premultiplyPixel(uint32_t p) {
+            uint32_t a = p >> 24;
+            if (a == 255) return p;
+            if (a == 0) return 0;
+            uint32_t r = (((p >> 16) & 0xFF) * a + 127) / 255;
+            uint32_t g = (((p >> 8) & 0xFF) * a + 127) / 255;
+            uint32_t b = ((p & 0xFF) * a + 127) / 255;
+            return (a << 24) | (r << 16) | (g << 8) | b;
+        }
+
+        inline uint32_t unpremultiplyPixel(uint32_t p) {
+            uint32_t a = p >> 24;
+            if (a == 255) return p;
+            if (a == 0) return 0;
+            uint32_t half = a / 2;
+            uint32_t r = std::min<uint32_t>(255, (((p >> 16) & 0xFF) * 255 + half) / a);
+            uint32_t g = std::min<uint32_t>(255, (((p >> 8) & 0xFF) * 255 + half) / a);
+            uint32_t b = std::min<uint32_t>(255, ((p & 0xFF) * 255 + half) / a);
+            return (a << 24) | (r << 16) | (g << 8) | b;
+        }
+
+#if EGRET_PIXELOPS_SSE2
+        // 4个像素是否全部不透明
+        inline bool allOpaque4(const uint32_t* p) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            __m128i alpha = _mm_srli_epi32(v, 24);
+            return _mm_movemask_epi8(_mm_cmpeq_epi32(alpha, _mm_set1_epi32(255))) == 0xFFFF;
+        }
+
+        // 无符号32位比较结果掩码
+        inline __m128i thresholdMask(__m128i value, __m128i threshold, ThresholdOp op) {
+            const __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000u));
+            __m128i a = _mm_xor_si128(value, bias);
+            __m128i b = _mm_xor_si128(threshold, bias);
+            __m128i eq = _mm_cmpeq_epi32(a, b);
+            switch (op) {
+                case ThresholdOp::LESS:          return _mm_cmplt_epi32(a, b);
+                case ThresholdOp::LESS_EQUAL:    return _mm_or_si128(_mm_cmplt_epi32(a, b), eq);
+                case ThresholdOp::GREATER:       return _mm_cmpgt_epi32(a, b);
+                case ThresholdOp::GREATER_EQUAL: return _mm_or_si128(_mm_cmpgt_epi32(a, b), eq);
+                case ThresholdOp::EQUAL:         return eq;
+                case ThresholdOp::NOT_EQUAL:     return _mm_xor_si128(eq, _mm_set1_epi32(-1));
+            }
+            return _mm_setzero_si128();
+        }
+
+        inline int popcount4(int bits) {
+            return (bits & 1) + ((bits >> 1) & 1) + ((bits >> 2) & 1) + ((bits >> 3) & 1);
+        }
+#endif
+
+    } // namespace
+
+    bool parseThresholdOp(const char* operation, ThresholdOp& result) {
+        if (!operation) return false;
+        if (std::strcmp(operation, "<") == 0)  { result = ThresholdOp::LESS; return true; }
+        if (std::strcmp(operation, "<=") == 0) { result = ThresholdOp::LESS_EQUAL; return true; }
+        if (std::strcmp(operation, ">") == 0)  { result = ThresholdOp::GREATER; return true; }
+        if (std::strcmp(operation, ">=") == 0) { result = ThresholdOp::GREATER_EQUAL; return true; }
+        if (std::strcmp(operation, "==") == 0) { result = ThresholdOp::EQUAL; return true; }
+        if (std::strcmp(operation, "!=") == 0) { result = ThresholdOp::NOT_EQUAL; return true; }
+        return false;
+    }
+
+    void fillRow(uint32_t* dst, int count, uint32_t color) {
+        if (count <= 0) return;
+        if ((color & 0xFF) * 0x01010101u == color) {
+            // 四个字节相同（如全透明/纯白），直接memset
+            std::memset(dst, static_cast<int>(color & 0xFF), static_cast<size_t>(count) * sizeof(uint32_t));
+            return;
+        }
+        int i = 0;
+#if EGRET_PIXELOPS_SSE2
+        __m128i c = _mm_set1_epi32(static_cast<int>(color));
+        for (; i + 4 <= count; i += 4) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), c);
+        }
+#endif
+        for (; i < count; ++i) {
+            dst[i] = color;
+        }
+    }
+
+    void copyRow(uint32_t* dst, const uint32_t* src, int count) {
+        if (count <= 0 || dst == src) return;
+        std::memmove(dst, src, static_cast<size_t>(count) * sizeof(uint32_t));
+    }
+
+    void blendRow(uint32_t* dst, const uint32_t* src, int count) {
+        int i = 0;
+#if EGRET_PIXELOPS_SSE2
+        for (; i + 4 <= count; i += 4) {
+            __m128i s4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            // 4个像素Alpha全为255：整块复制；全为0：跳过
+            __m128i alpha = _mm_srli_epi32(s4, 24);
+            int opaque = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(alpha, _mm_set1_epi32(255))));
+            if (opaque == 0xF) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), s4);
+                continue;
+            }
+            int transparent = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(alpha, _mm_setzero_si128())));
+            if (transparent == 0xF) {
+                continue;
+            }
+            // 半透明像素使用与标量路径相同的整数运算，保证结果与平台无关
+            for (int k = 0; k < 4; ++k) {
+                dst[i + k] = blendPixel(dst[i + k], src[i + k]);
+            }
+        }
+#endif
+        for (; i < count; ++i) {
+            dst[i] = blendPixel(dst[i], src[i]);
+        }
+    }
+
+    void mergeRow(uint32_t* dst, const uint32_t* src, int count, const uint32_t multipliers[4]) {
+        const uint32_t mr = std::min<uint32_t>(multipliers[0], 256);
+        const uint32_t mg = std::min<uint32_t>(multipliers[1], 256);
+        const uint32_t mb = std::min<uint32_t>(multipliers[2], 256);
+        const uint32_t ma = std::min<uint32_t>(multipliers[3], 256);
+        int i = 0;
+#if EGRET_PIXELOPS_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        // 内存中通道顺序为 B、G、R、A
+        const __m128i mul = _mm_set_epi16(static_cast<short>(ma), static_cast<short>(mr), static_cast<short>(mg), static_cast<short>(mb),
+                                          static_cast<short>(ma), static_cast<short>(mr), static_cast<short>(mg), static_cast<short>(mb));
+        const __m128i inv = _mm_sub_epi16(_mm_set1_epi16(256), mul);
+        for (; i + 4 <= count; i += 4) {
+            __m128i s4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            __m128i d4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+            __m128i sLo = _mm_unpacklo_epi8(s4, zero);
+            __m128i sHi = _mm_unpackhi_epi8(s4, zero);
+            __m128i dLo = _mm_unpacklo_epi8(d4, zero);
+            __m128i dHi = _mm_unpackhi_epi8(d4, zero);
+            // 255 * 256 = 65280，16位无符号范围内不会溢出
+            __m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(sLo, mul), _mm_mullo_epi16(dLo, inv)), 8);
+            __m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(sHi, mul), _mm_mullo_epi16(dHi, inv)), 8);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+        }
+#endif
+        for (; i < count; ++i) {
+            uint32_t s = src[i];
+            uint32_t d = dst[i];
+            uint32_t a = (((s >> 24) & 0xFF) * ma + ((d >> 24) & 0xFF) * (256 - ma)) >> 8;
+            uint32_t r = (((s >> 16) & 0xFF) * mr + ((d >> 16) & 0xFF) * (256 - mr)) >> 8;
+            uint32_t g = (((s >> 8) & 0xFF) * mg + ((d >> 8) & 0xFF) * (256 - mg)) >> 8;
+            uint32_t b = ((s & 0xFF) * mb + (d & 0xFF) * (256 - mb)) >> 8;
+            dst[i] = (a << 24) | (r << 16) | (g << 8) | b;
+        }
+    }
+
+    int thresholdRow(uint32_t* dst, const uint32_t* src, int count, ThresholdOp op,
+                     uint32_t threshold, uint32_t color, uint32_t mask, bool copySource) {
+        const uint32_t maskedThreshold = threshold & mask;
+        int hits = 0;
+        int i = 0;
+#if EGRET_PIXELOPS_SSE2
+        const __m128i vMask = _mm_set1_epi32(static_cast<int>(mask));
+        const __m128i vThreshold = _mm_set1_epi32(static_cast<int>(maskedThreshold));
+        const __m128i vColor = _mm_set1_epi32(static_cast<int>(color));
+        for (; i + 4 <= count; i += 4) {
+            __m128i s4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            __m128i pass = thresholdMask(_mm_and_si128(s4, vMask), vThreshold, op);
+            __m128i other = copySource ? s4 : _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+            __m128i out = _mm_or_si128(_mm_and_si128(pass, vColor), _mm_andnot_si128(pass, other));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), out);
+            hits += popcount4(_mm_movemask_ps(_mm_castsi128_ps(pass)));
+        }
+#endif
+        for (; i < count; ++i) {
+            uint32_t s = src[i];
+            if (compareThreshold(s & mask, maskedThreshold, op)) {
+                dst[i] = color;
+                ++hits;
+            } else if (copySource) {
+                dst[i] = s;
+            }
+        }
+        return hits;
+    }
+
+    void buildColorTransformTable(const ColorTransform& transform, ColorTransformTable& table) {
+        auto channel = [](int value, double multiplier, double offset) {
+            return clampChannel(static_cast<int>(std::lround(value * multiplier + offset)));
+        };
+        for (int v = 0; v < 256; ++v) {
+            table.alpha[v] = channel(v, transform.alphaMultiplier, transform.alphaOffset) << 24;
+            table.red[v] = channel(v, transform.redMultiplier, transform.redOffset) << 16;
+            table.green[v] = channel(v, transform.greenMultiplier, transform.greenOffset) << 8;
+            table.blue[v] = channel(v, transform.blueMultiplier, transform.blueOffset);
+        }
+    }
+
+    void colorTransformRow(uint32_t* dst, int count, const ColorTransformTable& table) {
+        auto transformPixel = [&table](uint32_t p) {
+            return table.alpha[p >> 24] | table.red[(p >> 16) & 0xFF] | table.green[(p >> 8) & 0xFF] | table.blue[p & 0xFF];
+        };
+        int i = 0;
+        // 每次4个像素，相互独立的查表可以并行发射
+        for (; i + 4 <= count; i += 4) {
+            uint32_t p0 = dst[i];
+            uint32_t p1 = dst[i + 1];
+            uint32_t p2 = dst[i + 2];
+            uint32_t p3 = dst[i + 3];
+            dst[i] = transformPixel(p0);
+            dst[i + 1] = transformPixel(p1);
+            dst[i + 2] = transformPixel(p2);
+            dst[i + 3] = transformPixel(p3);
+        }
+        for (; i < count; ++i) {
+            dst[i] = transformPixel(dst[i]);
+        }
+    }
+
+    void premultiplyRow(uint32_t* pixels, int count) {
+        int i = 0;
+#if EGRET_PIXELOPS_SSE2
+        // 不透明像素预乘前后相同，整组跳过
+        for (; i + 4 <= count; i += 4) {
+            if (allOpaque4(pixels + i)) continue;
+            for (int k = 0; k < 4; ++k) pixels[i + k] = premultiplyPixel(pixels[i + k]);
+        }
+#endif
+        for (; i < count; ++i) {
+            pixels[i] = premultiplyPixel(pixels[i]);
+        }
+    }
+
+    void unpremultiplyRow(uint32_t* pixels, int count) {
+        int i = 0;
+#if EGRET_PIXELOPS_SSE2
+        for (; i + 4 <= count; i += 4) {
+            if (allOpaque4(pixels + i)) continue;
+            for (int k = 0; k < 4; ++k) pixels[i + k] = unpremultiplyPixel(pixels[i + k]);
+        }
+#endif
+        for (; i < count; ++i) {
+            pixels[i] = unpremultiplyPixel(pixels[i]);
+        }
+    }
+
+    int storeChangedPremultipliedRow(uint32_t* dst, const uint32_t* premultiplied, int count) {
+        int changed = 0;
+        for (int i = 0; i < count; ++i) {
+            uint32_t p = premultiplied[i];
+            if (p != premultiplyPixel(dst[i])) {
+                dst[i] = unpremultiplyPixel(p);
+                ++changed;
+            }
+        }
+        return changed;
+    }
+
+    // ========== 紧凑格式转换 ==========
+
+    void packRGB565Row(uint16_t* dst, const uint32_t* src, int count) {
+        for (int i = 0; i < count; ++i) {
+            uint32_t p = src[i];
+            uint32_t r = (((p >> 16) & 0xFF) * 31 + 127) / 255;
+            uint32_t g = (((p >> 8) & 0xFF) * 63 + 127) / 255;
+            uint32_t b = ((p & 0xFF) * 31 + 127) / 255;
+            dst[i] = static_cast<uint16_t>((r << 11) | (g << 5) | b);
+        }
+    }
+
+    void unpackRGB565Row(uint32_t* dst, const uint16_t* src, int count) {
+        for (int i = 0; i < count; ++i) {
+            uint32_t p = src[i];
+            uint32_t r = (p >> 11) & 0x1F;
+            uint32_t g = (p >> 5) & 0x3F;
+            uint32_t b = p & 0x1F;
+            r = (r << 3) | (r >> 2);
+            g = (g << 2) | (g >> 4);
+            b = (b << 3) | (b >> 2);
+            dst[i] = 0xFF000000u | (r << 16) | (g << 8) | b;
+        }
+    }
+
+    void packARGB4444Row(uint16_t* dst, const uint32_t* src, int count) {
+        for (int i = 0; i < count; ++i) {
+            uint32_t p = premultiplyPixel(src[i]);
+            uint32_t a = ((p >> 24) * 15 + 127) / 255;
+            uint32_t r = ((((p >> 16) & 0xFF) * 15 + 127) / 255);
+            uint32_t g = ((((p >> 8) & 0xFF) * 15 + 127) / 255);
+            uint32_t b = (((p & 0xFF) * 15 + 127) / 255);
+            // 量化后仍保证预乘约束 c <= a
+            r = std::min(r, a);
+            g = std::min(g, a);
+            b = std::min(b, a);
+            dst[i] = static_cast<uint16_t>((r << 12) | (g << 8) | (b << 4) | a);
+        }
+    }
+
+    void unpackARGB4444Row(uint32_t* dst, const uint16_t* src, int count) {
+        for (int i = 0; i < count; ++i) {
+            uint32_t p = src[i];
+            uint32_t r = ((p >> 12) & 0xF) * 17;
+            uint32_t g = ((p >> 8) & 0xF) * 17;
+            uint32_t b = ((p >> 4) & 0xF) * 17;
+            uint32_t a = (p & 0xF) * 17;
+            dst[i] = unpremultiplyPixel((a << 24) | (r << 16) | (g << 8) | b);
+        }
+    }
+
+    void alphaMaskRow(uint64_t* bits, const uint32_t* src, int count, uint8_t threshold) {
+        int words = (count + 63) / 64;
+        std::fill_n(bits, words, 0ull);
+        int i = 0;
+#if EGRET_PIXELOPS_SSE2
+        // 每次16个像素：Alpha收窄为字节后做无符号比较，movemask得到16位
+        const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80));
+        const __m128i limit = _mm_set1_epi8(static_cast<char>(threshold ^ 0x80));
+        for (; i + 16 <= count; i += 16) {
+            const __m128i* p = reinterpret_cast<const __m128i*>(src + i);
+            __m128i a0 = _mm_srli_epi32(_mm_loadu_si128(p), 24);
+            __m128i a1 = _mm_srli_epi32(_mm_loadu_si128(p + 1), 24);
+            __m128i a2 = _mm_srli_epi32(_mm_loadu_si128(p + 2), 24);
+            __m128i a3 = _mm_srli_epi32(_mm_loadu_si128(p + 3), 24);
+            __m128i lo = _mm_packs_epi32(a0, a1);
+            __m128i hi = _mm_packs_epi32(a2, a3);
+            __m128i alpha = _mm_packus_epi16(lo, hi);
+            __m128i gt = _mm_cmpgt_epi8(_mm_xor_si128(alpha, bias), limit);
+            uint64_t mask = static_cast<uint32_t>(_mm_movemask_epi8(gt));
+            bits[i >> 6] |= mask << (i & 63);
+        }
+#endif
+        for (; i < count; ++i) {
+            if ((src[i] >> 24) > threshold) {
+                bits[i >> 6] |= 1ull << (i & 63);
+            }
+        }
+    }
+
+    void packA8Row(uint8_t* dst, const uint32_t* src, int count) {
+        for (int i = 0; i < count; ++i) {
+            dst[i] = static_cast<uint8_t>(src[i] >> 24);
+        }
+    }
+
+    void unpackA8Row(uint32_t* dst, const uint8_t* src, int count) {
+        for (int i = 0; i < count; ++i) {
+            dst[i] = (static_cast<uint32_t>(src[i]) << 24) | 0x00FFFFFFu;
+        }
+    }
+
+} // namespace PixelOps
+} // namespace sys
+} // namespace egret
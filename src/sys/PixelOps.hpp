@@ -0,0 +1,146 @@
+#pragma once
+#include <cstdint>
+
+namespace egret {
+
+    class ColorTransform;
+
+namespace sys {
+
+    /**
+     * 位图像素批量操作（按行处理，32位ARGB非预乘格式）
+     * x86/x64上使用SSE2实现，其他平台回退到标量实现
+     */
+    namespace PixelOps {
+
+        /**
+         * threshold比较运算符
+         */
+        enum class ThresholdOp {
+            LESS,            // "<"
+            LESS_EQUAL,      // "<="
+            GREATER,         // ">"
+            GREATER_EQUAL,   // ">="
+            EQUAL,           // "=="
+            NOT_EQUAL        // "!="
+        };
+
+        /**
+         * 解析Flash风格的运算符字符串
+         * @return 是否解析成功
+         */
+        bool parseThresholdOp(const char* operation, ThresholdOp& result);
+
+        /**
+         * 以单一颜色填充一行
+         */
+        void fillRow(uint32_t* dst, int count, uint32_t color);
+
+        /**
+         * 复制一行像素（允许源与目标重叠）
+         */
+        void copyRow(uint32_t* dst, const uint32_t* src, int count);
+
+        /**
+         * 以源像素的Alpha将源行叠加（source-over）到目标行
+         * SSE2只用于整组4个像素全部不透明/全部透明的快速路径，
+         * 半透明像素统一走整数实现，结果与标量平台逐位一致
+         */
+        void blendRow(uint32_t* dst, const uint32_t* src, int count);
+
+        /**
+         * 按通道混合：dst = (src * multiplier + dst * (256 - multiplier)) / 256
+         * @param multipliers 各通道乘数（0~256），顺序为 红、绿、蓝、Alpha
+         */
+        void mergeRow(uint32_t* dst, const uint32_t* src, int count, const uint32_t multipliers[4]);
+
+        /**
+         * 阈值测试：(src & mask) op (threshold & mask) 成立时 dst = color，
+         * 否则在copySource为true时 dst = src
+         * @return 通过测试的像素数量
+         */
+        int thresholdRow(uint32_t* dst, const uint32_t* src, int count, ThresholdOp op,
+                         uint32_t threshold, uint32_t color, uint32_t mask, bool copySource);
+
+        /**
+         * 颜色变换查找表：每个通道256项，由buildColorTransformTable生成
+         * 查表与CPU无关，SSE2与标量平台的结果完全一致
+         */
+        struct ColorTransformTable {
+            // 表项已移到通道所在的位，查表结果直接按位或
+            uint32_t alpha[256];
+            uint32_t red[256];
+            uint32_t green[256];
+            uint32_t blue[256];
+        };
+
+        /**
+         * 生成颜色变换查找表：value * multiplier + offset，四舍五入（lround）后截断到0~255
+         */
+        void buildColorTransformTable(const ColorTransform& transform, ColorTransformTable& table);
+
+        /**
+         * 对一行像素应用颜色变换（每次处理4个像素）
+         */
+        void colorTransformRow(uint32_t* dst, int count, const ColorTransformTable& table);
+
+        /**
+         * 将一行非预乘像素原地转换为预乘Alpha格式
+         */
+        void premultiplyRow(uint32_t* pixels, int count);
+
+        /**
+         * 将一行预乘像素原地还原为非预乘格式
+         */
+        void unpremultiplyRow(uint32_t* pixels, int count);
+
+        /**
+         * 将一行预乘像素写回非预乘目标行：只有与目标像素预乘后的值不同（即被改动过）的像素
+         * 才还原并写入，未改动的像素保持原值，不会因预乘往返损失精度
+         * @return 写入的像素数量
+         */
+        int storeChangedPremultipliedRow(uint32_t* dst, const uint32_t* premultiplied, int count);
+
+        /**
+         * 生成一行1位Alpha掩码：Alpha大于threshold的像素对应位为1
+         * 第i个像素对应 bits[i / 64] 的第 (i % 64) 位，写入 (count + 63) / 64 个字
+         */
+        void alphaMaskRow(uint64_t* bits, const uint32_t* src, int count, uint8_t threshold);
+
+        // ========== 紧凑格式转换 ==========
+        // 紧凑格式的内存布局与Skia对应颜色类型一致，可直接包装为SkImage
+
+        /**
+         * ARGB8888 -> RGB565（丢弃Alpha，布局 r<<11 | g<<5 | b）
+         */
+        void packRGB565Row(uint16_t* dst, const uint32_t* src, int count);
+
+        /**
+         * RGB565 -> ARGB8888（Alpha为255）
+         */
+        void unpackRGB565Row(uint32_t* dst, const uint16_t* src, int count);
+
+        /**
+         * ARGB8888（非预乘）-> ARGB4444（预乘，布局 r<<12 | g<<8 | b<<4 | a）
+         */
+        void packARGB4444Row(uint16_t* dst, const uint32_t* src, int count);
+
+        /**
+         * ARGB4444（预乘）-> ARGB8888（非预乘）
+         */
+        void unpackARGB4444Row(uint32_t* dst, const uint16_t* src, int count);
+
+        /**
+         * ARGB8888 -> A8（只保留Alpha）
+         */
+        void packA8Row(uint8_t* dst, const uint32_t* src, int count);
+
+        /**
+         * A8 -> ARGB8888（颜色为白色）
+         */
+        void unpackA8Row(uint32_t* dst, const uint8_t* src, int count);
+
+    } // namespace PixelOps
+
+} // namespace sys
+} // namespace egret
@@ -0,0 +1,115 @@
+#include "sys/TouchHandler.hpp"
+#include "display/Stage.hpp"
+#include <algorithm>
+
+namespace egret {
+namespace sys {
+
+    TouchHandler::TouchHandler(Stage* stage)
+        : m_stage(stage) {
+        initMaxTouches();
+    }
+
+    void TouchHandler::initMaxTouches() {
+        m_maxTouches = m_stage ? m_stage->getMaxTouches() : 0;
+        // 预留常见的多点触摸数量，按下/抬起时不分配内存
+        m_touchDownTargets.reserve(static_cast<size_t>(std::clamp(m_maxTouches, 0, 10)));
+        m_endingTargets.reserve(2);
+    }
+
+    // ========== 触摸事件处理 ==========
+
+    void TouchHandler::onTouchBegin(double x, double y, int touchPointID) {
+        if (m_useTouchesCount >= m_maxTouches) {
+            return;
+        }
+        DisplayObject* target = findTarget(x, y);
+        if (!findTouch(touchPointID)) {
+            m_touchDownTargets.push_back({touchPointID, target, x, y});
+            ++m_useTouchesCount;
+        }
+        dispatch(target, TouchEvent::TOUCH_BEGIN, x, y, touchPointID, true);
+    }
+
+    void TouchHandler::onTouchMove(double x, double y, int touchPointID, size_t coalescedCount,
+                                   const std::vector<TouchEvent::MoveSample>* samples) {
+        TouchDownTarget* touch = findTouch(touchPointID);
+        if (!touch) {
+            return;
+        }
+        if (touch->lastX == x && touch->lastY == y) {
+            return;
+        }
+        touch->lastX = x;
+        touch->lastY = y;
+        dispatch(touch->target, TouchEvent::TOUCH_MOVE, x, y, touchPointID, true, coalescedCount, samples);
+    }
+
+    void TouchHandler::onTouchEnd(double x, double y, int touchPointID) {
+        TouchDownTarget* touch = findTouch(touchPointID);
+        if (!touch) {
+            return;
+        }
+        DisplayObject* oldTarget = touch->target;
+        // 派发前先移除记录，侦听器中再次按下同一触摸点不受影响
+        *touch = m_touchDownTargets.back();
+        m_touchDownTargets.pop_back();
+        --m_useTouchesCount;
+
+        // 侦听器可能把目标移出舞台甚至销毁，目标登记在m_endingTargets中，离开舞台时由onTargetRemoved清空
+        const size_t slot = m_endingTargets.size();
+        DisplayObject* target = findTarget(x, y);
+        const bool isTap = oldTarget == target;
+        m_endingTargets.push_back(target);
+        m_endingTargets.push_back(oldTarget);
+
+        dispatch(target, TouchEvent::TOUCH_END, x, y, touchPointID, false);
+        if (isTap) {
+            if (DisplayObject* tapTarget = m_endingTargets[slot]) {
+                dispatch(tapTarget, TouchEvent::TOUCH_TAP, x, y, touchPointID, false);
+            }
+        } else if (DisplayObject* releaseTarget = m_endingTargets[slot + 1]) {
+            dispatch(releaseTarget, TouchEvent::TOUCH_RELEASE_OUTSIDE, x, y, touchPointID, false);
+        }
+        m_endingTargets.resize(slot);
+    }
+
+    void TouchHandler::onTargetRemoved(DisplayObject* target) {
+        for (auto& touch : m_touchDownTargets) {
+            if (touch.target == target) {
+                touch.target = m_stage;
+            }
+        }
+        // 正在派发TOUCH_END序列的目标不再接收后续事件
+        std::replace(m_endingTargets.begin(), m_endingTargets.end(), target, static_cast<DisplayObject*>(nullptr));
+    }
+
+    // ========== 私有辅助方法 ==========
+
+    DisplayObject* TouchHandler::findTarget(double x, double y) {
+        ++m_hitTestCount;
+        DisplayObject* target = m_stage->hitTest(x, y);
+        return target ? target : m_stage;
+    }
+
+    TouchHandler::TouchDownTarget* TouchHandler::findTouch(int touchPointID) {
+        for (auto& touch : m_touchDownTargets) {
+            if (touch.touchPointID == touchPointID) {
+                return &touch;
+            }
+        }
+        return nullptr;
+    }
+
+    void TouchHandler::dispatch(DisplayObject* target, const std::string& type, double x, double y,
+                                int touchPointID, bool touchDown, size_t coalescedCount,
+                                const std::vector<TouchEvent::MoveSample>* samples) {
+        // bubbles / cancelable 设为 true 以便更接近 Egret 行为；实例取自对象池，派发后归还
+        auto event = TouchEvent::create(type, true, true, x, y, touchPointID, touchDown);
+        event->setCoalesced(coalescedCount, samples);
+        target->dispatchEvent(*event);
+        TouchEvent::release(event);
+    }
+
+} // namespace sys
+} // namespace egret
@@ -0,0 +1,99 @@
+#pragma once
+#include "events/TouchEvent.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace egret {
+    class DisplayObject;
+    class Stage;
+
+    namespace sys {
+
+        /**
+         * 触摸处理器
+         * 对应TypeScript: egret.sys.TouchHandler
+         *
+         * 按触摸点ID记录TOUCH_BEGIN时命中的对象：
+         * - TOUCH_MOVE直接派发给按下时的对象，不再做碰撞检测
+         * - TOUCH_END时碰撞检测一次，抬起对象与按下对象相同则派发TOUCH_TAP，否则向按下对象派发TOUCH_RELEASE_OUTSIDE
+         * - 同时按下的触摸点数不超过Stage::getMaxTouches()
+         */
+        class TouchHandler {
+        public:
+            explicit TouchHandler(Stage* stage);
+
+            TouchHandler(const TouchHandler&) = delete;
+            TouchHandler& operator=(const TouchHandler&) = delete;
+
+            /**
+             * 从舞台读取最大触摸点数
+             */
+            void initMaxTouches();
+
+            /**
+             * 触摸开始（按下）
+             * @param x 舞台坐标x
+             * @param y 舞台坐标y
+             * @param touchPointID 触摸点ID
+             */
+            void onTouchBegin(double x, double y, int touchPointID);
+
+            /**
+             * 触摸移动，派发给按下时的对象
+             * @param coalescedCount 合并的原始移动次数
+             * @param samples 合并前的各次移动位置，可为空
+             */
+            void onTouchMove(double x, double y, int touchPointID, size_t coalescedCount = 1,
+                             const std::vector<TouchEvent::MoveSample>* samples = nullptr);
+
+            /**
+             * 触摸结束（弹起）
+             */
+            void onTouchEnd(double x, double y, int touchPointID);
+
+            /**
+             * 显示对象离开舞台时调用：以它为按下对象的触摸点改由舞台接收后续事件，
+             * 正在进行的TOUCH_END序列不再向它派发TOUCH_TAP/TOUCH_RELEASE_OUTSIDE，避免持有悬空指针
+             */
+            void onTargetRemoved(DisplayObject* target);
+
+            /**
+             * 当前按下的触摸点数
+             */
+            int getUseTouchesCount() const { return m_useTouchesCount; }
+
+            /**
+             * 累计的碰撞检测次数，用于性能统计
+             */
+            size_t getHitTestCount() const { return m_hitTestCount; }
+
+        private:
+            struct TouchDownTarget {
+                int touchPointID;
+                DisplayObject* target;
+                double lastX;  // 上次派发的位置，位置未变的移动不重复派发
+                double lastY;
+            };
+
+            /**
+             * 碰撞检测，未命中任何对象时返回舞台
+             */
+            DisplayObject* findTarget(double x, double y);
+
+            TouchDownTarget* findTouch(int touchPointID);
+
+            void dispatch(DisplayObject* target, const std::string& type, double x, double y,
+                          int touchPointID, bool touchDown, size_t coalescedCount = 1,
+                          const std::vector<TouchEvent::MoveSample>* samples = nullptr);
+
+            Stage* m_stage;
+            int m_maxTouches = 0;
+            int m_useTouchesCount = 0;
+            std::vector<TouchDownTarget> m_touchDownTargets;  // 按下中的触摸点，数量很少，线性查找
+            std::vector<DisplayObject*> m_endingTargets;       // 正在派发TOUCH_END序列的目标，离开舞台时置空
+            size_t m_hitTestCount = 0;
+        };
+
+    } // namespace sys
+} // namespace egret
@@ -400,6 +400,9 @@ namespace egret {
         
         // 标记显示对象需要重绘
         setRenderDirty(true);
+
+        // 文本尺寸变化，缓存的边界失效
+        invalidateSubtreeBounds();
     }
 
 } // namespace egret
\ No newline at end of file
@@ -1,37 +1,113 @@
 #include "utils/CallLater.hpp"
+#include <chrono>
 #include <iostream>
 #include "utils/Logger.hpp"
 
 namespace egret {
 namespace CallLaterSystem {
 
-    // 延迟函数列表
+    // 延迟函数列表（只在主线程访问）
     static std::vector<CallLaterFunction> callLaterFunctionList;
-    
-    // 异步函数列表
-    static std::vector<CallLaterFunction> callAsyncFunctionList;
 
-    void callLater(CallLaterFunction func) {
-        if (func) {
-            callLaterFunctionList.push_back(func);
+    namespace {
+
+        /**
+         * 无锁多生产者单消费者队列（侵入式，带哨兵节点）
+         * 生产者只做一次exchange和一次store；消费者独占m_tail
+         * 生产者在exchange与链接next之间被挂起时，消费者暂时看不到其后的节点，下一帧再取
+         */
+        class AsyncQueue {
+        public:
+            AsyncQueue() : m_head(&m_stub), m_tail(&m_stub) {}
+
+            ~AsyncQueue() {
+                while (AsyncTask* task = pop()) {
+                    delete task;
+                }
+            }
+
+            void push(AsyncTask* task) {
+                m_size.fetch_add(1, std::memory_order_relaxed);
+                link(task);
+            }
+
+            AsyncTask* pop() {
+                AsyncTask* tail = m_tail;
+                AsyncTask* next = tail->next.load(std::memory_order_acquire);
+                if (tail == &m_stub) {
+                    if (!next) {
+                        return nullptr;
+                    }
+                    m_tail = next;
+                    tail = next;
+                    next = next->next.load(std::memory_order_acquire);
+                }
+                if (next) {
+                    m_tail = next;
+                    return take(tail);
+                }
+                if (tail != m_head.load(std::memory_order_acquire)) {
+                    // 有生产者正在链接
+                    return nullptr;
+                }
+                // 队列只剩最后一个节点：把哨兵放回队尾后再取出它
+                link(&m_stub);
+                next = tail->next.load(std::memory_order_acquire);
+                if (next) {
+                    m_tail = next;
+                    return take(tail);
+                }
+                return nullptr;
+            }
+
+            size_t size() const { return m_size.load(std::memory_order_relaxed); }
+
+        private:
+            void link(AsyncTask* task) {
+                task->next.store(nullptr, std::memory_order_relaxed);
+                AsyncTask* prev = m_head.exchange(task, std::memory_order_acq_rel);
+                prev->next.store(task, std::memory_order_release);
+            }
+
+            AsyncTask* take(AsyncTask* task) {
+                m_size.fetch_sub(1, std::memory_order_relaxed);
+                return task;
+            }
+
+            std::atomic<AsyncTask*> m_head;
+            AsyncTask* m_tail;
+            AsyncTask m_stub;
+            std::atomic<size_t> m_size{0};
+        };
+
+        AsyncQueue& asyncQueue() {
+            static AsyncQueue queue;
+            return queue;
         }
+
+        // 每帧执行异步任务的时间预算（毫秒），<=0不限制
+        double asyncTimeBudget = 0.0;
+    }
+
+    void detail::pushAsync(AsyncTask* task) {
+        asyncQueue().push(task);
     }
-    
-    void callAsync(CallLaterFunction func) {
+
+    void callLater(CallLaterFunction func) {
         if (func) {
-            callAsyncFunctionList.push_back(func);
+            callLaterFunctionList.push_back(func);
         }
     }
-    
+
     void executeLaters() {
         if (callLaterFunctionList.empty()) {
             return;
         }
-        
+
         // 复制列表以避免在执行过程中的并发修改问题
         auto functionList = std::move(callLaterFunctionList);
         callLaterFunctionList.clear();
-        
+
         // 执行所有延迟函数
         for (auto& func : functionList) {
             try {
@@ -44,32 +120,56 @@ namespace CallLaterSystem {
             }
         }
     }
-    
+
     void executeAsyncs() {
-        if (callAsyncFunctionList.empty()) {
+        AsyncQueue& queue = asyncQueue();
+        // 只执行开始时已在队列中的任务，任务中再次callAsync的留到下一帧
+        size_t count = queue.size();
+        if (count == 0) {
             return;
         }
-        
-        // 复制列表以避免在执行过程中的并发修改问题
-        auto functionList = std::move(callAsyncFunctionList);
-        callAsyncFunctionList.clear();
-        
-        // 执行所有异步函数
-        for (auto& func : functionList) {
+
+        bool budgeted = asyncTimeBudget > 0.0;
+        auto deadline = std::chrono::steady_clock::now() +
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double, std::milli>(asyncTimeBudget));
+
+        for (size_t i = 0; i < count; ++i) {
+            if (budgeted && i > 0 && std::chrono::steady_clock::now() >= deadline) {
+                break;
+            }
+            AsyncTask* task = queue.pop();
+            if (!task) {
+                break;
+            }
             try {
-                if (func) {
-                    func();
-                }
+                task->run();
             }
             catch (const std::exception& e) {
                 EGRET_ERRORF("callAsync执行出错: {}", e.what());
             }
+            delete task;
         }
     }
-    
+
+    void setAsyncTimeBudget(double milliseconds) {
+        asyncTimeBudget = milliseconds;
+    }
+
+    double getAsyncTimeBudget() {
+        return asyncTimeBudget;
+    }
+
+    size_t getAsyncBacklog() {
+        return asyncQueue().size();
+    }
+
     void clear() {
         callLaterFunctionList.clear();
-        callAsyncFunctionList.clear();
+        AsyncQueue& queue = asyncQueue();
+        while (AsyncTask* task = queue.pop()) {
+            delete task;
+        }
     }
 
 } // namespace CallLaterSystem
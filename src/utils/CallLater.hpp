@@ -1,6 +1,10 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <functional>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <any>
 
@@ -11,40 +15,87 @@ namespace egret {
      * 对应 TypeScript 的 callLater 相关功能
      */
     namespace CallLaterSystem {
-        
+
         /**
          * 延迟函数参数类型
          */
         using CallLaterFunction = std::function<void()>;
-        
+
         /**
-         * 延迟函数到屏幕重绘前执行
+         * 异步任务节点：任务对象与队列链接放在同一次分配中，可容纳只能移动的可调用对象
+         */
+        struct AsyncTask {
+            std::atomic<AsyncTask*> next{nullptr};
+            virtual ~AsyncTask() = default;
+            virtual void run() {}
+        };
+
+        namespace detail {
+            template<typename F>
+            struct AsyncTaskImpl final : AsyncTask {
+                F func;
+                explicit AsyncTaskImpl(F&& f) : func(std::move(f)) {}
+                void run() override { func(); }
+            };
+
+            template<typename F>
+            bool isEmptyCallable(const F&) { return false; }
+            template<typename R, typename... Args>
+            bool isEmptyCallable(const std::function<R(Args...)>& f) { return !f; }
+            template<typename R, typename... Args>
+            bool isEmptyCallable(R (*f)(Args...)) { return f == nullptr; }
+
+            void pushAsync(AsyncTask* task);
+        }
+
+        /**
+         * 延迟函数到屏幕重绘前执行（只能在主线程调用）
          * @param func 要延迟执行的函数
          */
         void callLater(CallLaterFunction func);
-        
+
         /**
-         * 异步调用函数  
+         * 异步调用函数：投递到主线程，在下一次SystemTicker::update开始时执行
+         * 可在任意线程调用（无锁多生产者单消费者队列），可调用对象只需可移动
          * @param func 要异步调用的函数
          */
-        void callAsync(CallLaterFunction func);
-        
+        template<typename F>
+        void callAsync(F&& func) {
+            using Task = detail::AsyncTaskImpl<std::decay_t<F>>;
+            if (detail::isEmptyCallable(func)) {
+                return;
+            }
+            detail::pushAsync(new Task(std::decay_t<F>(std::forward<F>(func))));
+        }
+
         /**
          * 执行所有延迟调用的函数
          * 由SystemTicker在渲染时调用
          */
         void executeLaters();
-        
+
         /**
-         * 执行所有异步调用的函数
-         * 由SystemTicker在每帧开始时调用
+         * 执行异步调用的函数（只能在主线程调用）
+         * 由SystemTicker在每帧开始时调用；只执行调用开始时已在队列中的任务，执行中新投递的留到下一帧
+         * 设置了时间预算时超出预算即停止，剩余任务留到下一帧（每帧至少执行一个）
          */
         void executeAsyncs();
-        
+
+        /**
+         * 每帧执行异步任务的时间预算（毫秒），不大于0表示不限制（默认）
+         */
+        void setAsyncTimeBudget(double milliseconds);
+        double getAsyncTimeBudget();
+
+        /**
+         * 队列中等待执行的异步任务数量（积压），可在任意线程读取
+         */
+        size_t getAsyncBacklog();
+
         /**
-         * 清空所有待执行的函数
+         * 清空所有待执行的函数（只能在主线程调用）
          */
         void clear();
     }
 
-} // namespace egret
\ No newline at end of file
+} // namespace egret
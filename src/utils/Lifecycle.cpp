@@ -43,8 +43,9 @@ namespace egret {
         
         // 派发DEACTIVATE事件
         if (m_stage) {
-            auto event = std::make_shared<Event>(Event::DEACTIVATE);
+            auto event = Event::create(Event::DEACTIVATE);
             m_stage->dispatchEvent(*event);
+            Event::release(event);
         }
         
         // 调用暂停回调
@@ -76,8 +77,9 @@ namespace egret {
         
         // 派发ACTIVATE事件
         if (m_stage) {
-            auto event = std::make_shared<Event>(Event::ACTIVATE);
+            auto event = Event::create(Event::ACTIVATE);
             m_stage->dispatchEvent(*event);
+            Event::release(event);
         }
         
         // 调用恢复回调
@@ -150,6 +150,7 @@ public:
     static void error(const std::string& message, const char* file = nullptr, int line = 0, const char* func = nullptr);
     
     // ========== 格式化日志方法 (C++扩展) ==========
+    // 格式串按原类型传入，只在级别允许输出时才构造std::string，被过滤的日志不产生堆分配
     
     /**
      * @brief 格式化调试日志输出
@@ -159,8 +160,8 @@ public:
      * @param format 格式化字符串
      * @param args 格式化参数
      */
-    template<typename... Args>
-    static void debugf(const char* file, int line, const char* func, const std::string& format, Args&&... args) {
+    template<typename Format, typename... Args>
+    static void debugf(const char* file, int line, const char* func, const Format& format, Args&&... args) {
         if (shouldLog(Level::DEBUG)) {
             logFormatted(Level::DEBUG, file, line, func, format, std::forward<Args>(args)...);
         }
@@ -174,8 +175,8 @@ public:
      * @param format 格式化字符串
      * @param args 格式化参数
      */
-    template<typename... Args>
-    static void infof(const char* file, int line, const char* func, const std::string& format, Args&&... args) {
+    template<typename Format, typename... Args>
+    static void infof(const char* file, int line, const char* func, const Format& format, Args&&... args) {
         if (shouldLog(Level::INFO)) {
             logFormatted(Level::INFO, file, line, func, format, std::forward<Args>(args)...);
         }
@@ -189,8 +190,8 @@ public:
      * @param format 格式化字符串
      * @param args 格式化参数
      */
-    template<typename... Args>
-    static void warnf(const char* file, int line, const char* func, const std::string& format, Args&&... args) {
+    template<typename Format, typename... Args>
+    static void warnf(const char* file, int line, const char* func, const Format& format, Args&&... args) {
         if (shouldLog(Level::WARN)) {
             logFormatted(Level::WARN, file, line, func, format, std::forward<Args>(args)...);
         }
@@ -204,8 +205,8 @@ public:
      * @param format 格式化字符串
      * @param args 格式化参数
      */
-    template<typename... Args>
-    static void errorf(const char* file, int line, const char* func, const std::string& format, Args&&... args) {
+    template<typename Format, typename... Args>
+    static void errorf(const char* file, int line, const char* func, const Format& format, Args&&... args) {
         if (shouldLog(Level::ERROR)) {
             logFormatted(Level::ERROR, file, line, func, format, std::forward<Args>(args)...);
         }
@@ -1,7 +1,95 @@
 #include "utils/Timer.hpp"
+#include "events/TimerEvent.hpp"
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 
 namespace egret {
+
+    // ========== Timer ==========
+
+    namespace {
+        long long toWheelDelay(double delay) {
+            return std::max(1LL, std::llround(delay));
+        }
+    }
+
+    Timer::Timer(double delay, int repeatCount)
+        : EventDispatcher()
+        , m_delay(delay < 1 ? 1 : delay)
+        , m_repeatCount(repeatCount) {
+    }
+
+    Timer::~Timer() {
+        sys::getTimerWheel().cancel(m_handle);
+    }
+
+    void Timer::setDelay(double value) {
+        if (value < 1) {
+            value = 1;
+        }
+        if (m_delay == value) {
+            return;
+        }
+        m_delay = value;
+        if (m_handle) {
+            stop();
+            start();
+        }
+    }
+
+    void Timer::start() {
+        if (m_handle) {
+            return;
+        }
+        if (m_repeatCount > 0 && m_currentCount >= m_repeatCount) {
+            return;
+        }
+        long long delay = toWheelDelay(m_delay);
+        m_handle = sys::getTimerWheel().schedule(delay, [this]() { onTick(); }, delay);
+    }
+
+    void Timer::stop() {
+        sys::getTimerWheel().cancel(m_handle);
+        m_handle = {};
+    }
+
+    void Timer::reset() {
+        stop();
+        m_currentCount = 0;
+    }
+
+    void Timer::onTick() {
+        ++m_currentCount;
+        bool complete = m_repeatCount > 0 && m_currentCount >= m_repeatCount;
+        if (complete) {
+            stop();
+        }
+        TimerEvent::dispatchTimerEvent(this, TimerEvent::TIMER);
+        if (complete) {
+            TimerEvent::dispatchTimerEvent(this, TimerEvent::TIMER_COMPLETE);
+        }
+    }
+
+    // ========== setTimeout / setInterval ==========
+
+    TimerHandle setTimeout(std::function<void()> listener, double delay) {
+        return sys::getTimerWheel().schedule(toWheelDelay(delay), std::move(listener));
+    }
+
+    void clearTimeout(TimerHandle handle) {
+        sys::getTimerWheel().cancel(handle);
+    }
+
+    TimerHandle setInterval(std::function<void()> listener, double delay) {
+        long long interval = toWheelDelay(delay);
+        return sys::getTimerWheel().schedule(interval, std::move(listener), interval);
+    }
+
+    void clearInterval(TimerHandle handle) {
+        sys::getTimerWheel().cancel(handle);
+    }
+
 namespace sys {
 
     // 全局变量定义
@@ -12,4 +100,4 @@ namespace sys {
     bool requestRenderingFlag = false;
 
 } // namespace sys
-} // namespace egret
\ No newline at end of file
+} // namespace egret
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "events/EventDispatcher.hpp"
+#include "utils/TimerWheel.hpp"
 #include <chrono>
+#include <functional>
 
 namespace egret {
 
@@ -16,6 +19,90 @@ namespace egret {
         return duration.count();
     }
 
+    /**
+     * 计时器：按指定间隔派发TimerEvent.TIMER，达到重复次数后派发TimerEvent.TIMER_COMPLETE
+     * 对应 TypeScript 的 egret.Timer，由全局时间轮调度，不需要每帧轮询
+     */
+    class Timer : public EventDispatcher {
+    public:
+        /**
+         * @param delay 计时器事件间的延迟（毫秒），小于1按1处理
+         * @param repeatCount 重复次数，0表示无限运行
+         */
+        explicit Timer(double delay, int repeatCount = 0);
+        ~Timer() override;
+
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+
+        /**
+         * 计时器事件间的延迟（毫秒）；运行中修改时从当前时刻重新开始计时
+         */
+        double getDelay() const { return m_delay; }
+        void setDelay(double value);
+
+        /**
+         * 设置的计时器运行总次数，0表示无限运行
+         */
+        int getRepeatCount() const { return m_repeatCount; }
+        void setRepeatCount(int value) { m_repeatCount = value; }
+
+        /**
+         * 计时器从0开始后触发的总次数
+         */
+        int getCurrentCount() const { return m_currentCount; }
+
+        /**
+         * 计时器是否正在运行
+         */
+        bool getRunning() const { return static_cast<bool>(m_handle); }
+
+        /**
+         * 启动计时器（已达到重复次数时不会启动）
+         */
+        void start();
+
+        /**
+         * 停止计时器，再次start()时从头计时，currentCount保留
+         */
+        void stop();
+
+        /**
+         * 停止计时器并将currentCount重置为0
+         */
+        void reset();
+
+    private:
+        void onTick();
+
+        double m_delay;
+        int m_repeatCount;
+        int m_currentCount = 0;
+        TimerHandle m_handle;
+    };
+
+    /**
+     * 在指定的延迟（毫秒）后运行指定的函数一次，对应 TypeScript 的 egret.setTimeout
+     * @return 可传给clearTimeout的句柄
+     */
+    TimerHandle setTimeout(std::function<void()> listener, double delay);
+
+    /**
+     * 取消setTimeout，对应 TypeScript 的 egret.clearTimeout
+     */
+    void clearTimeout(TimerHandle handle);
+
+    /**
+     * 以指定的间隔（毫秒）重复运行指定的函数，对应 TypeScript 的 egret.setInterval
+     * @return 可传给clearInterval的句柄
+     */
+    TimerHandle setInterval(std::function<void()> listener, double delay);
+
+    /**
+     * 取消setInterval，对应 TypeScript 的 egret.clearInterval
+     */
+    void clearInterval(TimerHandle handle);
+
     namespace sys {
         /**
          * 引擎启动时间
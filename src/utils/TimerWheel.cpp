@@ -0,0 +1,232 @@
+#include "utils/TimerWheel.hpp"
+#include "utils/Timer.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+#include <exception>
+
+namespace egret {
+namespace sys {
+
+    TimerWheel::TimerWheel(long long startTime)
+        : m_currentTime(startTime + 1) {
+        std::fill(std::begin(m_slots), std::end(m_slots), -1);
+    }
+
+    // ========== 调度与取消 ==========
+
+    TimerHandle TimerWheel::schedule(long long delay, Callback callback, long long interval) {
+        if (!callback) {
+            return {};
+        }
+        int index = allocateNode();
+        Node& node = m_nodes[index];
+        node.callback = std::move(callback);
+        node.expires = getCurrentTime() + std::max(delay, 1LL);
+        node.interval = interval > 0 ? interval : 0;
+        node.active = true;
+        ++m_activeCount;
+        link(index);
+        return {(static_cast<uint64_t>(node.generation) << 32) | static_cast<uint32_t>(index)};
+    }
+
+    bool TimerWheel::cancel(TimerHandle handle) {
+        int index = nodeFromHandle(handle);
+        if (index < 0) {
+            return false;
+        }
+        unlink(index);
+        freeNode(index);
+        return true;
+    }
+
+    bool TimerWheel::isActive(TimerHandle handle) const {
+        return nodeFromHandle(handle) >= 0;
+    }
+
+    // ========== 推进 ==========
+
+    void TimerWheel::advance(long long now) {
+        while (m_currentTime <= now) {
+            if (m_activeCount == 0) {
+                m_currentTime = now + 1;
+                return;
+            }
+            if (m_rootCount == 0 && (m_currentTime & (kRootSize - 1)) != 0) {
+                // 第0层为空：直接跳到下一次下沉的时刻
+                long long boundary = (m_currentTime | (kRootSize - 1)) + 1;
+                m_currentTime = std::min(boundary, now + 1);
+                continue;
+            }
+            runTick();
+        }
+    }
+
+    void TimerWheel::runTick() {
+        long long tick = m_currentTime;
+        if ((tick & (kRootSize - 1)) == 0) {
+            for (int level = 1; level <= kLevelCount && cascade(level) == 0; ++level) {
+            }
+        }
+
+        // 整个槽位转入触发列表；回调中新增的定时器至少在下一刻，不会在本轮触发
+        int& firing = m_slots[kFiringSlot];
+        int& root = m_slots[tick & (kRootSize - 1)];
+        firing = root;
+        root = -1;
+        for (int i = firing; i >= 0; i = m_nodes[i].next) {
+            m_nodes[i].slot = kFiringSlot;
+            --m_rootCount;
+        }
+        m_currentTime = tick + 1;
+
+        while (firing >= 0) {
+            int index = firing;
+            unlink(index);
+            // 回调可能新增定时器导致m_nodes扩容，先把回调移出再调用
+            Callback callback = std::move(m_nodes[index].callback);
+            uint32_t generation = m_nodes[index].generation;
+            bool repeat = m_nodes[index].interval > 0;
+            if (!repeat) {
+                freeNode(index);
+            }
+            try {
+                callback();
+            }
+            catch (const std::exception& e) {
+                EGRET_ERRORF("定时器回调出错: {}", e.what());
+            }
+            if (repeat) {
+                Node& node = m_nodes[index];
+                // 回调中被取消时代数已变化
+                if (node.generation == generation && node.active) {
+                    node.callback = std::move(callback);
+                    node.expires = std::max(node.expires + node.interval, m_currentTime);
+                    link(index);
+                }
+            }
+        }
+    }
+
+    int TimerWheel::cascade(int level) {
+        int shift = kRootBits + (level - 1) * kLevelBits;
+        int index = static_cast<int>((m_currentTime >> shift) & (kLevelSize - 1));
+        int& slot = m_slots[kRootSize + (level - 1) * kLevelSize + index];
+        int head = slot;
+        slot = -1;
+        while (head >= 0) {
+            int next = m_nodes[head].next;
+            link(head);
+            head = next;
+        }
+        return index;
+    }
+
+    // ========== 槽位链表 ==========
+
+    void TimerWheel::link(int index) {
+        long long expires = m_nodes[index].expires;
+        long long delta = expires - m_currentTime;
+        int slot;
+        if (delta < kRootSize) {
+            // 已过期的放到当前槽，下一刻触发
+            slot = static_cast<int>(std::max(expires, m_currentTime) & (kRootSize - 1));
+        } else {
+            if (delta > kMaxDelta) {
+                // 超出范围：先放在最高层最远的槽，下沉时按真实到期时间重新分配
+                expires = m_currentTime + kMaxDelta;
+                delta = kMaxDelta;
+            }
+            int level = 1;
+            while (delta >= (1LL << (kRootBits + level * kLevelBits))) {
+                ++level;
+            }
+            int shift = kRootBits + (level - 1) * kLevelBits;
+            slot = kRootSize + (level - 1) * kLevelSize + static_cast<int>((expires >> shift) & (kLevelSize - 1));
+        }
+        linkToSlot(index, slot);
+    }
+
+    void TimerWheel::linkToSlot(int index, int slot) {
+        Node& node = m_nodes[index];
+        node.slot = slot;
+        node.prev = -1;
+        node.next = m_slots[slot];
+        if (node.next >= 0) {
+            m_nodes[node.next].prev = index;
+        }
+        m_slots[slot] = index;
+        if (slot < kRootSize) {
+            ++m_rootCount;
+        }
+    }
+
+    void TimerWheel::unlink(int index) {
+        Node& node = m_nodes[index];
+        if (node.slot == kNotLinked) {
+            return;
+        }
+        if (node.prev >= 0) {
+            m_nodes[node.prev].next = node.next;
+        } else {
+            m_slots[node.slot] = node.next;
+        }
+        if (node.next >= 0) {
+            m_nodes[node.next].prev = node.prev;
+        }
+        if (node.slot < kRootSize) {
+            --m_rootCount;
+        }
+        node.slot = kNotLinked;
+        node.prev = -1;
+        node.next = -1;
+    }
+
+    // ========== 节点分配 ==========
+
+    int TimerWheel::allocateNode() {
+        if (m_freeHead >= 0) {
+            int index = m_freeHead;
+            m_freeHead = m_nodes[index].next;
+            m_nodes[index].next = -1;
+            return index;
+        }
+        m_nodes.emplace_back();
+        return static_cast<int>(m_nodes.size() - 1);
+    }
+
+    void TimerWheel::freeNode(int index) {
+        Node& node = m_nodes[index];
+        node.callback = nullptr;
+        node.active = false;
+        // 代数为0的句柄与无效句柄冲突，跳过
+        if (++node.generation == 0) {
+            node.generation = 1;
+        }
+        node.next = m_freeHead;
+        m_freeHead = index;
+        --m_activeCount;
+    }
+
+    int TimerWheel::nodeFromHandle(TimerHandle handle) const {
+        if (!handle) {
+            return -1;
+        }
+        uint32_t index = static_cast<uint32_t>(handle.id);
+        uint32_t generation = static_cast<uint32_t>(handle.id >> 32);
+        if (index >= m_nodes.size()) {
+            return -1;
+        }
+        const Node& node = m_nodes[index];
+        if (!node.active || node.generation != generation) {
+            return -1;
+        }
+        return static_cast<int>(index);
+    }
+
+    TimerWheel& getTimerWheel() {
+        static TimerWheel instance(getTimer());
+        return instance;
+    }
+
+} // namespace sys
+} // namespace egret
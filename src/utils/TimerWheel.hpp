@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace egret {
+
+    /**
+     * 定时器句柄：低32位为槽位下标，高32位为代数；0表示无效句柄
+     * 槽位复用时代数递增，过期句柄的取消/查询都是安全的空操作
+     */
+    struct TimerHandle {
+        uint64_t id = 0;
+
+        explicit operator bool() const { return id != 0; }
+        bool operator==(const TimerHandle& other) const { return id == other.id; }
+        bool operator!=(const TimerHandle& other) const { return id != other.id; }
+    };
+
+namespace sys {
+
+    /**
+     * 分层时间轮定时器调度器
+     * 精度1ms；第0层256个槽覆盖256ms，之上三层各64个槽，依次覆盖约16秒、17分钟、18小时，更远的到期时间在最高层反复下沉
+     * 定时器节点放在连续数组中并以下标串成槽内双向链表，schedule/cancel为O(1)，
+     * advance只处理到期槽位，与定时器总数无关
+     * 由SystemTicker::update每帧按未暂停的流逝时间推进，回调在主线程执行
+     */
+    class TimerWheel {
+    public:
+        using Callback = std::function<void()>;
+
+        /**
+         * @param startTime 时间轮的起始时刻（毫秒）
+         */
+        explicit TimerWheel(long long startTime = 0);
+
+        TimerWheel(const TimerWheel&) = delete;
+        TimerWheel& operator=(const TimerWheel&) = delete;
+
+        /**
+         * 添加定时器
+         * @param delay 首次触发的延迟（毫秒），小于1按1处理
+         * @param callback 回调函数
+         * @param interval 重复间隔（毫秒），0表示只触发一次
+         * @return 定时器句柄
+         */
+        TimerHandle schedule(long long delay, Callback callback, long long interval = 0);
+
+        /**
+         * 取消定时器，可在任意回调（包括自身的回调）中调用
+         * @return 句柄有效且定时器尚未结束时返回true
+         */
+        bool cancel(TimerHandle handle);
+
+        /**
+         * 定时器是否仍在等待触发
+         */
+        bool isActive(TimerHandle handle) const;
+
+        /**
+         * 推进到指定时刻，依次触发所有到期的定时器
+         * 重复定时器在一次推进中按间隔逐个触发，不会合并
+         * @param now 当前时刻（毫秒），小于当前时刻时忽略
+         */
+        void advance(long long now);
+
+        /**
+         * 时间轮当前时刻（毫秒）
+         */
+        long long getCurrentTime() const { return m_currentTime - 1; }
+
+        /**
+         * 等待触发的定时器数量
+         */
+        size_t getActiveCount() const { return m_activeCount; }
+
+    private:
+        static constexpr int kRootBits = 8;
+        static constexpr int kLevelBits = 6;
+        static constexpr int kRootSize = 1 << kRootBits;
+        static constexpr int kLevelSize = 1 << kLevelBits;
+        static constexpr int kLevelCount = 3;
+        static constexpr int kSlotCount = kRootSize + kLevelSize * kLevelCount;
+        static constexpr long long kMaxDelta = (1LL << (kRootBits + kLevelBits * kLevelCount)) - 1;
+        static constexpr int kNotLinked = -1;
+        static constexpr int kFiringSlot = kSlotCount;
+
+        struct Node {
+            Callback callback;
+            long long expires = 0;
+            long long interval = 0;
+            uint32_t generation = 1;
+            int prev = -1;
+            int next = -1;
+            int slot = kNotLinked;   // 所在槽位；kFiringSlot为正在触发的列表，kNotLinked为未挂入或空闲
+            bool active = false;
+        };
+
+        int allocateNode();
+        void freeNode(int index);
+        int nodeFromHandle(TimerHandle handle) const;
+
+        void link(int index);
+        void linkToSlot(int index, int slot);
+        void unlink(int index);
+
+        /**
+         * 把上层一个槽中的定时器重新分配到下层，返回该槽下标（为0时需要继续下沉更上一层）
+         */
+        int cascade(int level);
+
+        /**
+         * 处理m_currentTime这一刻的第0层槽位
+         */
+        void runTick();
+
+        std::vector<Node> m_nodes;
+        int m_freeHead = -1;
+        int m_slots[kSlotCount + 1];  // 各槽链表头，最后一个为正在触发的列表
+        long long m_currentTime = 0;  // 下一个要处理的时刻，之前的时刻都已处理
+        size_t m_activeCount = 0;
+        size_t m_rootCount = 0;       // 挂在第0层的定时器数量，为0时可以整段跳过
+    };
+
+    /**
+     * 获取全局时间轮（egret::Timer、setTimeout/setInterval使用）
+     */
+    TimerWheel& getTimerWheel();
+
+} // namespace sys
+} // namespace egret
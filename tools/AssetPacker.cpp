@@ -0,0 +1,145 @@
+// egret-pack：离线资源包打包工具
+//
+// 把资源目录下的所有文件打包为一个资源包（格式见AssetPack.hpp），包内路径为相对于资源目录的路径。
+// 运行时以资源根路径为挂载点挂载后，resource.json中的url无需修改：
+//     RES::mountPack("resource.pak", "resource");
+//
+// 用法：
+//     egret-pack [-t 扩展名或包内路径=类型]... <资源目录> <输出文件>
+//     egret-pack --list [--verify] <资源包>
+//
+// 示例：
+//     egret-pack -t assets/ui.json=sheet resource resource.pak
+
+#include "extension/assetsmanager/AssetPack.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+    void printUsage() {
+        std::fprintf(stderr,
+                     "用法:\n"
+                     "  egret-pack [-t 扩展名或包内路径=类型]... <资源目录> <输出文件>\n"
+                     "  egret-pack --list [--verify] <资源包>\n"
+                     "\n"
+                     "类型默认按扩展名推断，-t .json=sheet 指定扩展名，-t assets/ui.json=sheet 指定单个文件\n");
+    }
+
+    int listPack(const std::string& file, bool verify) {
+        std::string error;
+        std::shared_ptr<RES::AssetPack> pack = RES::AssetPack::open(file, &error);
+        if (!pack) {
+            std::fprintf(stderr, "%s\n", error.c_str());
+            return 1;
+        }
+        size_t corrupted = 0;
+        uint64_t total = 0;
+        for (size_t i = 0; i < pack->getEntryCount(); ++i) {
+            RES::AssetPack::Entry entry = pack->getEntry(i);
+            bool ok = !verify || pack->verify(entry);
+            corrupted += ok ? 0 : 1;
+            total += entry.size;
+            std::printf("%08x %10llu  %-6.*s %.*s%s\n", entry.crc32, static_cast<unsigned long long>(entry.size),
+                        static_cast<int>(entry.type.size()), entry.type.data(),
+                        static_cast<int>(entry.path.size()), entry.path.data(), ok ? "" : "  CRC32校验失败");
+        }
+        std::printf("%zu个文件，共%llu字节\n", pack->getEntryCount(), static_cast<unsigned long long>(total));
+        return corrupted == 0 ? 0 : 1;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::unordered_map<std::string, std::string> typeOverrides;
+    std::vector<std::string> positional;
+    bool list = false;
+    bool verify = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--list") == 0) {
+            list = true;
+        } else if (std::strcmp(argv[i], "--verify") == 0) {
+            verify = true;
+        } else if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            std::string rule = argv[++i];
+            size_t eq = rule.find('=');
+            if (eq == std::string::npos || eq == 0 || eq + 1 == rule.size()) {
+                std::fprintf(stderr, "无效的类型参数: %s\n", rule.c_str());
+                return 2;
+            }
+            std::string key = rule.substr(0, eq);
+            typeOverrides[key[0] == '.' ? key : RES::AssetPack::normalizePath(key)] = rule.substr(eq + 1);
+        } else if (argv[i][0] == '-') {
+            printUsage();
+            return 2;
+        } else {
+            positional.push_back(argv[i]);
+        }
+    }
+
+    if (list) {
+        if (positional.size() != 1) {
+            printUsage();
+            return 2;
+        }
+        return listPack(positional[0], verify);
+    }
+    if (positional.size() != 2) {
+        printUsage();
+        return 2;
+    }
+
+    namespace fs = std::filesystem;
+    fs::path inputDir = positional[0];
+    fs::path output = positional[1];
+    std::error_code ec;
+    if (!fs::is_directory(inputDir, ec)) {
+        std::fprintf(stderr, "不是目录: %s\n", inputDir.string().c_str());
+        return 1;
+    }
+
+    RES::AssetPackWriter writer;
+    uint64_t total = 0;
+    std::error_code ignored;
+    fs::path outputAbsolute = fs::weakly_canonical(output, ignored);
+    for (fs::recursive_directory_iterator it(inputDir, ec), end; !ec && it != end; it.increment(ec)) {
+        if (!it->is_regular_file()) {
+            continue;
+        }
+        // 跳过隐藏文件与输出文件本身（输出到资源目录内时）
+        std::string filename = it->path().filename().string();
+        if (filename.empty() || filename[0] == '.' || fs::weakly_canonical(it->path(), ignored) == outputAbsolute) {
+            continue;
+        }
+        std::string path = RES::AssetPack::normalizePath(fs::relative(it->path(), inputDir).generic_string());
+        std::string type;
+        auto byPath = typeOverrides.find(path);
+        auto byExt = typeOverrides.find(it->path().extension().string());
+        if (byPath != typeOverrides.end()) {
+            type = byPath->second;
+        } else if (byExt != typeOverrides.end()) {
+            type = byExt->second;
+        }
+        writer.addFile(path, type, it->path().string());
+        total += it->file_size();
+    }
+    if (ec) {
+        std::fprintf(stderr, "遍历目录失败: %s\n", ec.message().c_str());
+        return 1;
+    }
+
+    std::string error;
+    if (!writer.write(output.string(), &error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    std::printf("已打包%zu个文件（%llu字节）到 %s\n", writer.getFileCount(),
+                static_cast<unsigned long long>(total), output.string().c_str());
+    return 0;
+}